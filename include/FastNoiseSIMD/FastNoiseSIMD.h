@@ -33,11 +33,29 @@
 
 #include "FastNoiseSIMD_config.h"
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 // SSE2/NEON support is guaranteed on 64bit CPUs so no fallback is needed
 #if !(defined(_WIN64) || defined(__x86_64__) || defined(__ppc64__) || defined(__aarch64__) || defined(FN_IOS)) || defined(_DEBUG)
 #define FN_COMPILE_NO_SIMD_FALLBACK
 #endif
 
+// Maximum octave count of SetFractalOctaves() and SetPerturbFractalOctaves()
+#define FN_MAX_OCTAVES 32
+
+// Maximum octave count of SetFractalOctaveWeights()
+#define FN_MAX_OCTAVE_WEIGHTS 16
+
+// Maximum bin count of FastNoiseReduction
+#define FN_MAX_HISTOGRAM_BINS 256
+
+// Maximum point count of FastNoiseOutputTransform::SetSpline()
+#define FN_MAX_SPLINE_POINTS 16
+
 /*
 Tested Compilers:
 -MSVC v120/v140
@@ -73,53 +91,101 @@ Intel Skylake-X - Q2 2017
 
 struct FastNoiseVectorSet;
 
-class FastNoiseSIMD
+// Fill counters, only collected when built with FN_ENABLE_STATS
+// Cycles come from the CPU time stamp counter where available, steady clock nanoseconds otherwise
+struct FastNoiseStats
 {
-public:
+	uint64_t fills = 0;
+	uint64_t points = 0;
+	uint64_t alignedVectors = 0;	// Vectors from the path used when zSize is a multiple of the vector size
+	uint64_t resetVectors = 0;		// Vectors from the AXIS_RESET path used for any other zSize
+	uint64_t vectorSetVectors = 0;
+	uint64_t tailStores = 0;		// Partial vectors at the end of a set
+	uint64_t octaves = 0;			// Fractal octaves evaluated, summed over all points
+	uint64_t allocations = 0;		// GetEmptySet() calls by all instances
+	uint64_t positionCycles = 0;	// Position, transform and perturb
+	uint64_t noiseCycles = 0;		// Noise and fractal octaves
+	uint64_t storeCycles = 0;
+
+	void Add(const FastNoiseStats& other);
+};
+
+// Min, max, sum and histogram of the filled values, accumulated in registers during the fill
+// Saves a second pass over the set, results add up over fills until Reset()
+struct FastNoiseReduction
+{
+	// Values are counted in histogramBins equal bins over [histogramMin, histogramMax), values outside go to the first or last bin
+	// 0 bins skips the histogram
+	int histogramBins = 0;
+	float histogramMin = -1.0f;
+	float histogramMax = 1.0f;
+
+	float min;
+	float max;
+	double sum;
+	uint64_t count;
+	uint64_t histogram[FN_MAX_HISTOGRAM_BINS];
+
+	FastNoiseReduction() { Reset(); }
+
+	// Clears the results, keeps the histogram settings
+	void Reset();
+	float GetMean() const { return count ? float(sum / double(count)) : 0.0f; }
+};
 
+// Remapping applied to each value in the fill just before it is stored
+// Stages run in the order below, each one is skipped at its default
+struct FastNoiseOutputTransform
+{
+	// value * scale + bias
+	float scale = 1.0f;
+	float bias = 0.0f;
+
+	// |value|
+	bool abs = false;
+
+	// sign(value) * |value|^exponent
+	float exponent = 1.0f;
+
+	// Rounds down to 1 / terraceSteps levels, terraceSmoothness ramps the top of each step into the next
+	// Smoothness 0 gives hard steps, 1 a continuous ramp
+	float terraceSteps = 0.0f;
+	float terraceSmoothness = 0.0f;
+
+	// Piecewise linear or monotone cubic curve through up to FN_MAX_SPLINE_POINTS points, x must be ascending
+	// The cubic tangents keep the curve from overshooting the points, values outside the points take the end values
+	void SetSpline(int count, const float* x, const float* y, bool cubic);
+	void ClearSpline() { splineSegments = 0; }
+
+	// Clamps to [clampMin, clampMax]
+	bool clamp = false;
+	float clampMin = 0.0f;
+	float clampMax = 1.0f;
+
+	// Scalar form of the transform
+	float Apply(float value) const;
+
+	// Set by SetSpline(), segment i is c0 + t * (c1 + t * (c2 + t * c3)) with t = (value - splineX[i]) * splineInvWidth[i]
+	int splineSegments = 0;
+	float splineX[FN_MAX_SPLINE_POINTS];
+	float splineInvWidth[FN_MAX_SPLINE_POINTS - 1];
+	float splineCoefficients[FN_MAX_SPLINE_POINTS - 1][4];
+};
+
+// Every noise setting of FastNoiseSIMD as a plain copyable value
+// A config can be shared between threads and passed to the const fills of any FastNoiseSIMD object
+// Derived values such as the fractal bounding are updated by the setters and stored with the settings
+class FastNoiseConfig
+{
+public:
 	enum NoiseType { Value, ValueFractal, Perlin, PerlinFractal, Simplex, SimplexFractal, OpenSimplex2, OpenSimplex2Fractal, WhiteNoise, Cellular, Cubic, CubicFractal };
-	enum FractalType { FBM, Billow, RigidMulti };
-	enum PerturbType { None, Gradient, GradientFractal, Normalise, Gradient_Normalise, GradientFractal_Normalise };
+	enum FractalType { FBM, Billow, RigidMulti, HybridMulti, HeteroTerrain, ErodedFBM };
+	enum PerturbType { None, Gradient, GradientFractal, Normalise, Gradient_Normalise, GradientFractal_Normalise, SimplexGradient, SimplexGradientFractal, OpenSimplex2Gradient, OpenSimplex2GradientFractal };
 
 	enum CellularDistanceFunction { Euclidean, Manhattan, Natural };
 	enum CellularReturnType { CellValue, Distance, Distance2, Distance2Add, Distance2Sub, Distance2Mul, Distance2Div, NoiseLookup, Distance2Cave };
 
-	// Creates new FastNoiseSIMD for the highest supported instuction set of the CPU 
-	static FastNoiseSIMD* NewFastNoiseSIMD(int seed = 1337);
-
-	// Returns highest detected level of CPU support
-	// 5: ARM NEON
-	// 4: AVX-512F
-	// 3: AVX2 & FMA3
-	// 2: SSE4.1
-	// 1: SSE2
-	// 0: Fallback, no SIMD support
-	static int GetSIMDLevel(void);
-
-	// Sets the SIMD level for newly created FastNoiseSIMD objects
-	// 5: ARM NEON
-	// 4: AVX-512F
-	// 3: AVX2 & FMA3
-	// 2: SSE4.1
-	// 1: SSE2
-	// 0: Fallback, no SIMD support
-	// -1: Auto-detect fastest supported (Default)
-	// Caution: Setting this manually can cause crashes on CPUs that do not support that level
-	// Caution: Changing this after creating FastNoiseSIMD objects has undefined behaviour
-	static void SetSIMDLevel(int level) { s_currentSIMDLevel = level; }
-
-	// Free a noise set from memory
-	static void FreeNoiseSet(float* noiseSet);
-
-	// Create an empty (aligned) noise set for use with FillNoiseSet()
-	static float* GetEmptySet(int size);
-
-	// Create an empty (aligned) noise set for use with FillNoiseSet()
-	static float* GetEmptySet(int xSize, int ySize, int zSize) { return GetEmptySet(xSize*ySize*zSize); }
-
-	// Rounds the size up to the nearest aligned size for the current SIMD level
-	static int AlignedSize(int size);
-
+	explicit FastNoiseConfig(int seed = 1337);
 
 	// Returns seed used for all noise types
 	int GetSeed(void) const { return m_seed; }
@@ -140,10 +206,19 @@ public:
 	// Defaults: 1.0
 	void SetAxisScales(float xScale, float yScale, float zScale) { m_xScale = xScale; m_yScale = yScale; m_zScale = zScale; }
 
+	// Sets a row major 3x4 matrix applied to the input position before frequency and perturb
+	// Rotating the domain hides the axis aligned artifacts of Value/Perlin noise
+	// The translation column is in world units, axis scales must be non zero
+	// Default: none
+	void SetTransform(const float* transform);
+
+	// Removes the transform set by SetTransform()
+	void ClearTransform() { m_transformEnabled = false; }
 
-	// Sets octave count for all fractal noise types
+
+	// Sets octave count for all fractal noise types, from 1 to FN_MAX_OCTAVES
 	// Default: 3
-	void SetFractalOctaves(int octaves) { m_octaves = octaves; m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain);	}
+	void SetFractalOctaves(int octaves);
 
 	// Sets octave lacunarity for all fractal noise types
 	// Default: 2.0
@@ -151,12 +226,43 @@ public:
 
 	// Sets octave gain for all fractal noise types
 	// Default: 0.5
-	void SetFractalGain(float gain) { m_gain = gain; m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain); }
+	void SetFractalGain(float gain) { m_gain = gain; UpdateFractalBounding(); }
 
 	// Sets method for combining octaves in all fractal noise types
 	// Default: FBM
 	void SetFractalType(FractalType fractalType) { m_fractalType = fractalType; }
 
+	// Sets the offset added to each octave in HybridMulti and HeteroTerrain
+	// Higher values give smoother valleys and rougher peaks, output is not bounded to -1..1
+	// Default: 0.7
+	void SetFractalOffset(float fractalOffset) { m_fractalOffset = fractalOffset; }
+
+	// Sets how strongly the accumulated slope damps later octaves in ErodedFBM
+	// ErodedFBM estimates the slope with finite differences, it costs 4 noise lookups per octave
+	// Default: 1.0
+	void SetFractalErosion(float fractalErosion) { m_fractalErosion = fractalErosion; }
+
+	// Rotates the domain between each fractal octave
+	// Reduces artifacts from octaves lining up, also applies to cellular NoiseLookup
+	// Default: false
+	void SetFractalRotation(bool fractalRotation) { m_fractalRotation = fractalRotation; }
+
+	// Skips fractal octaves above the Nyquist limit of the sample spacing in (Get/Fill)NoiseSet()
+	// The last octave is faded by the fractional octave count, the fractal bounding is not changed
+	// Vector sets have no sample spacing and always use all octaves
+	// Default: false
+	void SetFractalAntiAliasing(bool fractalAntiAliasing) { m_fractalAntiAliasing = fractalAntiAliasing; }
+
+	// Replaces the geometric octave series with explicit per octave values, up to FN_MAX_OCTAVE_WEIGHTS octaves
+	// Frequencies multiply the base frequency and must be non zero, seed offsets are added to the seed
+	// The octave count is taken from the weights and the fractal bounding is 1 / sum(|amplitude|)
+	// Anti-aliasing keeps the leading octaves below the Nyquist limit, frequencies should be ascending
+	// Default: none, octave i uses lacunarity^i, gain^i and seed + i
+	void SetFractalOctaveWeights(int count, const float* amplitudes, const float* frequencies, const int* seedOffsets);
+
+	// Removes the weights set by SetFractalOctaveWeights()
+	void ClearFractalOctaveWeights() { m_octaveWeightCount = 0; UpdateFractalBounding(); }
+
 
 	// Sets return type from cellular noise calculations
 	// Default: Distance
@@ -187,21 +293,23 @@ public:
 
 
 	// Enables position perturbing for all noise types
+	// Simplex/OpenSimplex2 perturb types sample 4 corners per call instead of 8,
+	// and have less visible axis aligned artifacts than Gradient
 	// Default: None
 	void SetPerturbType(PerturbType perturbType) { m_perturbType = perturbType; }
 
 	// Sets the maximum distance the input position can be perturbed
-	// Default: 1.0
-	void SetPerturbAmp(float perturbAmp) { m_perturbAmp = perturbAmp / 511.5f; }
+	// Default: 511.5
+	void SetPerturbAmp(float perturbAmp) { m_perturbAmp = perturbAmp; }
 
 	// Set the relative frequency for the perturb gradient
 	// Default: 0.5
 	void SetPerturbFrequency(float perturbFrequency) { m_perturbFrequency = perturbFrequency; }
 
 
-	// Sets octave count for perturb fractal types
+	// Sets octave count for perturb fractal types, from 1 to FN_MAX_OCTAVES
 	// Default: 3
-	void SetPerturbFractalOctaves(int perturbOctaves) { m_perturbOctaves = perturbOctaves; m_perturbFractalBounding = CalculateFractalBounding(m_perturbOctaves, m_perturbGain); }
+	void SetPerturbFractalOctaves(int perturbOctaves);
 
 	// Sets octave lacunarity for perturb fractal types 
 	// Default: 2.0
@@ -215,16 +323,188 @@ public:
 	// Default: 1.0
 	void SetPerturbNormaliseLength(float perturbNormaliseLength) { m_perturbNormaliseLength = perturbNormaliseLength; }
 
+	// Number of fractal octaves with a sample spacing below the Nyquist limit at this scaleModifier
+	// Uses the frequency and largest axis scale, result is from 1 to the fractal octave count
+	int GetNyquistOctaves(float scaleModifier) const;
+
+
+	// Compact little endian binary form of every setting, the same on all platforms
+	// The transform and octave weights are only stored while they are set
+	std::vector<uint8_t> SaveBinary() const;
+
+	// Returns false and leaves the settings unchanged if data is not a complete binary config
+	bool LoadBinary(const uint8_t* data, size_t size);
+
+	// Readable form, one "Setting value" line per setter, e.g. "FractalOctaves 5"
+	std::string SaveText() const;
+
+	// Settings missing from the text keep their defaults
+	// Returns false and leaves the settings unchanged on unknown settings or values
+	bool LoadText(const std::string& text);
+
+	// 64 bit FNV-1a hash of the binary form for use as a cache key, the same on every platform
+	// The binary form starts with its layout version, so hashes change with every new layout version
+	uint64_t GetHash() const;
+
+protected:
+	int m_seed = 1337;
+	float m_frequency = 0.01f;
+	NoiseType m_noiseType = SimplexFractal;
+
+	float m_xScale = 1.0f;
+	float m_yScale = 1.0f;
+	float m_zScale = 1.0f;
+
+	bool m_transformEnabled = false;
+	float m_transform[12] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 };
+
+	int m_octaves = 3;
+	float m_lacunarity = 2.0f;
+	float m_gain = 0.5f;
+	FractalType m_fractalType = FBM;	
+	float m_fractalBounding;	
+	bool m_fractalRotation = false;
+	bool m_fractalAntiAliasing = false;
+	float m_fractalOffset = 0.7f;
+	float m_fractalErosion = 1.0f;
+
+	int m_octaveWeightCount = 0;
+	float m_octaveAmplitudes[FN_MAX_OCTAVE_WEIGHTS];
+	float m_octaveFrequencies[FN_MAX_OCTAVE_WEIGHTS];
+	int m_octaveSeedOffsets[FN_MAX_OCTAVE_WEIGHTS];
+
+	CellularDistanceFunction m_cellularDistanceFunction = Euclidean;
+	CellularReturnType m_cellularReturnType = Distance;
+	NoiseType m_cellularNoiseLookupType = Simplex;
+	float m_cellularNoiseLookupFrequency = 0.2f;
+	int m_cellularDistanceIndex0 = 0;
+	int m_cellularDistanceIndex1 = 1;
+	float m_cellularJitter = 0.45f;
+
+	PerturbType m_perturbType = None;
+	float m_perturbAmp = 511.5f;	// Divided by 511.5 in the kernels, the range of the gradient perturb vectors
+	float m_perturbFrequency = 0.5f;
+
+	int m_perturbOctaves = 3;
+	float m_perturbLacunarity = 2.0f;
+	float m_perturbGain = 0.5f;
+	float m_perturbFractalBounding;
+	float m_perturbNormaliseLength = 1.0f;
+
+	static float CalculateFractalBounding(int octaves, float gain);
+	float CalculateNyquistOctaves(float scaleModifier) const;
+	void UpdateFractalBounding();
+	int GetFractalOctaveCount() const { return m_octaveWeightCount > 0 ? m_octaveWeightCount : m_octaves; }
+
+	friend class FastNoiseIncrementalSet;
+};
+
+class FastNoiseSIMD : public FastNoiseConfig
+{
+public:
+
+	// Creates new FastNoiseSIMD for the highest supported instuction set of the CPU 
+	static FastNoiseSIMD* NewFastNoiseSIMD(int seed = 1337);
+
+	// Creates new FastNoiseSIMD for the highest compiled and CPU supported level up to the given level, see GetSIMDLevel() for values
+	// Does not read or change the level used by NewFastNoiseSIMD(), instances of different levels can be used side by side
+	static FastNoiseSIMD* NewFastNoiseSIMDAtLevel(int level, int seed = 1337);
+
+	// Returns the SIMD level this object was created for
+	int GetInstanceSIMDLevel(void) const { return m_simdLevel; }
+
+	// Returns highest detected level of CPU support
+	// 5: ARM NEON
+	// 4: AVX-512F
+	// 3: AVX2 & FMA3
+	// 2: SSE4.1
+	// 1: SSE2
+	// 0: Fallback, no SIMD support
+	static int GetSIMDLevel(void);
+
+	// Sets the SIMD level for newly created FastNoiseSIMD objects
+	// 5: ARM NEON
+	// 4: AVX-512F
+	// 3: AVX2 & FMA3
+	// 2: SSE4.1
+	// 1: SSE2
+	// 0: Fallback, no SIMD support
+	// -1: Auto-detect fastest supported (Default)
+	// Instances are never created above the level the CPU supports
+	static void SetSIMDLevel(int level) { s_currentSIMDLevel = level; }
+
+	// Free a noise set from memory
+	static void FreeNoiseSet(float* noiseSet);
+
+	// Create an empty (aligned) noise set for use with FillNoiseSet()
+	// Sets are aligned for the widest compiled SIMD level and work with objects of any level
+	static float* GetEmptySet(int size);
+
+	// Create an empty (aligned) noise set for use with FillNoiseSet()
+	static float* GetEmptySet(int xSize, int ySize, int zSize) { return GetEmptySet(xSize*ySize*zSize); }
+
+	// Rounds the size up to the nearest aligned size for the widest compiled SIMD level
+	static int AlignedSize(int size);
+
+	// Returns the fill counters collected since creation or the last ResetStats()
+	// Always zero unless built with FN_ENABLE_STATS, fills on the same object from several threads race on the counters
+	FastNoiseStats GetStats() const;
+
+	// Clears the fill counters of this object and the shared allocation counter
+	void ResetStats();
+
+	// Returns the settings of this object
+	const FastNoiseConfig& GetConfig(void) const { return *this; }
+
+	// Replaces every setting of this object
+	void SetConfig(const FastNoiseConfig& config) { FastNoiseConfig::operator=(config); }
+
 
 	static FastNoiseVectorSet* GetVectorSet(int xSize, int ySize, int zSize);
 	static FastNoiseVectorSet* GetSamplingVectorSet(int sampleScale, int xSize, int ySize, int zSize);
 	static void FillVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int ySize, int zSize);
 	static void FillSamplingVectorSet(FastNoiseVectorSet* vectorSet, int sampleScale, int xSize, int ySize, int zSize);
 
+	// Implicit vector sets store no coordinates, positions are generated in the fill kernel
+	// from the grid index (ix, iy, iz) in the same order as FillVectorSet
+	// transform: row major 3x4 matrix applied to (ix, iy, iz, 1), nullptr for identity
+	static FastNoiseVectorSet* GetGridVectorSet(int xSize, int ySize, int zSize, const float* transform = nullptr);
+	static void FillGridVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int ySize, int zSize, const float* transform = nullptr);
+
+	// Positions on a sphere shell, the transformed grid position is normalised and scaled by radius
+	// The transform must not map any grid index to the origin
+	static FastNoiseVectorSet* GetSphereVectorSet(int xSize, int ySize, int zSize, const float* transform, float radius);
+	static void FillSphereVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int ySize, int zSize, const float* transform, float radius);
+
 	float* GetNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	void FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	void FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f);
 
+	// Fill and add the values to reduction in the same pass, see FastNoiseReduction
+	// Runs the const fill below with the settings of this object, fill counters are not collected
+	void FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier, FastNoiseReduction& reduction);
+	void FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, FastNoiseReduction& reduction, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f);
+
+	// Fill with transform applied to each value before it is stored, see FastNoiseOutputTransform
+	// When reduction is not null it collects the transformed values, fill counters are not collected
+	void FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier, const FastNoiseOutputTransform& transform, FastNoiseReduction* reduction = nullptr);
+	void FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, const FastNoiseOutputTransform& transform, FastNoiseReduction* reduction = nullptr, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f);
+
+	// Fill using the settings of config instead of the settings of this object
+	// The object is not modified, one object per SIMD level can serve every thread, fill counters are not collected
+	// When transform is not null it is applied to each value before it is stored, when reduction is not null it collects the stored values
+	float* GetNoiseSet(const FastNoiseConfig& config, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) const;
+	virtual void FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f,
+		const FastNoiseOutputTransform* transform = nullptr, FastNoiseReduction* reduction = nullptr) const = 0;
+	virtual void FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f,
+		const FastNoiseOutputTransform* transform = nullptr, FastNoiseReduction* reduction = nullptr) const = 0;
+
+	// Samples a cube sphere face grid projected onto a sphere of radius, noiseSet[v * uSize + u]
+	// face: 0 +X, 1 -X, 2 +Y, 3 -Y, 4 +Z, 5 -Z
+	// (u, v) from -1 to 1 covers the whole face, the corners are included in the grid
+	float* GetCubeSphereSet(int face, float uMin, float vMin, float uMax, float vMax, int uSize, int vSize, float radius);
+	void FillCubeSphereSet(float* noiseSet, int face, float uMin, float vMin, float uMax, float vMax, int uSize, int vSize, float radius);
+
 	float* GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale);
 	virtual void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale) = 0;
 	virtual void FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
@@ -272,43 +552,37 @@ public:
 	virtual void FillCubicSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 	virtual void FillCubicFractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 
-	virtual ~FastNoiseSIMD() { }
+	// Sums fractal octaves [octaveStart, octaveEnd) of the current noise type, including the fractal bounding
+	// Adding the bands of a split octave range gives the fractal noise set, up to float rounding
+	// Non fractal noise types only have octave 0
+	virtual void FillFractalBandSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octaveStart, int octaveEnd, float scaleModifier = 1.0f) = 0;
 
-protected:
-	int m_seed = 1337;
-	float m_frequency = 0.01f;
-	NoiseType m_noiseType = SimplexFractal;
+	// Fills a single fractal octave of the current noise type before its amplitude and the fractal bounding
+	// Octaves are the noise for FBM, 2|noise| - 1 for Billow and 1 - |noise| for RigidMulti, the noise for the multiplicative types
+	// Non fractal noise types only have octave 0, see FastNoiseIncrementalSet
+	virtual void FillFractalOctaveSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier = 1.0f) = 0;
+	virtual void FillFractalOctaveSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier = 1.0f) const = 0;
 
-	float m_xScale = 1.0f;
-	float m_yScale = 1.0f;
-	float m_zScale = 1.0f;
+	// Fills mip levels 0 to levelCount - 1 of a region in one call
+	// Level L is the region (xStart >> L, yStart >> L, zStart >> L, GetPyramidLevelSize(xSize, L), ...) at scaleModifier * 2^L
+	// Fractal octaves above the Nyquist limit of each level are skipped, see GetNyquistOctaves()
+	// When the region start is a multiple of 2^L, level L reuses the low octave sums of level 0
+	// noiseSets[L] must hold the level's size, noiseSets[0] is used as scratch space
+	void FillNoiseSetPyramid(float** noiseSets, int levelCount, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 
-	int m_octaves = 3;
-	float m_lacunarity = 2.0f;
-	float m_gain = 0.5f;
-	FractalType m_fractalType = FBM;	
-	float m_fractalBounding;	
+	// Size of a region axis at a pyramid level
+	static int GetPyramidLevelSize(int size, int level) { return ((size - 1) >> level) + 1; }
 
-	CellularDistanceFunction m_cellularDistanceFunction = Euclidean;
-	CellularReturnType m_cellularReturnType = Distance;
-	NoiseType m_cellularNoiseLookupType = Simplex;
-	float m_cellularNoiseLookupFrequency = 0.2f;
-	int m_cellularDistanceIndex0 = 0;
-	int m_cellularDistanceIndex1 = 1;
-	float m_cellularJitter = 0.45f;
-
-	PerturbType m_perturbType = None;
-	float m_perturbAmp = 1.0f;
-	float m_perturbFrequency = 0.5f;
+	virtual ~FastNoiseSIMD() { }
 
-	int m_perturbOctaves = 3;
-	float m_perturbLacunarity = 2.0f;
-	float m_perturbGain = 0.5f;
-	float m_perturbFractalBounding;
-	float m_perturbNormaliseLength = 1.0f;
+protected:
+	int m_simdLevel = 0;
+	static std::atomic<int> s_currentSIMDLevel;
 
-	static int s_currentSIMDLevel;
-	static float CalculateFractalBounding(int octaves, float gain);
+#ifdef FN_ENABLE_STATS
+	FastNoiseStats m_stats;
+	static std::atomic<uint64_t> s_allocations;
+#endif
 };
 
 struct FastNoiseVectorSet
@@ -319,12 +593,25 @@ public:
 	float* ySet = nullptr;
 	float* zSet = nullptr;
 
-	// Only used for sampled vector sets
+	// Only used for sampled vector sets, implicit sets are filled without sampling
 	int sampleScale = 0;
 	int sampleSizeX = -1;
 	int sampleSizeY = -1;
 	int sampleSizeZ = -1;
 
+	// Stored: positions are read from xSet/ySet/zSet
+	// Affine: position = transform * (ix, iy, iz, 1)
+	// Sphere: position = normalise(transform * (ix, iy, iz, 1)) * radius
+	enum Kind { Stored, Affine, Sphere };
+	Kind kind = Stored;
+
+	// Only used for implicit vector sets
+	int gridSizeX = 0;
+	int gridSizeY = 0;
+	int gridSizeZ = 0;
+	float transform[12] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 };
+	float radius = 1.0f;
+
 	FastNoiseVectorSet() {}
 
 	FastNoiseVectorSet(int _size) { SetSize(_size); }
@@ -334,6 +621,8 @@ public:
 	void Free();
 
 	void SetSize(int _size);
+
+	void SetImplicit(Kind _kind, int xSize, int ySize, int zSize, const float* _transform, float _radius = 1.0f);
 };
 
 #define FN_CELLULAR_INDEX_MAX 3
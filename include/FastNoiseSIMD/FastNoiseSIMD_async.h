@@ -0,0 +1,157 @@
+// FastNoiseSIMD_async.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+#ifndef FASTNOISE_SIMD_ASYNC_H
+#define FASTNOISE_SIMD_ASYNC_H
+
+#include "FastNoiseSIMD.h"
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Returned by FastNoiseFillPool::Submit()
+struct FastNoiseFillJob
+{
+	uint64_t id = 0;
+
+	// true once the set is filled, false if the job was cancelled before it started
+	std::shared_future<bool> done;
+};
+
+// Worker threads that fill sets in the background, the highest priority queued job runs first
+// Jobs of the same priority run in submission order, a job that has not started can be cancelled
+// On Linux the workers can be pinned to NUMA nodes, jobs bound to a node only run on its workers
+class FastNoiseFillPool
+{
+public:
+	// Called on the worker thread after the fill, or on the cancelling thread with false, before the future is ready
+	typedef std::function<void(bool filled)> Callback;
+
+	// threadCount 0 uses one thread per hardware thread
+	// pinToNodes: Workers are spread evenly over the NUMA nodes and pinned to the CPUs of their node, Linux only
+	// With fewer workers than nodes only the first threadCount nodes are used
+	explicit FastNoiseFillPool(int threadCount = 0, bool pinToNodes = false);
+
+	// Pins to the given CPUs of each node in place of the detected NUMA nodes, Linux only
+	FastNoiseFillPool(int threadCount, const std::vector<std::vector<int>>& nodeCpus);
+
+	// Cancels every queued job and waits for the running ones
+	~FastNoiseFillPool();
+
+	FastNoiseFillPool(const FastNoiseFillPool&) = delete;
+	FastNoiseFillPool& operator=(const FastNoiseFillPool&) = delete;
+
+	// Queues a fill of noiseSet with the config, which is copied
+	// noise and noiseSet must stay valid until the job is done or cancelled
+	FastNoiseFillJob Submit(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize,
+		float scaleModifier = 1.0f, int priority = 0, Callback callback = nullptr);
+
+	// Uses the current settings of noise
+	FastNoiseFillJob Submit(const FastNoiseSIMD* noise, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize,
+		float scaleModifier = 1.0f, int priority = 0, Callback callback = nullptr)
+	{
+		return Submit(noise, noise->GetConfig(), noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier, priority, callback);
+	}
+
+	// Fills a region with every worker and blocks until it is done, the output is identical to FillNoiseSet()
+	// Each worker fills a contiguous slab of x, so untouched pages of noiseSet are first touched on the node that fills them
+	// With fewer x slabs than workers each fills a band of y instead, through its own set that is then copied in place
+	// Slabs and bands are given to the nodes in order, node 0 fills the start of the set
+	// Must not be called from a callback of this pool
+	void FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize,
+		float scaleModifier = 1.0f, int priority = 0);
+
+	// Allocates a zeroed set with GetEmptySet() whose pages are first touched by a worker of node
+	// Pages that were touched before, as from a reused small allocation, keep their node
+	// Free with FastNoiseSIMD::FreeNoiseSet()
+	float* GetEmptySet(int size, int node);
+
+	// Returns false if the job already started or is unknown
+	bool Cancel(uint64_t id);
+
+	// Jobs queued and not yet started
+	size_t GetQueuedCount() const;
+
+	int GetThreadCount() const { return int(m_threads.size()); }
+
+	// Jobs each worker has taken since the pool was created
+	std::vector<uint64_t> GetJobCounts() const;
+
+	// NUMA nodes the workers are pinned to, each has at least one worker, 1 when not pinned
+	int GetNodeCount() const { return int(m_queues.size()) - 1; }
+
+private:
+	struct Job
+	{
+		std::function<void()> work;
+		std::promise<bool> promise;
+		Callback callback;
+	};
+
+	// Priority and id
+	typedef std::pair<int, uint64_t> QueueKey;
+
+	// Descending priority, then ascending id
+	struct QueueOrder
+	{
+		bool operator()(const QueueKey& a, const QueueKey& b) const
+		{
+			return a.first != b.first ? a.first > b.first : a.second < b.second;
+		}
+	};
+
+	typedef std::map<QueueKey, Job, QueueOrder> Queue;
+
+	struct QueuedJob
+	{
+		int priority;
+		int node;
+	};
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+
+	// m_queues[0] holds jobs for any worker, m_queues[node + 1] jobs bound to a node
+	std::vector<Queue> m_queues;
+	std::unordered_map<uint64_t, QueuedJob> m_queuedJobs;
+	uint64_t m_nextId = 1;
+	bool m_stopping = false;
+
+	std::vector<std::thread> m_threads;
+	std::vector<uint64_t> m_jobCounts;
+
+	FastNoiseFillJob SubmitWork(std::function<void()> work, int priority, int node, Callback callback);
+	void WorkerLoop(int worker, int node);
+};
+
+#endif
@@ -0,0 +1,123 @@
+// FastNoiseSIMD_cache.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#ifndef FASTNOISE_SIMD_CACHE_H
+#define FASTNOISE_SIMD_CACHE_H
+
+#include "FastNoiseSIMD.h"
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+struct FastNoiseSetCacheStats
+{
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t evictions = 0;
+	uint64_t entries = 0;
+	uint64_t bytes = 0;		// Noise data held by the cache, excluding bookkeeping
+};
+
+// Bounded LRU cache in front of FillNoiseSet(), shared by any number of threads
+// Sets are keyed by the config hash, SIMD level of the noise, region and scale modifier, see FastNoiseConfig::GetHash()
+// Keys are split over shards that each have their own lock and LRU list, a hit only copies the set outside the lock
+class FastNoiseSetCache
+{
+public:
+	// memoryBudget: Bytes of noise data kept over all shards, sets larger than a shard's share are not cached
+	explicit FastNoiseSetCache(size_t memoryBudget, int shardCount = 16);
+
+	// Fills from the cache, or fills with noise and the config on a miss
+	// Returns true on a hit, noise is only used on a miss
+	// configHash: config.GetHash(), hashed once by the caller for every set filled with the config
+	// The hash is not checked against config, a stale hash gets the sets of the config it was taken from
+	bool FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, uint64_t configHash, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
+
+	// Hashes the config on every call
+	bool FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f)
+	{
+		return FillNoiseSet(noise, config, config.GetHash(), noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+	}
+
+	// Uses the settings of noise
+	bool FillNoiseSet(const FastNoiseSIMD* noise, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f)
+	{
+		return FillNoiseSet(noise, noise->GetConfig(), noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+	}
+
+	// Removes every set, the hit/miss/eviction counters are kept
+	void Clear();
+
+	FastNoiseSetCacheStats GetStats() const;
+
+private:
+	struct Key
+	{
+		uint64_t configHash;
+		int simdLevel;
+		int xStart, yStart, zStart;
+		int xSize, ySize, zSize;
+		float scaleModifier;
+
+		bool operator==(const Key& other) const;
+	};
+
+	// FNV-1a of every key field, the high bits pick the shard
+	static uint64_t HashKey(const Key& key);
+
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const { return size_t(HashKey(key)); }
+	};
+
+	typedef std::shared_ptr<const std::vector<float>> SetData;
+	typedef std::list<std::pair<Key, SetData>> LruList;
+
+	// Most recently used set first
+	struct Shard
+	{
+		std::mutex mutex;
+		LruList lru;
+		std::unordered_map<Key, LruList::iterator, KeyHash> map;
+		size_t bytes = 0;
+	};
+
+	std::vector<std::unique_ptr<Shard>> m_shards;
+	size_t m_shardBudget;
+
+	std::atomic<uint64_t> m_hits;
+	std::atomic<uint64_t> m_misses;
+	std::atomic<uint64_t> m_evictions;
+
+	Shard& GetShard(uint64_t keyHash) { return *m_shards[size_t(keyHash >> 32) % m_shards.size()]; }
+};
+
+#endif
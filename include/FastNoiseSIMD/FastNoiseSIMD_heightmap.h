@@ -0,0 +1,76 @@
+// FastNoiseSIMD_heightmap.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+#ifndef FASTNOISE_SIMD_HEIGHTMAP_H
+#define FASTNOISE_SIMD_HEIGHTMAP_H
+
+#include "FastNoiseSIMD.h"
+
+struct FastNoiseKernels;
+
+// Unit vector in octahedral form, two snorm16 values
+struct FastNoisePackedNormal
+{
+	int16_t u;
+	int16_t v;
+};
+
+// Texture products of a 2D height field in one pass: normals, slope and curvature
+// The height field is the x, y plane of the noise at one z, every map is in set order, index x * ySize + y
+// Derivatives are central differences, the one texel apron gives the border texels real neighbours
+class FastNoiseHeightmapBaker
+{
+public:
+	// World height of a noise value of 1
+	float heightScale = 1.0f;
+
+	// World distance between neighbouring texels
+	float texelSize = 1.0f;
+
+	// Fills the heights of a xSize * ySize map with a one texel apron and derives the requested maps, any output may be null
+	// heights: noise * heightScale
+	// normals: unit surface normals with +z up
+	// slopes: length of the height gradient, rise over run
+	// curvatures: Laplacian of the height, positive in valleys
+	// The maps are derived at the SIMD level of noise
+	void Bake(const FastNoiseSIMD* noise, const FastNoiseConfig& config, int xStart, int yStart, int z, int xSize, int ySize, float scaleModifier,
+		float* heights, FastNoisePackedNormal* normals, float* slopes = nullptr, float* curvatures = nullptr) const;
+
+	// Derives the maps from a height set that already has the apron, (xSize + 2) * (ySize + 2) noise values in set order
+	// starting one texel before the map on x and y, derived at the current SIMD level
+	void Derive(const float* apronHeights, int xSize, int ySize,
+		float* heights, FastNoisePackedNormal* normals, float* slopes = nullptr, float* curvatures = nullptr) const;
+
+	static FastNoisePackedNormal EncodeNormal(float x, float y, float z);
+	static void DecodeNormal(FastNoisePackedNormal normal, float* x, float* y, float* z);
+
+private:
+	void Derive(const FastNoiseKernels& kernels, const float* apronHeights, int xSize, int ySize,
+		float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+// FastNoiseSIMD_incremental.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#ifndef FASTNOISE_SIMD_INCREMENTAL_H
+#define FASTNOISE_SIMD_INCREMENTAL_H
+
+#include "FastNoiseSIMD.h"
+
+#include <vector>
+
+// Fractal noise of a fixed region that keeps each octave between fills
+// Changing the gain, the octave amplitudes or anti-aliasing only sums the kept octaves again,
+// adding octaves only evaluates the new ones, octaves removed are kept for when they are added back
+// Any other setting evaluates every octave again
+// FBM, Billow and RigidMulti are split into octaves, other fractal types and noise types fill the whole set each time
+// Each kept octave holds a set of the region's size
+class FastNoiseIncrementalSet
+{
+public:
+	FastNoiseIncrementalSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
+	~FastNoiseIncrementalSet() { Clear(); }
+
+	FastNoiseIncrementalSet(const FastNoiseIncrementalSet&) = delete;
+	FastNoiseIncrementalSet& operator=(const FastNoiseIncrementalSet&) = delete;
+
+	// Fills noiseSet with the region using the config, the same as FillNoiseSet() up to float rounding
+	// Returns the number of octaves evaluated by noise, 0 when every octave was kept
+	int FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet);
+
+	// Uses the settings of noise
+	int FillNoiseSet(const FastNoiseSIMD* noise, float* noiseSet) { return FillNoiseSet(noise, noise->GetConfig(), noiseSet); }
+
+	// Frees every kept octave
+	void Clear();
+
+	int GetKeptOctaveCount() const { return int(m_octaveSets.size()); }
+
+private:
+	int m_xStart, m_yStart, m_zStart;
+	int m_xSize, m_ySize, m_zSize;
+	float m_scaleModifier;
+
+	// Octave i is valid while m_octaveKeys[i] matches the key of octave i in the config
+	std::vector<float*> m_octaveSets;
+	std::vector<uint64_t> m_octaveKeys;
+
+	static uint64_t GetOctaveKey(const FastNoiseConfig& config, uint64_t baseKey, int octave);
+	static uint64_t GetBaseKey(const FastNoiseConfig& config);
+};
+
+#endif
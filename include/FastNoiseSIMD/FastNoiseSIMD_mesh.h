@@ -0,0 +1,78 @@
+// FastNoiseSIMD_mesh.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+#ifndef FASTNOISE_SIMD_MESH_H
+#define FASTNOISE_SIMD_MESH_H
+
+#include "FastNoiseSIMD.h"
+
+#include <vector>
+
+struct FastNoiseKernels;
+
+// Indexed triangle mesh
+struct FastNoiseMesh
+{
+	std::vector<float> positions;	// x, y, z of each vertex in voxels from the chunk start
+	std::vector<float> normals;		// Unit x, y, z of each vertex pointing out of the surface, empty when not requested
+	std::vector<uint32_t> indices;	// 3 per triangle, counter clockwise seen from outside
+
+	size_t GetVertexCount() const { return positions.size() / 3; }
+	size_t GetTriangleCount() const { return indices.size() / 3; }
+	void Clear();
+};
+
+// Surface nets isosurface extraction from density fills
+// One vertex per cell the surface passes through, at the mean of its edge crossings, and one quad per crossed edge
+// Densities above isoLevel are inside the surface
+class FastNoiseMesher
+{
+public:
+	float isoLevel = 0.0f;
+
+	// Cells are meshed in bricks of brickSize^3, bricks whose densities are all inside or all outside are skipped
+	int brickSize = 8;
+
+	// Vertex normals from the density gradient of each cell
+	bool normals = true;
+
+	// Fills the density of a chunk of xSize * ySize * zSize cells with a one voxel apron and extracts its surface into mesh
+	// A chunk meshes the edges starting inside it, chunks next to each other meet without gaps
+	// The cells are classified at the SIMD level of noise
+	void Generate(FastNoiseMesh& mesh, const FastNoiseSIMD* noise, const FastNoiseConfig& config,
+		int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) const;
+
+	// Extracts the surface of a density set that already has the apron
+	// The set is (xSize + 2) * (ySize + 2) * (zSize + 2) values in set order, starting one voxel before the chunk on each axis
+	// The cells are classified at the current SIMD level
+	void Extract(FastNoiseMesh& mesh, const float* density, int xSize, int ySize, int zSize) const;
+
+private:
+	void Extract(const FastNoiseKernels& kernels, FastNoiseMesh& mesh, const float* density, int xSize, int ySize, int zSize) const;
+};
+
+#endif
@@ -0,0 +1,157 @@
+// FastNoiseSIMD_volume.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+#ifndef FASTNOISE_SIMD_VOLUME_H
+#define FASTNOISE_SIMD_VOLUME_H
+
+#include "FastNoiseSIMD.h"
+
+#define FN_VOLUME_VERSION 2
+
+// Block shape of compressed bricks, see the Compressed layout below
+#define FN_VOLUME_BLOCK_LANES 16
+#define FN_VOLUME_BLOCK_ROWS 32
+
+// Layouts other than Compressed are written through POSIX mmap and fail to generate on other platforms
+// Volumes are read through mmap or a Windows file mapping
+#if defined(__unix__) || defined(__APPLE__)
+#define FN_VOLUME_MMAP
+#endif
+
+class FastNoiseFillPool;
+
+// Start of every volume file, followed by the data at offset sizeof(FastNoiseVolumeHeader)
+// Fields are in native byte order, volumes are meant to be mapped on the machine that baked them
+struct FastNoiseVolumeHeader
+{
+	// Float: xSize * ySize * zSize floats in set order
+	// Quantized: The same order as uint16_t, value = quantizeMin + q * (quantizeMax - quantizeMin) / 65535
+	// Bricked: brickSize^3 float bricks in set order of the bricks, each brick in set order
+	// Compressed: Bricks of Bricked, each quantized over its own range, delta coded and bit packed, see below
+	// Bricks past the end of an axis are padded with 0
+	enum Layout { Float, Quantized, Bricked, Compressed };
+
+	char magic[4];		// "FNVL"
+	uint32_t version;
+	uint32_t layout;
+	int32_t xStart, yStart, zStart;
+	int32_t xSize, ySize, zSize;
+	int32_t brickSize;
+	float quantizeMin, quantizeMax;	// Quantized only
+	float scaleModifier;
+	uint32_t configSize;	// Compressed: bytes of FastNoiseConfig::SaveBinary() after the header, 0 otherwise
+	uint64_t configHash;	// FastNoiseConfig::GetHash() of the settings used
+
+	int GetBrickCount(int size) const { return (size + brickSize - 1) / brickSize; }
+	int GetBrickCount() const { return GetBrickCount(xSize) * GetBrickCount(ySize) * GetBrickCount(zSize); }
+
+	// Bytes of data after the header, 0 for Compressed
+	uint64_t GetDataSize() const;
+};
+
+// Compressed volumes store after the header:
+// The binary config padded to 8 bytes, GetBrickCount() + 1 uint64_t file offsets of the bricks, the bricks
+// A brick is its float minimum and quantization step, the step is 0 for a constant brick and nothing follows
+// Otherwise value i of the brick is in lane i % FN_VOLUME_BLOCK_LANES and stored as the zigzag delta of its quantized value
+// to value i - FN_VOLUME_BLOCK_LANES, so each lane decodes on its own and a row of lanes decodes as whole vectors
+// Blocks of FN_VOLUME_BLOCK_ROWS rows follow in brick order, the last block and row may be short
+// The brick continues with a bit width byte per block, padded to 4 bytes, then the uint32_t words of each block
+// Block rows are packed in order into a bit stream per lane, word k of lane l is at k * FN_VOLUME_BLOCK_LANES + l
+// A block of width w and r rows has (r * w + 31) / 32 words per lane, bricks are 4 byte aligned in the file
+
+// Bakes volumes too large for memory straight into a file
+// The volume is filled in slabs of x on a background thread while the previous slab is written to the file
+// Written slabs are flushed to the file, so memory use stays near two slabs whatever the volume size
+class FastNoiseVolumeWriter
+{
+public:
+	FastNoiseVolumeHeader::Layout layout = FastNoiseVolumeHeader::Float;
+
+	// Scratch memory for the two slabs in flight, a slab is at least one x row or one layer of bricks
+	size_t memoryBudget = size_t(64) << 20;
+
+	// Range of Quantized, values outside are clamped
+	float quantizeMin = -1.0f;
+	float quantizeMax = 1.0f;
+
+	// Bits per value of Compressed within each brick's range, 1 to 24
+	int compressedBits = 16;
+
+	int brickSize = 16;
+
+	// Fills each slab with every worker of the pool when set, see FastNoiseFillPool::FillNoiseSet()
+	// Slabs thinner than the worker count are split along y, so small budgets still use every worker
+	FastNoiseFillPool* pool = nullptr;
+
+	// Returns false if the file can't be created, mapped or written, a partial file is left behind
+	// Compressed is written with stdio, the other layouts through a memory mapping
+	bool Generate(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config,
+		int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) const;
+
+private:
+	bool GenerateMapped(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config, FastNoiseVolumeHeader& header) const;
+	bool GenerateCompressed(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config, FastNoiseVolumeHeader& header) const;
+};
+
+// Read only mapping of a volume file, the data is used in place
+class FastNoiseVolumeFile
+{
+public:
+	FastNoiseVolumeFile() = default;
+	~FastNoiseVolumeFile() { Close(); }
+
+	FastNoiseVolumeFile(const FastNoiseVolumeFile&) = delete;
+	FastNoiseVolumeFile& operator=(const FastNoiseVolumeFile&) = delete;
+
+	// Returns false if the file is missing, not a volume or shorter than its header says
+	bool Open(const char* path);
+	void Close();
+
+	bool IsOpen() const { return m_mapping != nullptr; }
+	const FastNoiseVolumeHeader& GetHeader() const { return *static_cast<const FastNoiseVolumeHeader*>(m_mapping); }
+	const void* GetData() const { return static_cast<const uint8_t*>(m_mapping) + sizeof(FastNoiseVolumeHeader); }
+
+	// Settings the volume was baked with, returns false for layouts other than Compressed
+	bool GetConfig(FastNoiseConfig& config) const;
+
+	// Decodes brick (bx, by, bz) of a Bricked or Compressed volume into brickSize^3 floats, any brick can be read on its own
+	// Compressed bricks decode at the level GetSIMDLevel() returns, returns false for other layouts
+	bool DecodeBrick(int bx, int by, int bz, float* brick) const;
+
+	// Value at a position relative to the volume start in any layout
+	// Compressed volumes decode the whole brick, use DecodeBrick() to read many values
+	float GetValue(int x, int y, int z) const;
+
+private:
+	void* m_mapping = nullptr;
+	size_t m_mappingSize = 0;
+	const uint64_t* m_brickOffsets = nullptr;
+
+	bool ValidateCompressed();
+};
+
+#endif
@@ -27,10 +27,17 @@
 //
 
 #include "FastNoiseSIMD/FastNoiseSIMD.h"
+#include "FastNoiseSIMD_kernels.h"
 #include <assert.h>
 #include <stdlib.h>
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 #ifdef FN_COMPILE_NO_SIMD_FALLBACK
 #define SIMD_LEVEL_H FN_NO_SIMD_FALLBACK
@@ -74,7 +81,11 @@
 #include "inttypes.h"
 #endif
 
-int FastNoiseSIMD::s_currentSIMDLevel = -1;
+std::atomic<int> FastNoiseSIMD::s_currentSIMDLevel(-1);
+
+#ifdef FN_ENABLE_STATS
+std::atomic<uint64_t> FastNoiseSIMD::s_allocations(0);
+#endif
 
 #ifdef FN_ARM
 int GetFastestSIMD()
@@ -183,33 +194,40 @@ int GetFastestSIMD()
 
 FastNoiseSIMD* FastNoiseSIMD::NewFastNoiseSIMD(int seed)
 {
-	GetSIMDLevel();
+	return NewFastNoiseSIMDAtLevel(GetSIMDLevel(), seed);
+}
+
+FastNoiseSIMD* FastNoiseSIMD::NewFastNoiseSIMDAtLevel(int level, int seed)
+{
+	// Never above what the CPU supports, detected once
+	static const int fastestLevel = GetFastestSIMD();
+	level = std::min(level, fastestLevel);
 
 #ifdef FN_COMPILE_NEON
 #ifdef FN_COMPILE_NO_SIMD_FALLBACK
-	if (s_currentSIMDLevel >= FN_NEON)
+	if (level >= FN_NEON)
 #endif
 		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)(seed);
 #endif
 
 #ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
+	if (level >= FN_AVX512)
 		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)(seed);
 #endif
 
 #ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
+	if (level >= FN_AVX2)
 		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)(seed);
 #endif
 
 #ifdef FN_COMPILE_SSE41
-	if (s_currentSIMDLevel >= FN_SSE41)
+	if (level >= FN_SSE41)
 		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE41)(seed);
 #endif
 
 #ifdef FN_COMPILE_SSE2
 #ifdef FN_COMPILE_NO_SIMD_FALLBACK
-	if (s_currentSIMDLevel >= FN_SSE2)
+	if (level >= FN_SSE2)
 #endif
 		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)(seed);
 #endif
@@ -219,53 +237,100 @@ FastNoiseSIMD* FastNoiseSIMD::NewFastNoiseSIMD(int seed)
 #endif
 }
 
+// Same level choice as NewFastNoiseSIMDAtLevel()
+static const FastNoiseKernels* FindKernels(int level)
+{
+	static const int fastestLevel = GetFastestSIMD();
+	level = std::min(level, fastestLevel);
+
+#ifdef FN_COMPILE_NEON
+#ifdef FN_COMPILE_NO_SIMD_FALLBACK
+	if (level >= FN_NEON)
+#endif
+		return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_NEON);
+#endif
+
+#ifdef FN_COMPILE_AVX512
+	if (level >= FN_AVX512)
+		return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_AVX512);
+#endif
+
+#ifdef FN_COMPILE_AVX2
+	if (level >= FN_AVX2)
+		return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_AVX2);
+#endif
+
+#ifdef FN_COMPILE_SSE41
+	if (level >= FN_SSE41)
+		return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_SSE41);
+#endif
+
+#ifdef FN_COMPILE_SSE2
+#ifdef FN_COMPILE_NO_SIMD_FALLBACK
+	if (level >= FN_SSE2)
+#endif
+		return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_SSE2);
+#endif
+
+#ifdef FN_COMPILE_NO_SIMD_FALLBACK
+	return &FastNoiseSIMD_internal::FASTNOISE_SIMD_KERNELS(FN_NO_SIMD_FALLBACK);
+#endif
+}
+
+const FastNoiseKernels& FastNoiseSIMD_internal::GetKernels(int level)
+{
+	// Resolved for every level on first use, later lookups only index
+	static const FastNoiseKernels* const s_kernels[] =
+	{
+		FindKernels(FN_NO_SIMD_FALLBACK), FindKernels(FN_SSE2), FindKernels(FN_SSE41),
+		FindKernels(FN_AVX2), FindKernels(FN_AVX512), FindKernels(FN_NEON),
+	};
+
+	level = std::max(std::min(level, FN_NEON), FN_NO_SIMD_FALLBACK);
+	return *s_kernels[level];
+}
+
 int FastNoiseSIMD::GetSIMDLevel()
 {
-	if (s_currentSIMDLevel < 0)
-		s_currentSIMDLevel = GetFastestSIMD();
+	// Racing first calls detect the same level, a level set meanwhile by SetSIMDLevel() is kept
+	int level = s_currentSIMDLevel.load();
+	if (level < 0)
+	{
+		int fastest = GetFastestSIMD();
+		if (s_currentSIMDLevel.compare_exchange_strong(level, fastest))
+			level = fastest;
+	}
 
-	return s_currentSIMDLevel;
+	return level;
 }
 
 void FastNoiseSIMD::FreeNoiseSet(float* floatArray)
 {
 #ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-	if (s_currentSIMDLevel > FN_NO_SIMD_FALLBACK)
 #ifdef _WIN32
-		_aligned_free(floatArray);
+	_aligned_free(floatArray);
 #else
-		free(floatArray);
+	free(floatArray);
 #endif
-	else
+#else
+	delete[] floatArray;
 #endif
-		delete[] floatArray;
 }
 
+// Sets are sized and aligned for the widest compiled level, so they can be shared between instances of any level
 int FastNoiseSIMD::AlignedSize(int size)
 {
 #ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-#ifdef FN_COMPILE_NEON
-	if (s_currentSIMDLevel >= FN_NEON)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)::AlignedSize(size);
-#endif
-
-#ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)::AlignedSize(size);
-#endif
-
-#ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)::AlignedSize(size);
-#endif
-
-#ifdef FN_COMPILE_SSE2
-	if (s_currentSIMDLevel >= FN_SSE2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)::AlignedSize(size);
+#if defined(FN_COMPILE_AVX512)
+	return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)::AlignedSize(size);
+#elif defined(FN_COMPILE_AVX2)
+	return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)::AlignedSize(size);
+#elif defined(FN_COMPILE_NEON)
+	return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)::AlignedSize(size);
+#elif defined(FN_COMPILE_SSE41)
+	return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE41)::AlignedSize(size);
+#elif defined(FN_COMPILE_SSE2)
+	return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)::AlignedSize(size);
 #endif
 #endif
 	return size;
@@ -273,30 +338,26 @@ int FastNoiseSIMD::AlignedSize(int size)
 
 float* FastNoiseSIMD::GetEmptySet(int size)
 {
-#ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-#ifdef FN_COMPILE_NEON
-	if (s_currentSIMDLevel >= FN_NEON)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)::GetEmptySet(size);
-#endif
-
-#ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)::GetEmptySet(size);
+#ifdef FN_ENABLE_STATS
+	s_allocations++;
 #endif
+	size = AlignedSize(size);
 
-#ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)::GetEmptySet(size);
-#endif
+#ifdef FN_ALIGNED_SETS
+	// One vector of the widest level
+	std::size_t alignment = std::max(sizeof(float) * AlignedSize(1), sizeof(void*));
+	float* noiseSet;
 
-#ifdef FN_COMPILE_SSE2
-	if (s_currentSIMDLevel >= FN_SSE2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)::GetEmptySet(size);
-#endif
+#ifdef _WIN32
+	noiseSet = static_cast<float*>(_aligned_malloc(size * sizeof(float), alignment));
+#else
+	if (posix_memalign(reinterpret_cast<void**>(&noiseSet), alignment, size * sizeof(float)) != 0)
+		noiseSet = nullptr;
 #endif
+	return noiseSet;
+#else
 	return new float[size];
+#endif
 }
 
 FastNoiseVectorSet* FastNoiseSIMD::GetVectorSet(int xSize, int ySize, int zSize)
@@ -391,6 +452,35 @@ void FastNoiseSIMD::FillSamplingVectorSet(FastNoiseVectorSet* vectorSet, int sam
 	}
 }
 
+FastNoiseVectorSet* FastNoiseSIMD::GetGridVectorSet(int xSize, int ySize, int zSize, const float* transform)
+{
+	FastNoiseVectorSet* vectorSet = new FastNoiseVectorSet();
+	FillGridVectorSet(vectorSet, xSize, ySize, zSize, transform);
+	return vectorSet;
+}
+
+void FastNoiseSIMD::FillGridVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int ySize, int zSize, const float* transform)
+{
+	assert(vectorSet);
+
+	vectorSet->SetImplicit(FastNoiseVectorSet::Affine, xSize, ySize, zSize, transform);
+}
+
+FastNoiseVectorSet* FastNoiseSIMD::GetSphereVectorSet(int xSize, int ySize, int zSize, const float* transform, float radius)
+{
+	FastNoiseVectorSet* vectorSet = new FastNoiseVectorSet();
+	FillSphereVectorSet(vectorSet, xSize, ySize, zSize, transform, radius);
+	return vectorSet;
+}
+
+void FastNoiseSIMD::FillSphereVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int ySize, int zSize, const float* transform, float radius)
+{
+	assert(vectorSet);
+	assert(transform);
+
+	vectorSet->SetImplicit(FastNoiseVectorSet::Sphere, xSize, ySize, zSize, transform, radius);
+}
+
 float* FastNoiseSIMD::GetNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
 {
 	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
@@ -490,6 +580,35 @@ void FastNoiseSIMD::FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet,
 	}
 }
 
+void FastNoiseSIMD::FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier, FastNoiseReduction& reduction)
+{
+	FillNoiseSet(GetConfig(), noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier, nullptr, &reduction);
+}
+
+void FastNoiseSIMD::FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, FastNoiseReduction& reduction, float xOffset, float yOffset, float zOffset)
+{
+	FillNoiseSet(GetConfig(), noiseSet, vectorSet, xOffset, yOffset, zOffset, nullptr, &reduction);
+}
+
+void FastNoiseSIMD::FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier, const FastNoiseOutputTransform& transform, FastNoiseReduction* reduction)
+{
+	FillNoiseSet(GetConfig(), noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier, &transform, reduction);
+}
+
+void FastNoiseSIMD::FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, const FastNoiseOutputTransform& transform, FastNoiseReduction* reduction, float xOffset, float yOffset, float zOffset)
+{
+	FillNoiseSet(GetConfig(), noiseSet, vectorSet, xOffset, yOffset, zOffset, &transform, reduction);
+}
+
+float* FastNoiseSIMD::GetNoiseSet(const FastNoiseConfig& config, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier) const
+{
+	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
+
+	FillNoiseSet(config, noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+	return noiseSet;
+}
+
 float* FastNoiseSIMD::GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale)
 {
 	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
@@ -528,7 +647,14 @@ GET_SET(Cellular)
 GET_SET(Cubic)
 GET_SET(CubicFractal)
 
-float FastNoiseSIMD::CalculateFractalBounding(int octaves, float gain)
+FastNoiseConfig::FastNoiseConfig(int seed)
+{
+	m_seed = seed;
+	m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain);
+	m_perturbFractalBounding = CalculateFractalBounding(m_perturbOctaves, m_perturbGain);
+}
+
+float FastNoiseConfig::CalculateFractalBounding(int octaves, float gain)
 {
 	float amp = gain;
 	float ampFractal = 1.0f;
@@ -540,7 +666,362 @@ float FastNoiseSIMD::CalculateFractalBounding(int octaves, float gain)
 	return 1.0f / ampFractal;
 }
 
-void FastNoiseSIMD::SetCellularDistance2Indicies(int cellularDistanceIndex0, int cellularDistanceIndex1)
+void FastNoiseStats::Add(const FastNoiseStats& other)
+{
+	fills += other.fills;
+	points += other.points;
+	alignedVectors += other.alignedVectors;
+	resetVectors += other.resetVectors;
+	vectorSetVectors += other.vectorSetVectors;
+	tailStores += other.tailStores;
+	octaves += other.octaves;
+	allocations += other.allocations;
+	positionCycles += other.positionCycles;
+	noiseCycles += other.noiseCycles;
+	storeCycles += other.storeCycles;
+}
+
+void FastNoiseReduction::Reset()
+{
+	min = std::numeric_limits<float>::infinity();
+	max = -std::numeric_limits<float>::infinity();
+	sum = 0.0;
+	count = 0;
+	std::fill(histogram, histogram + FN_MAX_HISTOGRAM_BINS, uint64_t(0));
+}
+
+void FastNoiseOutputTransform::SetSpline(int count, const float* x, const float* y, bool cubic)
+{
+	assert(count >= 2 && count <= FN_MAX_SPLINE_POINTS);
+	assert(x && y);
+
+	float slopes[FN_MAX_SPLINE_POINTS - 1];
+	for (int i = 0; i < count - 1; i++)
+	{
+		assert(x[i + 1] > x[i]);
+		slopes[i] = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+	}
+
+	// Fritsch-Butland tangents, the harmonic mean of the neighbouring slopes or 0 at a local extreme
+	float tangents[FN_MAX_SPLINE_POINTS];
+	tangents[0] = slopes[0];
+	tangents[count - 1] = slopes[count - 2];
+	for (int i = 1; i < count - 1; i++)
+		tangents[i] = slopes[i - 1] * slopes[i] > 0.0f ? 2.0f * slopes[i - 1] * slopes[i] / (slopes[i - 1] + slopes[i]) : 0.0f;
+
+	for (int i = 0; i < count - 1; i++)
+	{
+		float width = x[i + 1] - x[i];
+		float* c = splineCoefficients[i];
+
+		splineX[i] = x[i];
+		splineInvWidth[i] = 1.0f / width;
+		c[0] = y[i];
+
+		if (cubic)
+		{
+			// Hermite basis in t = 0..1 over the segment
+			float m0 = tangents[i] * width;
+			float m1 = tangents[i + 1] * width;
+			c[1] = m0;
+			c[2] = 3.0f * (y[i + 1] - y[i]) - 2.0f * m0 - m1;
+			c[3] = 2.0f * (y[i] - y[i + 1]) + m0 + m1;
+		}
+		else
+		{
+			c[1] = y[i + 1] - y[i];
+			c[2] = 0.0f;
+			c[3] = 0.0f;
+		}
+	}
+	splineX[count - 1] = x[count - 1];
+	splineSegments = count - 1;
+}
+
+float FastNoiseOutputTransform::Apply(float value) const
+{
+	value = value * scale + bias;
+
+	if (abs)
+		value = std::fabs(value);
+
+	if (exponent != 1.0f)
+		value = std::copysign(std::pow(std::fabs(value), exponent), value);
+
+	if (terraceSteps > 0.0f)
+	{
+		float stepped = value * terraceSteps;
+		float level = std::floor(stepped);
+		float invSmoothness = terraceSmoothness > 0.0f ? 1.0f / terraceSmoothness : 0.0f;
+		float ramp = std::min(std::max(stepped - level - (1.0f - terraceSmoothness), 0.0f) * invSmoothness, 1.0f);
+		value = (level + ramp) * (1.0f / terraceSteps);
+	}
+
+	if (splineSegments > 0)
+	{
+		float x = std::min(std::max(value, splineX[0]), splineX[splineSegments]);
+		int segment = 0;
+		while (segment + 1 < splineSegments && x >= splineX[segment + 1])
+			segment++;
+
+		const float* c = splineCoefficients[segment];
+		float t = (x - splineX[segment]) * splineInvWidth[segment];
+		value = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+	}
+
+	if (clamp)
+		value = std::min(std::max(value, clampMin), clampMax);
+
+	return value;
+}
+
+FastNoiseStats FastNoiseSIMD::GetStats() const
+{
+#ifdef FN_ENABLE_STATS
+	FastNoiseStats stats = m_stats;
+	stats.allocations = s_allocations;
+	return stats;
+#else
+	return FastNoiseStats();
+#endif
+}
+
+void FastNoiseSIMD::ResetStats()
+{
+#ifdef FN_ENABLE_STATS
+	m_stats = FastNoiseStats();
+	s_allocations = 0;
+#endif
+}
+
+void FastNoiseConfig::UpdateFractalBounding()
+{
+	if (m_octaveWeightCount == 0)
+	{
+		m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain);
+		return;
+	}
+
+	float ampFractal = 0.0f;
+	for (int i = 0; i < m_octaveWeightCount; i++)
+		ampFractal += std::fabs(m_octaveAmplitudes[i]);
+
+	m_fractalBounding = ampFractal > 0.0f ? 1.0f / ampFractal : 1.0f;
+}
+
+void FastNoiseConfig::SetFractalOctaves(int octaves)
+{
+	assert(octaves >= 1 && octaves <= FN_MAX_OCTAVES);
+
+	m_octaves = octaves;
+	UpdateFractalBounding();
+}
+
+void FastNoiseConfig::SetPerturbFractalOctaves(int perturbOctaves)
+{
+	assert(perturbOctaves >= 1 && perturbOctaves <= FN_MAX_OCTAVES);
+
+	m_perturbOctaves = perturbOctaves;
+	m_perturbFractalBounding = CalculateFractalBounding(m_perturbOctaves, m_perturbGain);
+}
+
+void FastNoiseConfig::SetFractalOctaveWeights(int count, const float* amplitudes, const float* frequencies, const int* seedOffsets)
+{
+	assert(count > 0 && count <= FN_MAX_OCTAVE_WEIGHTS);
+	assert(amplitudes && frequencies && seedOffsets);
+
+	for (int i = 0; i < count; i++)
+	{
+		assert(frequencies[i] != 0.0f);
+		m_octaveAmplitudes[i] = amplitudes[i];
+		m_octaveFrequencies[i] = frequencies[i];
+		m_octaveSeedOffsets[i] = seedOffsets[i];
+	}
+	m_octaveWeightCount = count;
+	UpdateFractalBounding();
+}
+
+// Every 2^level sample of a level 0 set
+static void CopyPyramidLevel(float* dest, const float* source, int level, int xSize, int ySize, int zSize)
+{
+	int xLevelSize = FastNoiseSIMD::GetPyramidLevelSize(xSize, level);
+	int yLevelSize = FastNoiseSIMD::GetPyramidLevelSize(ySize, level);
+	int zLevelSize = FastNoiseSIMD::GetPyramidLevelSize(zSize, level);
+	int index = 0;
+
+	for (int ix = 0; ix < xLevelSize; ix++)
+	{
+		for (int iy = 0; iy < yLevelSize; iy++)
+		{
+			const float* row = source + ((ix << level) * ySize + (iy << level)) * zSize;
+
+			for (int iz = 0; iz < zLevelSize; iz++)
+				dest[index++] = row[iz << level];
+		}
+	}
+}
+
+// Fractional octave count, octave o has a spacing of spacing * lacunarity^o noise units which is kept at or below half a unit
+float FastNoiseConfig::CalculateNyquistOctaves(float scaleModifier) const
+{
+	float spacing = scaleModifier * m_frequency * std::max(std::fabs(m_xScale), std::max(std::fabs(m_yScale), std::fabs(m_zScale)));
+
+	// Weighted octaves have no series to solve, count the leading octaves under the limit
+	if (m_octaveWeightCount > 0)
+	{
+		int octaves = 0;
+		while (octaves < m_octaveWeightCount && spacing * std::fabs(m_octaveFrequencies[octaves]) <= 0.5f)
+			octaves++;
+		return float(octaves);
+	}
+
+	if (m_lacunarity <= 1.0f || spacing <= 0.0f)
+		return float(m_octaves);
+
+	return std::log(0.5f / spacing) / std::log(m_lacunarity) + 1.0f;
+}
+
+int FastNoiseConfig::GetNyquistOctaves(float scaleModifier) const
+{
+	int octaves = int(std::floor(CalculateNyquistOctaves(scaleModifier)));
+
+	return std::min(std::max(octaves, 1), GetFractalOctaveCount());
+}
+
+void FastNoiseSIMD::FillNoiseSetPyramid(float** noiseSets, int levelCount, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	assert(noiseSets);
+	assert(levelCount > 0);
+
+	bool fractal = false;
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+	case PerlinFractal:
+	case SimplexFractal:
+	case OpenSimplex2Fractal:
+	case CubicFractal:
+		fractal = true;
+		break;
+	default:
+		break;
+	}
+
+	// Levels whose samples are a strided subset of level 0
+	// The multiplicative fractal types can't be split into bands cheaply, each level is evaluated on its own
+	int sharedLevels = 1;
+	bool additive = m_fractalType == FBM || m_fractalType == Billow || m_fractalType == RigidMulti;
+
+	while (sharedLevels < levelCount && (additive || !fractal))
+	{
+		int mask = (1 << sharedLevels) - 1;
+		if ((xStart & mask) || (yStart & mask) || (zStart & mask))
+			break;
+		sharedLevels++;
+	}
+
+	for (int level = sharedLevels; level < levelCount; level++)
+	{
+		float levelScale = scaleModifier * float(1 << level);
+		int xLevelSize = GetPyramidLevelSize(xSize, level);
+		int yLevelSize = GetPyramidLevelSize(ySize, level);
+		int zLevelSize = GetPyramidLevelSize(zSize, level);
+
+		if (fractal)
+			FillFractalBandSet(noiseSets[level], xStart >> level, yStart >> level, zStart >> level, xLevelSize, yLevelSize, zLevelSize, 0, GetNyquistOctaves(levelScale), levelScale);
+		else
+			FillNoiseSet(noiseSets[level], xStart >> level, yStart >> level, zStart >> level, xLevelSize, yLevelSize, zLevelSize, levelScale);
+	}
+
+	if (!fractal)
+	{
+		FillNoiseSet(noiseSets[0], xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+		for (int level = 1; level < sharedLevels; level++)
+			CopyPyramidLevel(noiseSets[level], noiseSets[0], level, xSize, ySize, zSize);
+		return;
+	}
+
+	float* band = nullptr;
+	int octaveStart = 0;
+
+	// Coarsest level first, each finer level adds the octaves below its own Nyquist limit
+	for (int level = sharedLevels - 1; level >= 0; level--)
+	{
+		int octaveEnd = GetNyquistOctaves(scaleModifier * float(1 << level));
+
+		if (octaveStart == 0)
+		{
+			FillFractalBandSet(noiseSets[0], xStart, yStart, zStart, xSize, ySize, zSize, 0, octaveEnd, scaleModifier);
+			octaveStart = octaveEnd;
+		}
+		else if (octaveEnd > octaveStart)
+		{
+			if (!band)
+				band = GetEmptySet(xSize, ySize, zSize);
+
+			FillFractalBandSet(band, xStart, yStart, zStart, xSize, ySize, zSize, octaveStart, octaveEnd, scaleModifier);
+
+			for (int i = 0; i < xSize * ySize * zSize; i++)
+				noiseSets[0][i] += band[i];
+
+			octaveStart = octaveEnd;
+		}
+
+		if (level > 0)
+			CopyPyramidLevel(noiseSets[level], noiseSets[0], level, xSize, ySize, zSize);
+	}
+
+	if (band)
+		FreeNoiseSet(band);
+}
+
+float* FastNoiseSIMD::GetCubeSphereSet(int face, float uMin, float vMin, float uMax, float vMax, int uSize, int vSize, float radius)
+{
+	float* noiseSet = GetEmptySet(uSize * vSize);
+
+	FillCubeSphereSet(noiseSet, face, uMin, vMin, uMax, vMax, uSize, vSize, radius);
+
+	return noiseSet;
+}
+
+void FastNoiseSIMD::FillCubeSphereSet(float* noiseSet, int face, float uMin, float vMin, float uMax, float vMax, int uSize, int vSize, float radius)
+{
+	assert(noiseSet);
+	assert(face >= 0 && face < 6);
+
+	// Normal, u axis, v axis for each face, u x v = normal
+	static const float faceAxes[6][9] = {
+		{  1, 0, 0,   0, 0,-1,   0, 1, 0 },
+		{ -1, 0, 0,   0, 0, 1,   0, 1, 0 },
+		{  0, 1, 0,   1, 0, 0,   0, 0,-1 },
+		{  0,-1, 0,   1, 0, 0,   0, 0, 1 },
+		{  0, 0, 1,   1, 0, 0,   0, 1, 0 },
+		{  0, 0,-1,  -1, 0, 0,   0, 1, 0 },
+	};
+	const float* n = faceAxes[face];
+	const float* u = n + 3;
+	const float* v = n + 6;
+
+	float uStep = uSize > 1 ? (uMax - uMin) / float(uSize - 1) : 0.0f;
+	float vStep = vSize > 1 ? (vMax - vMin) / float(vSize - 1) : 0.0f;
+
+	// Grid (1, vSize, uSize) keeps u as the fastest varying index
+	float transform[12];
+	for (int i = 0; i < 3; i++)
+	{
+		transform[i * 4 + 0] = 0.0f;
+		transform[i * 4 + 1] = v[i] * vStep;
+		transform[i * 4 + 2] = u[i] * uStep;
+		transform[i * 4 + 3] = n[i] + u[i] * uMin + v[i] * vMin;
+	}
+
+	FastNoiseVectorSet vectorSet;
+	FillSphereVectorSet(&vectorSet, 1, vSize, uSize, transform, radius);
+	FillNoiseSet(noiseSet, &vectorSet);
+}
+
+void FastNoiseConfig::SetCellularDistance2Indicies(int cellularDistanceIndex0, int cellularDistanceIndex1)
 {
 	m_cellularDistanceIndex0 = std::min(cellularDistanceIndex0, cellularDistanceIndex1);
 	m_cellularDistanceIndex1 = std::max(cellularDistanceIndex0, cellularDistanceIndex1);
@@ -549,9 +1030,437 @@ void FastNoiseSIMD::SetCellularDistance2Indicies(int cellularDistanceIndex0, int
 	m_cellularDistanceIndex1 = std::min(std::max(m_cellularDistanceIndex1, 0), FN_CELLULAR_INDEX_MAX);
 }
 
+void FastNoiseConfig::SetTransform(const float* transform)
+{
+	assert(transform);
+
+	std::memcpy(m_transform, transform, sizeof(m_transform));
+	m_transformEnabled = true;
+}
+
+// Binary and text config layout version, bump when either layout changes
+#define FN_CONFIG_VERSION 1
+
+// Names used by the text form, in enum order
+static const char* const s_noiseTypeNames[] = { "Value", "ValueFractal", "Perlin", "PerlinFractal", "Simplex", "SimplexFractal",
+	"OpenSimplex2", "OpenSimplex2Fractal", "WhiteNoise", "Cellular", "Cubic", "CubicFractal" };
+static const char* const s_fractalTypeNames[] = { "FBM", "Billow", "RigidMulti", "HybridMulti", "HeteroTerrain", "ErodedFBM" };
+static const char* const s_perturbTypeNames[] = { "None", "Gradient", "GradientFractal", "Normalise", "Gradient_Normalise", "GradientFractal_Normalise",
+	"SimplexGradient", "SimplexGradientFractal", "OpenSimplex2Gradient", "OpenSimplex2GradientFractal" };
+static const char* const s_cellularDistanceFunctionNames[] = { "Euclidean", "Manhattan", "Natural" };
+static const char* const s_cellularReturnTypeNames[] = { "CellValue", "Distance", "Distance2", "Distance2Add", "Distance2Sub", "Distance2Mul",
+	"Distance2Div", "NoiseLookup", "Distance2Cave" };
+
+#define FN_ENUM_COUNT(names) int(sizeof(names) / sizeof(names[0]))
+
+static_assert(FN_ENUM_COUNT(s_noiseTypeNames) == FastNoiseConfig::CubicFractal + 1, "Noise type names out of date");
+static_assert(FN_ENUM_COUNT(s_fractalTypeNames) == FastNoiseConfig::ErodedFBM + 1, "Fractal type names out of date");
+static_assert(FN_ENUM_COUNT(s_perturbTypeNames) == FastNoiseConfig::OpenSimplex2GradientFractal + 1, "Perturb type names out of date");
+static_assert(FN_ENUM_COUNT(s_cellularDistanceFunctionNames) == FastNoiseConfig::Natural + 1, "Cellular distance function names out of date");
+static_assert(FN_ENUM_COUNT(s_cellularReturnTypeNames) == FastNoiseConfig::Distance2Cave + 1, "Cellular return type names out of date");
+
+static void WriteUInt32(std::vector<uint8_t>& data, uint32_t value)
+{
+	for (int i = 0; i < 4; i++)
+		data.push_back(uint8_t(value >> (i * 8)));
+}
+
+static void WriteFloat(std::vector<uint8_t>& data, float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	WriteUInt32(data, bits);
+}
+
+namespace
+{
+// Reads the binary form, ok is cleared by a read past the end or a value out of range
+// Index() reads a value from 0 to count - 1, Octaves() one from 1 to FN_MAX_OCTAVES
+struct ConfigReader
+{
+	const uint8_t* data;
+	size_t size;
+	size_t pos;
+	bool ok;
+
+	uint32_t UInt32()
+	{
+		if (size - pos < 4)
+		{
+			ok = false;
+			return 0;
+		}
+
+		uint32_t value = 0;
+		for (int i = 0; i < 4; i++)
+			value |= uint32_t(data[pos + i]) << (i * 8);
+		pos += 4;
+		return value;
+	}
+
+	int Int()
+	{
+		int32_t value;
+		uint32_t bits = UInt32();
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	float Float()
+	{
+		float value;
+		uint32_t bits = UInt32();
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	bool Bool()
+	{
+		uint32_t value = UInt32();
+		ok &= value <= 1;
+		return value != 0;
+	}
+
+	int Index(int count)
+	{
+		int value = Int();
+		ok &= value >= 0 && value < count;
+		return value;
+	}
+
+	int Octaves()
+	{
+		int value = Int();
+		ok &= value >= 1 && value <= FN_MAX_OCTAVES;
+		return value;
+	}
+};
+}
+
+std::vector<uint8_t> FastNoiseConfig::SaveBinary() const
+{
+	std::vector<uint8_t> data = { 'F', 'N', 'C', FN_CONFIG_VERSION };
+
+	WriteUInt32(data, uint32_t(m_seed));
+	WriteFloat(data, m_frequency);
+	WriteUInt32(data, m_noiseType);
+	WriteFloat(data, m_xScale);
+	WriteFloat(data, m_yScale);
+	WriteFloat(data, m_zScale);
+
+	WriteUInt32(data, m_transformEnabled);
+	if (m_transformEnabled)
+	{
+		for (float value : m_transform)
+			WriteFloat(data, value);
+	}
+
+	WriteUInt32(data, uint32_t(m_octaves));
+	WriteFloat(data, m_lacunarity);
+	WriteFloat(data, m_gain);
+	WriteUInt32(data, m_fractalType);
+	WriteUInt32(data, m_fractalRotation);
+	WriteUInt32(data, m_fractalAntiAliasing);
+	WriteFloat(data, m_fractalOffset);
+	WriteFloat(data, m_fractalErosion);
+
+	WriteUInt32(data, uint32_t(m_octaveWeightCount));
+	for (int i = 0; i < m_octaveWeightCount; i++)
+	{
+		WriteFloat(data, m_octaveAmplitudes[i]);
+		WriteFloat(data, m_octaveFrequencies[i]);
+		WriteUInt32(data, uint32_t(m_octaveSeedOffsets[i]));
+	}
+
+	WriteUInt32(data, m_cellularDistanceFunction);
+	WriteUInt32(data, m_cellularReturnType);
+	WriteUInt32(data, m_cellularNoiseLookupType);
+	WriteFloat(data, m_cellularNoiseLookupFrequency);
+	WriteUInt32(data, uint32_t(m_cellularDistanceIndex0));
+	WriteUInt32(data, uint32_t(m_cellularDistanceIndex1));
+	WriteFloat(data, m_cellularJitter);
+
+	WriteUInt32(data, m_perturbType);
+	WriteFloat(data, m_perturbAmp);
+	WriteFloat(data, m_perturbFrequency);
+	WriteUInt32(data, uint32_t(m_perturbOctaves));
+	WriteFloat(data, m_perturbLacunarity);
+	WriteFloat(data, m_perturbGain);
+	WriteFloat(data, m_perturbNormaliseLength);
+
+	return data;
+}
+
+bool FastNoiseConfig::LoadBinary(const uint8_t* data, size_t size)
+{
+	if (!data || size < 4 || data[0] != 'F' || data[1] != 'N' || data[2] != 'C' || data[3] != FN_CONFIG_VERSION)
+		return false;
+
+	ConfigReader reader = { data, size, 4, true };
+	FastNoiseConfig config;
+
+	config.m_seed = reader.Int();
+	config.m_frequency = reader.Float();
+	config.m_noiseType = NoiseType(reader.Index(FN_ENUM_COUNT(s_noiseTypeNames)));
+	config.m_xScale = reader.Float();
+	config.m_yScale = reader.Float();
+	config.m_zScale = reader.Float();
+
+	config.m_transformEnabled = reader.Bool();
+	if (config.m_transformEnabled)
+	{
+		for (float& value : config.m_transform)
+			value = reader.Float();
+	}
+
+	config.m_octaves = reader.Octaves();
+	config.m_lacunarity = reader.Float();
+	config.m_gain = reader.Float();
+	config.m_fractalType = FractalType(reader.Index(FN_ENUM_COUNT(s_fractalTypeNames)));
+	config.m_fractalRotation = reader.Bool();
+	config.m_fractalAntiAliasing = reader.Bool();
+	config.m_fractalOffset = reader.Float();
+	config.m_fractalErosion = reader.Float();
+
+	config.m_octaveWeightCount = reader.Index(FN_MAX_OCTAVE_WEIGHTS + 1);
+	for (int i = 0; reader.ok && i < config.m_octaveWeightCount; i++)
+	{
+		config.m_octaveAmplitudes[i] = reader.Float();
+		config.m_octaveFrequencies[i] = reader.Float();
+		config.m_octaveSeedOffsets[i] = reader.Int();
+		reader.ok &= config.m_octaveFrequencies[i] != 0.0f;
+	}
+
+	config.m_cellularDistanceFunction = CellularDistanceFunction(reader.Index(FN_ENUM_COUNT(s_cellularDistanceFunctionNames)));
+	config.m_cellularReturnType = CellularReturnType(reader.Index(FN_ENUM_COUNT(s_cellularReturnTypeNames)));
+	config.m_cellularNoiseLookupType = NoiseType(reader.Index(FN_ENUM_COUNT(s_noiseTypeNames)));
+	config.m_cellularNoiseLookupFrequency = reader.Float();
+	config.m_cellularDistanceIndex0 = reader.Index(FN_CELLULAR_INDEX_MAX + 1);
+	config.m_cellularDistanceIndex1 = reader.Index(FN_CELLULAR_INDEX_MAX + 1);
+	config.m_cellularJitter = reader.Float();
+
+	config.m_perturbType = PerturbType(reader.Index(FN_ENUM_COUNT(s_perturbTypeNames)));
+	config.m_perturbAmp = reader.Float();
+	config.m_perturbFrequency = reader.Float();
+	config.m_perturbOctaves = reader.Octaves();
+	config.m_perturbLacunarity = reader.Float();
+	config.m_perturbGain = reader.Float();
+	config.m_perturbNormaliseLength = reader.Float();
+
+	if (!reader.ok || reader.pos != size || config.m_cellularDistanceIndex0 > config.m_cellularDistanceIndex1)
+		return false;
+
+	config.UpdateFractalBounding();
+	config.m_perturbFractalBounding = CalculateFractalBounding(config.m_perturbOctaves, config.m_perturbGain);
+
+	*this = config;
+	return true;
+}
+
+std::string FastNoiseConfig::SaveText() const
+{
+	std::ostringstream text;
+	text.imbue(std::locale::classic());
+	text << std::setprecision(9) << std::boolalpha;
+
+	text << "FastNoiseConfig " << FN_CONFIG_VERSION << '\n';
+	text << "Seed " << m_seed << '\n';
+	text << "Frequency " << m_frequency << '\n';
+	text << "NoiseType " << s_noiseTypeNames[m_noiseType] << '\n';
+	text << "AxisScales " << m_xScale << ' ' << m_yScale << ' ' << m_zScale << '\n';
+
+	if (m_transformEnabled)
+	{
+		text << "Transform";
+		for (float value : m_transform)
+			text << ' ' << value;
+		text << '\n';
+	}
+
+	text << "FractalOctaves " << m_octaves << '\n';
+	text << "FractalLacunarity " << m_lacunarity << '\n';
+	text << "FractalGain " << m_gain << '\n';
+	text << "FractalType " << s_fractalTypeNames[m_fractalType] << '\n';
+	text << "FractalRotation " << m_fractalRotation << '\n';
+	text << "FractalAntiAliasing " << m_fractalAntiAliasing << '\n';
+	text << "FractalOffset " << m_fractalOffset << '\n';
+	text << "FractalErosion " << m_fractalErosion << '\n';
+
+	// Count followed by amplitude, frequency and seed offset of each octave
+	if (m_octaveWeightCount > 0)
+	{
+		text << "FractalOctaveWeights " << m_octaveWeightCount;
+		for (int i = 0; i < m_octaveWeightCount; i++)
+			text << ' ' << m_octaveAmplitudes[i] << ' ' << m_octaveFrequencies[i] << ' ' << m_octaveSeedOffsets[i];
+		text << '\n';
+	}
+
+	text << "CellularReturnType " << s_cellularReturnTypeNames[m_cellularReturnType] << '\n';
+	text << "CellularDistanceFunction " << s_cellularDistanceFunctionNames[m_cellularDistanceFunction] << '\n';
+	text << "CellularNoiseLookupType " << s_noiseTypeNames[m_cellularNoiseLookupType] << '\n';
+	text << "CellularNoiseLookupFrequency " << m_cellularNoiseLookupFrequency << '\n';
+	text << "CellularDistance2Indicies " << m_cellularDistanceIndex0 << ' ' << m_cellularDistanceIndex1 << '\n';
+	text << "CellularJitter " << m_cellularJitter << '\n';
+
+	text << "PerturbType " << s_perturbTypeNames[m_perturbType] << '\n';
+	text << "PerturbAmp " << m_perturbAmp << '\n';
+	text << "PerturbFrequency " << m_perturbFrequency << '\n';
+	text << "PerturbFractalOctaves " << m_perturbOctaves << '\n';
+	text << "PerturbFractalLacunarity " << m_perturbLacunarity << '\n';
+	text << "PerturbFractalGain " << m_perturbGain << '\n';
+	text << "PerturbNormaliseLength " << m_perturbNormaliseLength << '\n';
+
+	return text.str();
+}
+
+// Reads an enum by name, -1 if the name is unknown
+static int ReadEnumName(std::istream& line, const char* const* names, int count)
+{
+	std::string name;
+	line >> name;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (name == names[i])
+			return i;
+	}
+	return -1;
+}
+
+bool FastNoiseConfig::LoadText(const std::string& text)
+{
+	std::istringstream lines(text);
+	std::string lineText;
+	FastNoiseConfig config;
+	bool header = false;
+
+	while (std::getline(lines, lineText))
+	{
+		std::istringstream line(lineText);
+		line.imbue(std::locale::classic());
+		line >> std::boolalpha;
+
+		std::string key;
+		if (!(line >> key) || key[0] == '#')
+			continue;
+
+		if (!header)
+		{
+			int version = 0;
+			if (key != "FastNoiseConfig" || !(line >> version) || version != FN_CONFIG_VERSION)
+				return false;
+			header = true;
+			continue;
+		}
+
+		float f0 = 0.0f, f1 = 0.0f, f2 = 0.0f;
+		int i0 = 0, i1 = 0, e = 0;
+		bool b = false;
+
+		if (key == "Seed" && line >> i0)
+			config.SetSeed(i0);
+		else if (key == "Frequency" && line >> f0)
+			config.SetFrequency(f0);
+		else if (key == "NoiseType" && (e = ReadEnumName(line, s_noiseTypeNames, FN_ENUM_COUNT(s_noiseTypeNames))) >= 0)
+			config.SetNoiseType(NoiseType(e));
+		else if (key == "AxisScales" && line >> f0 >> f1 >> f2)
+			config.SetAxisScales(f0, f1, f2);
+		else if (key == "Transform")
+		{
+			float transform[12];
+			for (float& value : transform)
+				line >> value;
+			if (!line)
+				return false;
+			config.SetTransform(transform);
+		}
+		else if (key == "FractalOctaves" && line >> i0 && i0 >= 1 && i0 <= FN_MAX_OCTAVES)
+			config.SetFractalOctaves(i0);
+		else if (key == "FractalLacunarity" && line >> f0)
+			config.SetFractalLacunarity(f0);
+		else if (key == "FractalGain" && line >> f0)
+			config.SetFractalGain(f0);
+		else if (key == "FractalType" && (e = ReadEnumName(line, s_fractalTypeNames, FN_ENUM_COUNT(s_fractalTypeNames))) >= 0)
+			config.SetFractalType(FractalType(e));
+		else if (key == "FractalRotation" && line >> b)
+			config.SetFractalRotation(b);
+		else if (key == "FractalAntiAliasing" && line >> b)
+			config.SetFractalAntiAliasing(b);
+		else if (key == "FractalOffset" && line >> f0)
+			config.SetFractalOffset(f0);
+		else if (key == "FractalErosion" && line >> f0)
+			config.SetFractalErosion(f0);
+		else if (key == "FractalOctaveWeights" && line >> i0 && i0 > 0 && i0 <= FN_MAX_OCTAVE_WEIGHTS)
+		{
+			float amplitudes[FN_MAX_OCTAVE_WEIGHTS];
+			float frequencies[FN_MAX_OCTAVE_WEIGHTS];
+			int seedOffsets[FN_MAX_OCTAVE_WEIGHTS];
+			for (int i = 0; i < i0; i++)
+			{
+				line >> amplitudes[i] >> frequencies[i] >> seedOffsets[i];
+				if (!line || frequencies[i] == 0.0f)
+					return false;
+			}
+			config.SetFractalOctaveWeights(i0, amplitudes, frequencies, seedOffsets);
+		}
+		else if (key == "CellularReturnType" && (e = ReadEnumName(line, s_cellularReturnTypeNames, FN_ENUM_COUNT(s_cellularReturnTypeNames))) >= 0)
+			config.SetCellularReturnType(CellularReturnType(e));
+		else if (key == "CellularDistanceFunction" && (e = ReadEnumName(line, s_cellularDistanceFunctionNames, FN_ENUM_COUNT(s_cellularDistanceFunctionNames))) >= 0)
+			config.SetCellularDistanceFunction(CellularDistanceFunction(e));
+		else if (key == "CellularNoiseLookupType" && (e = ReadEnumName(line, s_noiseTypeNames, FN_ENUM_COUNT(s_noiseTypeNames))) >= 0)
+			config.SetCellularNoiseLookupType(NoiseType(e));
+		else if (key == "CellularNoiseLookupFrequency" && line >> f0)
+			config.SetCellularNoiseLookupFrequency(f0);
+		else if (key == "CellularDistance2Indicies" && line >> i0 >> i1)
+			config.SetCellularDistance2Indicies(i0, i1);
+		else if (key == "CellularJitter" && line >> f0)
+			config.SetCellularJitter(f0);
+		else if (key == "PerturbType" && (e = ReadEnumName(line, s_perturbTypeNames, FN_ENUM_COUNT(s_perturbTypeNames))) >= 0)
+			config.SetPerturbType(PerturbType(e));
+		else if (key == "PerturbAmp" && line >> f0)
+			config.SetPerturbAmp(f0);
+		else if (key == "PerturbFrequency" && line >> f0)
+			config.SetPerturbFrequency(f0);
+		else if (key == "PerturbFractalOctaves" && line >> i0 && i0 >= 1 && i0 <= FN_MAX_OCTAVES)
+			config.SetPerturbFractalOctaves(i0);
+		else if (key == "PerturbFractalLacunarity" && line >> f0)
+			config.SetPerturbFractalLacunarity(f0);
+		else if (key == "PerturbFractalGain" && line >> f0)
+			config.SetPerturbFractalGain(f0);
+		else if (key == "PerturbNormaliseLength" && line >> f0)
+			config.SetPerturbNormaliseLength(f0);
+		else
+			return false;
+
+		// Anything after the values is an error
+		std::string rest;
+		if (line >> rest)
+			return false;
+	}
+
+	if (!header)
+		return false;
+
+	*this = config;
+	return true;
+}
+
+uint64_t FastNoiseConfig::GetHash() const
+{
+	uint64_t hash = 14695981039346656037ULL;
+
+	for (uint8_t byte : SaveBinary())
+	{
+		hash ^= byte;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
 void FastNoiseVectorSet::Free()
 {
 	size = -1;
+	kind = Stored;
 	FastNoiseSIMD::FreeNoiseSet(xSet);
 	xSet = nullptr;
 	ySet = nullptr;
@@ -562,6 +1471,7 @@ void FastNoiseVectorSet::SetSize(int _size)
 {
 	Free();
 	size = _size;
+	kind = Stored;
 
 	int alignedSize = FastNoiseSIMD::AlignedSize(size);
 
@@ -569,3 +1479,21 @@ void FastNoiseVectorSet::SetSize(int _size)
 	ySet = xSet + alignedSize;
 	zSet = ySet + alignedSize;
 }
+
+void FastNoiseVectorSet::SetImplicit(Kind _kind, int xSize, int ySize, int zSize, const float* _transform, float _radius)
+{
+	assert(_kind != Stored);
+
+	Free();
+	size = xSize * ySize * zSize;
+	kind = _kind;
+	sampleScale = 0;
+
+	gridSizeX = xSize;
+	gridSizeY = ySize;
+	gridSizeZ = zSize;
+	radius = _radius;
+
+	static const float identity[12] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0 };
+	std::memcpy(transform, _transform ? _transform : identity, sizeof(transform));
+}
@@ -0,0 +1,347 @@
+// FastNoiseSIMD_async.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD/FastNoiseSIMD_async.h"
+#include <assert.h>
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#endif
+
+#ifdef __linux__
+// Parses a sysfs list such as "0-3,8-11"
+static std::vector<int> ParseSysList(const std::string& list)
+{
+	std::vector<int> values;
+	size_t pos = 0;
+
+	while (pos < list.size())
+	{
+		size_t end = list.find(',', pos);
+		if (end == std::string::npos)
+			end = list.size();
+
+		std::string range = list.substr(pos, end - pos);
+		size_t dash = range.find('-');
+		if (!range.empty())
+		{
+			int first = std::stoi(range.substr(0, dash));
+			int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+
+			for (int value = first; value <= last; value++)
+				values.push_back(value);
+		}
+		pos = end + 1;
+	}
+	return values;
+}
+
+static std::string ReadSysLine(const std::string& path)
+{
+	std::ifstream file(path);
+	std::string line;
+	std::getline(file, line);
+	return line;
+}
+#endif
+
+// CPUs of each online NUMA node with CPUs, empty without NUMA information
+static std::vector<std::vector<int>> GetNodeCpus()
+{
+	std::vector<std::vector<int>> nodeCpus;
+
+#ifdef __linux__
+	for (int node : ParseSysList(ReadSysLine("/sys/devices/system/node/online")))
+	{
+		std::vector<int> cpus = ParseSysList(ReadSysLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+
+		// Memory only nodes have no workers
+		if (!cpus.empty())
+			nodeCpus.push_back(cpus);
+	}
+#endif
+	return nodeCpus;
+}
+
+// Pinning is best effort, a failure leaves the thread unpinned
+static void PinThread(std::thread& thread, const std::vector<int>& cpus)
+{
+#ifdef __linux__
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	for (int cpu : cpus)
+	{
+		if (cpu < CPU_SETSIZE)
+			CPU_SET(cpu, &cpuSet);
+	}
+	pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#else
+	(void)thread;
+	(void)cpus;
+#endif
+}
+
+FastNoiseFillPool::FastNoiseFillPool(int threadCount, bool pinToNodes)
+	: FastNoiseFillPool(threadCount, pinToNodes ? GetNodeCpus() : std::vector<std::vector<int>>())
+{
+}
+
+FastNoiseFillPool::FastNoiseFillPool(int threadCount, const std::vector<std::vector<int>>& nodeCpus)
+{
+	if (threadCount <= 0)
+		threadCount = std::max(int(std::thread::hardware_concurrency()), 1);
+
+	// Jobs bound to a node without a worker would never run, so every node gets at least one
+	int nodeCount = std::max(std::min(int(nodeCpus.size()), threadCount), 1);
+	m_queues.resize(nodeCount + 1);
+	m_jobCounts.resize(threadCount, 0);
+
+	// Workers are given to the nodes in turn
+	for (int i = 0; i < threadCount; i++)
+	{
+		int node = i % nodeCount;
+		m_threads.emplace_back(&FastNoiseFillPool::WorkerLoop, this, i, node);
+
+		if (!nodeCpus.empty())
+			PinThread(m_threads.back(), nodeCpus[node]);
+	}
+}
+
+FastNoiseFillPool::~FastNoiseFillPool()
+{
+	std::vector<Queue> cancelled(m_queues.size());
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+		// Workers hold references to the queues, only their contents are moved out
+		for (size_t i = 0; i < m_queues.size(); i++)
+			cancelled[i].swap(m_queues[i]);
+		m_queuedJobs.clear();
+	}
+	m_condition.notify_all();
+
+	for (Queue& queue : cancelled)
+	{
+		for (auto& entry : queue)
+		{
+			if (entry.second.callback)
+				entry.second.callback(false);
+			entry.second.promise.set_value(false);
+		}
+	}
+
+	for (std::thread& thread : m_threads)
+		thread.join();
+}
+
+FastNoiseFillJob FastNoiseFillPool::SubmitWork(std::function<void()> work, int priority, int node, Callback callback)
+{
+	assert(node >= -1 && node < GetNodeCount());
+
+	Job job;
+	job.work = std::move(work);
+	job.callback = std::move(callback);
+
+	FastNoiseFillJob result;
+	result.done = job.promise.get_future().share();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		result.id = m_nextId++;
+		m_queues[node + 1].emplace(QueueKey(priority, result.id), std::move(job));
+		m_queuedJobs[result.id] = { priority, node };
+	}
+
+	// Any worker can take an unbound job, a bound job needs a worker of its node
+	if (node < 0)
+		m_condition.notify_one();
+	else
+		m_condition.notify_all();
+
+	return result;
+}
+
+FastNoiseFillJob FastNoiseFillPool::Submit(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize,
+	float scaleModifier, int priority, Callback callback)
+{
+	assert(noise);
+	assert(noiseSet);
+
+	return SubmitWork([=]()
+	{
+		noise->FillNoiseSet(config, noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+	}, priority, -1, std::move(callback));
+}
+
+void FastNoiseFillPool::FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize,
+	float scaleModifier, int priority)
+{
+	assert(noise);
+	assert(noiseSet);
+
+	// Aligned sets store whole vectors, so each slab starts on a vector boundary and ends on the next slab's start
+	int rowSize = ySize * zSize;
+	int alignment = FastNoiseSIMD::AlignedSize(1);
+	int xStep = 1;
+	while ((xStep * rowSize) % alignment != 0)
+		xStep *= 2;
+
+	int stepCount = (xSize + xStep - 1) / xStep;
+	std::vector<FastNoiseFillJob> jobs;
+
+	// The config outlives the jobs, this call waits for them
+	const FastNoiseConfig* jobConfig = &config;
+
+	if (stepCount >= GetThreadCount() || ySize < 2)
+	{
+		int slabCount = std::max(std::min(stepCount, GetThreadCount()), 1);
+
+		for (int slab = 0; slab < slabCount; slab++)
+		{
+			int x0 = std::min(stepCount * slab / slabCount * xStep, xSize);
+			int x1 = std::min(stepCount * (slab + 1) / slabCount * xStep, xSize);
+			int node = slab * GetNodeCount() / slabCount;
+
+			if (x0 == x1)
+				continue;
+
+			jobs.push_back(SubmitWork([=]()
+			{
+				noise->FillNoiseSet(*jobConfig, noiseSet + x0 * rowSize, xStart + x0, yStart, zStart, x1 - x0, ySize, zSize, scaleModifier);
+			}, priority, node, nullptr));
+		}
+	}
+	else
+	{
+		// Too few x steps for every worker, each fills a band of y into its own set and copies its rows in place
+		int bandCount = std::min(ySize, GetThreadCount());
+
+		for (int band = 0; band < bandCount; band++)
+		{
+			int y0 = ySize * band / bandCount;
+			int y1 = ySize * (band + 1) / bandCount;
+			int node = band * GetNodeCount() / bandCount;
+
+			jobs.push_back(SubmitWork([=]()
+			{
+				size_t bandSize = size_t(y1 - y0) * zSize;
+				float* bandSet = FastNoiseSIMD::GetEmptySet(int(xSize * bandSize));
+				noise->FillNoiseSet(*jobConfig, bandSet, xStart, yStart + y0, zStart, xSize, y1 - y0, zSize, scaleModifier);
+
+				for (int x = 0; x < xSize; x++)
+					std::memcpy(noiseSet + size_t(x) * rowSize + size_t(y0) * zSize, bandSet + x * bandSize, bandSize * sizeof(float));
+
+				FastNoiseSIMD::FreeNoiseSet(bandSet);
+			}, priority, node, nullptr));
+		}
+	}
+
+	for (FastNoiseFillJob& job : jobs)
+		job.done.wait();
+}
+
+float* FastNoiseFillPool::GetEmptySet(int size, int node)
+{
+	float* noiseSet = FastNoiseSIMD::GetEmptySet(size);
+	if (!noiseSet)
+		return nullptr;
+
+	size_t bytes = sizeof(float) * FastNoiseSIMD::AlignedSize(size);
+	SubmitWork([=]() { std::memset(noiseSet, 0, bytes); }, 0, node, nullptr).done.wait();
+
+	return noiseSet;
+}
+
+bool FastNoiseFillPool::Cancel(uint64_t id)
+{
+	Job job;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto queuedJob = m_queuedJobs.find(id);
+		if (queuedJob == m_queuedJobs.end())
+			return false;
+
+		Queue& queue = m_queues[queuedJob->second.node + 1];
+		auto queued = queue.find(QueueKey(queuedJob->second.priority, id));
+		job = std::move(queued->second);
+		queue.erase(queued);
+		m_queuedJobs.erase(queuedJob);
+	}
+
+	if (job.callback)
+		job.callback(false);
+	job.promise.set_value(false);
+	return true;
+}
+
+size_t FastNoiseFillPool::GetQueuedCount() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_queuedJobs.size();
+}
+
+std::vector<uint64_t> FastNoiseFillPool::GetJobCounts() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_jobCounts;
+}
+
+void FastNoiseFillPool::WorkerLoop(int worker, int node)
+{
+	Queue& anyQueue = m_queues[0];
+	Queue& nodeQueue = m_queues[node + 1];
+
+	while (true)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [&]() { return m_stopping || !anyQueue.empty() || !nodeQueue.empty(); });
+			if (anyQueue.empty() && nodeQueue.empty())
+				return;
+
+			// Highest priority of both queues, the lower id on a tie
+			Queue& queue = anyQueue.empty() || (!nodeQueue.empty() && QueueOrder()(nodeQueue.begin()->first, anyQueue.begin()->first)) ? nodeQueue : anyQueue;
+			auto next = queue.begin();
+			job = std::move(next->second);
+			m_queuedJobs.erase(next->first.second);
+			queue.erase(next);
+			m_jobCounts[worker]++;
+		}
+
+		job.work();
+
+		if (job.callback)
+			job.callback(true);
+		job.promise.set_value(true);
+	}
+}
@@ -0,0 +1,157 @@
+// FastNoiseSIMD_cache.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+
+#include "FastNoiseSIMD/FastNoiseSIMD_cache.h"
+#include <assert.h>
+#include <cstring>
+
+FastNoiseSetCache::FastNoiseSetCache(size_t memoryBudget, int shardCount)
+	: m_hits(0), m_misses(0), m_evictions(0)
+{
+	assert(shardCount > 0);
+	m_shardBudget = memoryBudget / size_t(shardCount);
+
+	for (int i = 0; i < shardCount; i++)
+		m_shards.emplace_back(new Shard());
+}
+
+bool FastNoiseSetCache::Key::operator==(const Key& other) const
+{
+	// Scale modifiers compare by bits so the comparison agrees with the hash
+	return configHash == other.configHash && simdLevel == other.simdLevel &&
+		xStart == other.xStart && yStart == other.yStart && zStart == other.zStart &&
+		xSize == other.xSize && ySize == other.ySize && zSize == other.zSize &&
+		std::memcmp(&scaleModifier, &other.scaleModifier, sizeof(float)) == 0;
+}
+
+uint64_t FastNoiseSetCache::HashKey(const Key& key)
+{
+	uint32_t scaleBits;
+	std::memcpy(&scaleBits, &key.scaleModifier, sizeof(scaleBits));
+
+	const uint64_t fields[] = { key.configHash, uint32_t(key.simdLevel),
+		uint32_t(key.xStart), uint32_t(key.yStart), uint32_t(key.zStart),
+		uint32_t(key.xSize), uint32_t(key.ySize), uint32_t(key.zSize), scaleBits };
+
+	uint64_t hash = 14695981039346656037ULL;
+	for (uint64_t field : fields)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			hash ^= (field >> (i * 8)) & 0xff;
+			hash *= 1099511628211ULL;
+		}
+	}
+	return hash;
+}
+
+bool FastNoiseSetCache::FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, uint64_t configHash, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	assert(noise);
+	assert(noiseSet);
+
+	// Levels round differently, each keeps its own sets
+	Key key = { configHash, noise->GetInstanceSIMDLevel(), xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier };
+	Shard& shard = GetShard(HashKey(key));
+	size_t count = size_t(xSize) * size_t(ySize) * size_t(zSize);
+	SetData data;
+
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		auto found = shard.map.find(key);
+
+		if (found != shard.map.end())
+		{
+			shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+			data = found->second->second;
+		}
+	}
+
+	if (data)
+	{
+		m_hits++;
+		std::memcpy(noiseSet, data->data(), count * sizeof(float));
+		return true;
+	}
+
+	m_misses++;
+	noise->FillNoiseSet(config, noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+	size_t bytes = count * sizeof(float);
+	if (bytes > m_shardBudget)
+		return false;
+
+	data = std::make_shared<const std::vector<float>>(noiseSet, noiseSet + count);
+
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	// Another thread filled the same set in the meantime
+	if (shard.map.find(key) != shard.map.end())
+		return false;
+
+	while (shard.bytes + bytes > m_shardBudget)
+	{
+		shard.bytes -= shard.lru.back().second->size() * sizeof(float);
+		shard.map.erase(shard.lru.back().first);
+		shard.lru.pop_back();
+		m_evictions++;
+	}
+
+	shard.lru.emplace_front(key, data);
+	shard.map[key] = shard.lru.begin();
+	shard.bytes += bytes;
+	return false;
+}
+
+void FastNoiseSetCache::Clear()
+{
+	for (auto& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard->mutex);
+		shard->map.clear();
+		shard->lru.clear();
+		shard->bytes = 0;
+	}
+}
+
+FastNoiseSetCacheStats FastNoiseSetCache::GetStats() const
+{
+	FastNoiseSetCacheStats stats;
+	stats.hits = m_hits;
+	stats.misses = m_misses;
+	stats.evictions = m_evictions;
+
+	for (auto& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard->mutex);
+		stats.entries += shard->map.size();
+		stats.bytes += shard->bytes;
+	}
+	return stats;
+}
@@ -0,0 +1,116 @@
+// FastNoiseSIMD_heightmap.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD/FastNoiseSIMD_heightmap.h"
+#include "FastNoiseSIMD_kernels.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+
+void FastNoiseHeightmapBaker::Bake(const FastNoiseSIMD* noise, const FastNoiseConfig& config, int xStart, int yStart, int z, int xSize, int ySize, float scaleModifier,
+	float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures) const
+{
+	assert(noise);
+
+	float* apronHeights = FastNoiseSIMD::GetEmptySet(xSize + 2, ySize + 2, 1);
+	noise->FillNoiseSet(config, apronHeights, xStart - 1, yStart - 1, z, xSize + 2, ySize + 2, 1, scaleModifier);
+
+	Derive(FastNoiseSIMD_internal::GetKernels(noise->GetInstanceSIMDLevel()), apronHeights, xSize, ySize, heights, normals, slopes, curvatures);
+	FastNoiseSIMD::FreeNoiseSet(apronHeights);
+}
+
+void FastNoiseHeightmapBaker::Derive(const float* apronHeights, int xSize, int ySize,
+	float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures) const
+{
+	Derive(FastNoiseSIMD_internal::GetKernels(FastNoiseSIMD::GetSIMDLevel()), apronHeights, xSize, ySize, heights, normals, slopes, curvatures);
+}
+
+void FastNoiseHeightmapBaker::Derive(const FastNoiseKernels& kernels, const float* apronHeights, int xSize, int ySize,
+	float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures) const
+{
+	assert(apronHeights);
+	assert(xSize > 0 && ySize > 0);
+	assert(texelSize != 0.0f);
+
+	const int yApron = ySize + 2;
+	const float gradientScale = heightScale / (2.0f * texelSize);
+	const float curvatureScale = heightScale / (texelSize * texelSize);
+
+	for (int x = 0; x < xSize; x++)
+	{
+		// Rows x - 1, x and x + 1
+		const float* low = apronHeights + size_t(x) * yApron;
+		const size_t out = size_t(x) * ySize;
+
+		kernels.deriveHeightRow(low, low + yApron, low + 2 * yApron, ySize, heightScale, gradientScale, curvatureScale,
+			heights ? heights + out : nullptr, normals ? normals + out : nullptr, slopes ? slopes + out : nullptr, curvatures ? curvatures + out : nullptr);
+	}
+}
+
+FastNoisePackedNormal FastNoiseHeightmapBaker::EncodeNormal(float x, float y, float z)
+{
+	float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+	float u = l1 > 0.0f ? x / l1 : 0.0f;
+	float v = l1 > 0.0f ? y / l1 : 0.0f;
+
+	// The lower hemisphere folds out over the diagonals
+	if (z < 0.0f)
+	{
+		float foldedU = (1.0f - std::fabs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+		float foldedV = (1.0f - std::fabs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+		u = foldedU;
+		v = foldedV;
+	}
+
+	FastNoisePackedNormal normal;
+	normal.u = int16_t(std::lrint(u * 32767.0f));
+	normal.v = int16_t(std::lrint(v * 32767.0f));
+	return normal;
+}
+
+void FastNoiseHeightmapBaker::DecodeNormal(FastNoisePackedNormal normal, float* x, float* y, float* z)
+{
+	assert(x && y && z);
+
+	float u = std::max(float(normal.u) / 32767.0f, -1.0f);
+	float v = std::max(float(normal.v) / 32767.0f, -1.0f);
+	float w = 1.0f - std::fabs(u) - std::fabs(v);
+
+	if (w < 0.0f)
+	{
+		float unfoldedU = (1.0f - std::fabs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+		float unfoldedV = (1.0f - std::fabs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+		u = unfoldedU;
+		v = unfoldedV;
+	}
+
+	float length = std::sqrt(u * u + v * v + w * w);
+	*x = u / length;
+	*y = v / length;
+	*z = w / length;
+}
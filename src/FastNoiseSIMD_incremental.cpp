@@ -0,0 +1,214 @@
+// FastNoiseSIMD_incremental.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD/FastNoiseSIMD_incremental.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+static uint64_t HashCombine(uint64_t hash, uint32_t value)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		hash ^= (value >> (i * 8)) & 0xFF;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+static uint32_t FloatBits(float f)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &f, sizeof(bits));
+	return bits;
+}
+
+FastNoiseIncrementalSet::FastNoiseIncrementalSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+	: m_xStart(xStart), m_yStart(yStart), m_zStart(zStart), m_xSize(xSize), m_ySize(ySize), m_zSize(zSize), m_scaleModifier(scaleModifier)
+{
+	assert(xSize > 0 && ySize > 0 && zSize > 0);
+}
+
+void FastNoiseIncrementalSet::Clear()
+{
+	for (float* octaveSet : m_octaveSets)
+		FastNoiseSIMD::FreeNoiseSet(octaveSet);
+
+	m_octaveSets.clear();
+	m_octaveKeys.clear();
+}
+
+// Hash of every setting an octave value depends on, besides the per octave weights
+// The fractal perturb types scale their amplitude by the fractal bounding, which depends on all amplitudes
+uint64_t FastNoiseIncrementalSet::GetBaseKey(const FastNoiseConfig& config)
+{
+	FastNoiseConfig base = config;
+	base.m_fractalAntiAliasing = false;
+
+	switch (config.m_perturbType)
+	{
+	case FastNoiseConfig::GradientFractal:
+	case FastNoiseConfig::GradientFractal_Normalise:
+	case FastNoiseConfig::SimplexGradientFractal:
+	case FastNoiseConfig::OpenSimplex2GradientFractal:
+		break;
+	default:
+		base.m_octaves = 1;
+		base.m_gain = 0.5f;
+		base.m_octaveWeightCount = 0;
+		break;
+	}
+	return HashCombine(base.GetHash(), uint32_t(config.m_octaveWeightCount > 0));
+}
+
+// Octave i also depends on the frequency and seed offset weights of octaves 0 to i
+uint64_t FastNoiseIncrementalSet::GetOctaveKey(const FastNoiseConfig& config, uint64_t baseKey, int octave)
+{
+	uint64_t key = HashCombine(baseKey, uint32_t(octave));
+
+	for (int i = 0; i <= octave && i < config.m_octaveWeightCount; i++)
+	{
+		key = HashCombine(key, FloatBits(config.m_octaveFrequencies[i]));
+		key = HashCombine(key, uint32_t(config.m_octaveSeedOffsets[i]));
+	}
+	return key;
+}
+
+int FastNoiseIncrementalSet::FillNoiseSet(const FastNoiseSIMD* noise, const FastNoiseConfig& config, float* noiseSet)
+{
+	assert(noise);
+	assert(noiseSet);
+
+	bool fractal = false;
+	switch (config.m_noiseType)
+	{
+	case FastNoiseConfig::ValueFractal:
+	case FastNoiseConfig::PerlinFractal:
+	case FastNoiseConfig::SimplexFractal:
+	case FastNoiseConfig::OpenSimplex2Fractal:
+	case FastNoiseConfig::CubicFractal:
+		fractal = true;
+		break;
+	default:
+		break;
+	}
+
+	FastNoiseConfig::FractalType fractalType = config.m_fractalType;
+	bool additive = fractalType == FastNoiseConfig::FBM || fractalType == FastNoiseConfig::Billow || fractalType == FastNoiseConfig::RigidMulti;
+
+	if (!fractal || !additive)
+	{
+		Clear();
+		noise->FillNoiseSet(config, noiseSet, m_xStart, m_yStart, m_zStart, m_xSize, m_ySize, m_zSize, m_scaleModifier);
+		return fractal ? config.GetFractalOctaveCount() : 1;
+	}
+
+	// Same octave count and fade as the anti-aliased fractal fills
+	int octaveCount = config.GetFractalOctaveCount();
+	int fadeOctave = -1;
+	float fade = 1.0f;
+
+	if (config.m_fractalAntiAliasing)
+	{
+		float nyquistOctaves = config.CalculateNyquistOctaves(m_scaleModifier);
+		if (nyquistOctaves < float(octaveCount))
+		{
+			nyquistOctaves = std::max(nyquistOctaves, 1.0f);
+			octaveCount = int(std::ceil(nyquistOctaves));
+			fade = nyquistOctaves - std::floor(nyquistOctaves);
+			if (fade > 0.0f)
+				fadeOctave = octaveCount - 1;
+		}
+	}
+
+	int size = m_xSize * m_ySize * m_zSize;
+	uint64_t baseKey = GetBaseKey(config);
+	int evaluated = 0;
+
+	for (int octave = 0; octave < octaveCount; octave++)
+	{
+		uint64_t key = GetOctaveKey(config, baseKey, octave);
+
+		if (octave < GetKeptOctaveCount())
+		{
+			if (m_octaveKeys[octave] == key)
+				continue;
+
+			// The octaves above depend on this one
+			for (size_t i = octave; i < m_octaveSets.size(); i++)
+				FastNoiseSIMD::FreeNoiseSet(m_octaveSets[i]);
+
+			m_octaveSets.resize(octave);
+			m_octaveKeys.resize(octave);
+		}
+
+		float* octaveSet = FastNoiseSIMD::GetEmptySet(size);
+		noise->FillFractalOctaveSet(config, octaveSet, m_xStart, m_yStart, m_zStart, m_xSize, m_ySize, m_zSize, octave, m_scaleModifier);
+
+		m_octaveSets.push_back(octaveSet);
+		m_octaveKeys.push_back(key);
+		evaluated++;
+	}
+
+	// Amplitudes follow FRACTAL_NEXT_OCTAVE, the first RigidMulti octave is added and all others subtracted
+	float amplitude = 1.0f;
+
+	for (int octave = 0; octave < octaveCount; octave++)
+	{
+		if (config.m_octaveWeightCount > 0)
+			amplitude = config.m_octaveAmplitudes[octave];
+		else if (octave > 0)
+			amplitude *= config.m_gain;
+
+		float octaveAmplitude = octave > 0 && octave == fadeOctave ? amplitude * fade : amplitude;
+		if (fractalType == FastNoiseConfig::RigidMulti && octave > 0)
+			octaveAmplitude = -octaveAmplitude;
+
+		const float* octaveSet = m_octaveSets[octave];
+
+		if (octave == 0)
+		{
+			for (int i = 0; i < size; i++)
+				noiseSet[i] = octaveSet[i] * octaveAmplitude;
+		}
+		else
+		{
+			for (int i = 0; i < size; i++)
+				noiseSet[i] += octaveSet[i] * octaveAmplitude;
+		}
+	}
+
+	if (fractalType != FastNoiseConfig::RigidMulti)
+	{
+		for (int i = 0; i < size; i++)
+			noiseSet[i] *= config.m_fractalBounding;
+	}
+
+	return evaluated;
+}
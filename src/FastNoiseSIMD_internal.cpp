@@ -27,7 +27,14 @@
 //
 
 #include "FastNoiseSIMD/FastNoiseSIMD.h"
+#include "FastNoiseSIMD/FastNoiseSIMD_heightmap.h"
+#include "FastNoiseSIMD/FastNoiseSIMD_volume.h"
+#include "FastNoiseSIMD_kernels.h"
 #include <assert.h> 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
 #if defined(SIMD_LEVEL) || defined(FN_COMPILE_NO_SIMD_FALLBACK)
 
@@ -44,8 +51,8 @@
 #define L_VAR(x, l) L_VAR2(x, l)
 #define VAR(x) L_VAR(x, SIMD_LEVEL)
 #define FUNC(x) VAR(FUNC_##x)
-#define SIMDf_NUM(n) VAR(SIMDf_NUM_##n)
-#define SIMDi_NUM(n) VAR(SIMDi_NUM_##n)
+#define SIMDf_NUM(n) SIMDf_NUM_##n
+#define SIMDi_NUM(n) SIMDi_NUM_##n
 
 #define SIMD_LEVEL_CLASS FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(SIMD_LEVEL)
 
@@ -58,7 +65,6 @@
 // Typedefs
 #if SIMD_LEVEL == FN_NEON
 #define VECTOR_SIZE 4
-#define MEMORY_ALIGNMENT 16
 typedef float32x4_t SIMDf;
 typedef int32x4_t SIMDi;
 #define SIMDf_SET(a) vdupq_n_f32(a)
@@ -68,7 +74,6 @@ typedef int32x4_t SIMDi;
 
 #elif SIMD_LEVEL == FN_AVX512
 #define VECTOR_SIZE 16
-#define MEMORY_ALIGNMENT 64
 typedef __m512 SIMDf;
 typedef __m512i SIMDi;
 #define SIMDf_SET(a) _mm512_set1_ps(a)
@@ -78,7 +83,6 @@ typedef __m512i SIMDi;
 
 #elif SIMD_LEVEL == FN_AVX2
 #define VECTOR_SIZE 8
-#define MEMORY_ALIGNMENT 32
 typedef __m256 SIMDf;
 typedef __m256i SIMDi;
 #define SIMDf_SET(a) _mm256_set1_ps(a)
@@ -88,7 +92,6 @@ typedef __m256i SIMDi;
 
 #elif SIMD_LEVEL >= FN_SSE2
 #define VECTOR_SIZE 4
-#define MEMORY_ALIGNMENT 16
 typedef __m128 SIMDf;
 typedef __m128i SIMDi;
 #define SIMDf_SET(a) _mm_set1_ps(a)
@@ -98,7 +101,6 @@ typedef __m128i SIMDi;
 
 #else // Fallback to float/int
 #define VECTOR_SIZE 1
-#define MEMORY_ALIGNMENT 4
 typedef float SIMDf;
 typedef int SIMDi;
 #define SIMDf_SET(a) (a)
@@ -107,18 +109,6 @@ typedef int SIMDi;
 #define SIMDi_SET_ZERO() (0)
 #endif
 
-// Memory Allocation
-#if SIMD_LEVEL > FN_NO_SIMD_FALLBACK && defined(FN_ALIGNED_SETS)
-#ifdef _WIN32
-#define SIMD_ALLOCATE_SET(floatP, floatCount) floatP = (float*)_aligned_malloc((floatCount)* sizeof(float), MEMORY_ALIGNMENT)
-#else
-#include <cstdlib>
-#define SIMD_ALLOCATE_SET(floatP, floatCount) posix_memalign((void**)&floatP, MEMORY_ALIGNMENT, (floatCount)* sizeof(float))
-#endif
-#else
-#define SIMD_ALLOCATE_SET(floatP, floatCount) floatP = new float[floatCount]
-#endif
-
 union uSIMDf
 {
 	SIMDf m;
@@ -137,9 +127,10 @@ typedef __mmask16 MASK;
 typedef SIMDi MASK;
 #endif
 
-
-static SIMDi SIMDi_NUM(0xffffffff);
-static SIMDf SIMDf_NUM(1);
+// Constants are broadcast where they are used, optimising compilers fold them into constant loads
+// There is no static state to initialise so instances can be created concurrently from any thread
+#define SIMDi_NUM_0xffffffff SIMDi_SET(-1)
+#define SIMDf_NUM_1 SIMDf_SET(1.0f)
 
 // SIMD functions
 #if SIMD_LEVEL == FN_NEON
@@ -147,17 +138,52 @@ static SIMDf SIMDf_NUM(1);
 #define SIMDf_STORE(p,a) vst1q_f32(p, a)
 #define SIMDf_LOAD(p) vld1q_f32(p)
 
+// Unaligned, p is float* or int*
+#define SIMDf_STOREU(p,a) vst1q_f32(p, a)
+#define SIMDf_LOADU(p) vld1q_f32(p)
+#define SIMDi_STOREU(p,a) vst1q_s32(p, a)
+#define SIMDi_LOADU(p) vld1q_s32(p)
+
 #define SIMDf_UNDEFINED() SIMDf_SET(0)
 #define SIMDi_UNDEFINED() SIMDi_SET(0)
 
 #define SIMDf_CONVERT_TO_FLOAT(a) vcvtq_f32_s32(a)
 #define SIMDf_CAST_TO_FLOAT(a) vreinterpretq_f32_s32(a)
+#if defined(FN_DETERMINISTIC) && defined(__aarch64__)
+#define SIMDi_CONVERT_TO_INT(a) vcvtnq_s32_f32(a)
+#elif defined(FN_DETERMINISTIC)
+static SIMDi VECTORCALL FUNC(CONVERT_TO_INT)(SIMDf a)
+{
+	uSIMDf uA;
+	uSIMDi uResult;
+	uA.m = a;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		uResult.a[i] = int(rintf(uA.a[i]));
+	return uResult.m;
+}
+#define SIMDi_CONVERT_TO_INT(a) FUNC(CONVERT_TO_INT)(a)
+#else
 #define SIMDi_CONVERT_TO_INT(a) vcvtq_s32_f32(a)
+#endif
 #define SIMDi_CAST_TO_INT(a) vreinterpretq_s32_f32(a)
 
 #define SIMDf_ADD(a,b) vaddq_f32(a,b)
 #define SIMDf_SUB(a,b) vsubq_f32(a,b)
 #define SIMDf_MUL(a,b) vmulq_f32(a,b)
+#if defined(FN_DETERMINISTIC) && defined(__aarch64__)
+#define SIMDf_DIV(a,b) vdivq_f32(a,b)
+#elif defined(FN_DETERMINISTIC)
+static SIMDf VECTORCALL FUNC(DIV)(SIMDf a, SIMDf b)
+{
+	uSIMDf uA, uB;
+	uA.m = a;
+	uB.m = b;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		uA.a[i] /= uB.a[i];
+	return uA.m;
+}
+#define SIMDf_DIV(a,b) FUNC(DIV)(a,b)
+#else
 #define SIMDf_DIV(a,b) FUNC(DIV)(a,b)
 
 static SIMDf VECTORCALL FUNC(DIV)(SIMDf a, SIMDf b)
@@ -171,11 +197,26 @@ static SIMDf VECTORCALL FUNC(DIV)(SIMDf a, SIMDf b)
 	// and finally, compute a/b = a*(1/b)
 	return vmulq_f32(a, reciprocal);
 }
+#endif
 
 #define SIMDf_MIN(a,b) vminq_f32(a,b)
 #define SIMDf_MAX(a,b) vmaxq_f32(a,b)
 #define SIMDf_INV_SQRT(a) vrsqrteq_f32(a)
 
+#ifdef __aarch64__
+#define SIMDf_SQRT(a) vsqrtq_f32(a)
+#else
+static SIMDf VECTORCALL FUNC(SQRT)(SIMDf a)
+{
+	uSIMDf uA;
+	uA.m = a;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		uA.a[i] = sqrtf(uA.a[i]);
+	return uA.m;
+}
+#define SIMDf_SQRT(a) FUNC(SQRT)(a)
+#endif
+
 #define SIMDf_LESS_THAN(a,b) vreinterpretq_s32_u32(vcltq_f32(a,b))
 #define SIMDf_GREATER_THAN(a,b) vreinterpretq_s32_u32(vcgtq_f32(a,b))
 #define SIMDf_LESS_EQUAL(a,b) vreinterpretq_s32_u32(vcleq_f32(a,b))
@@ -231,6 +272,11 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_LOAD(p) _mm512_loadu_ps(p)
 #endif
 
+#define SIMDf_STOREU(p,a) _mm512_storeu_ps(p,a)
+#define SIMDf_LOADU(p) _mm512_loadu_ps(p)
+#define SIMDi_STOREU(p,a) _mm512_storeu_si512(p,a)
+#define SIMDi_LOADU(p) _mm512_loadu_si512(p)
+
 #define SIMDf_UNDEFINED() _mm512_undefined_ps()
 #define SIMDi_UNDEFINED() _mm512_undefined_epi32()
 
@@ -242,6 +288,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_MIN(a,b) _mm512_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm512_max_ps(a,b)
 #define SIMDf_INV_SQRT(a) _mm512_rsqrt14_ps(a)
+#define SIMDf_SQRT(a) _mm512_sqrt_ps(a)
 
 #define SIMDf_LESS_THAN(a,b) _mm512_cmp_ps_mask(a,b,_CMP_LT_OQ)
 #define SIMDf_GREATER_THAN(a,b) _mm512_cmp_ps_mask(a,b,_CMP_GT_OQ)
@@ -293,6 +340,11 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_LOAD(p) _mm256_loadu_ps(p)
 #endif
 
+#define SIMDf_STOREU(p,a) _mm256_storeu_ps(p,a)
+#define SIMDf_LOADU(p) _mm256_loadu_ps(p)
+#define SIMDi_STOREU(p,a) _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),a)
+#define SIMDi_LOADU(p) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))
+
 #define SIMDf_UNDEFINED() _mm256_undefined_ps()
 #define SIMDi_UNDEFINED() _mm256_undefined_si256()
 
@@ -309,6 +361,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_MIN(a,b) _mm256_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm256_max_ps(a,b)
 #define SIMDf_INV_SQRT(a) _mm256_rsqrt_ps(a)
+#define SIMDf_SQRT(a) _mm256_sqrt_ps(a)
 
 #define SIMDf_LESS_THAN(a,b) SIMDi_CAST_TO_INT(_mm256_cmp_ps(a,b,_CMP_LT_OQ))
 #define SIMDf_GREATER_THAN(a,b) SIMDi_CAST_TO_INT(_mm256_cmp_ps(a,b,_CMP_GT_OQ))
@@ -351,6 +404,11 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_LOAD(p) _mm_loadu_ps(p)
 #endif
 
+#define SIMDf_STOREU(p,a) _mm_storeu_ps(p,a)
+#define SIMDf_LOADU(p) _mm_loadu_ps(p)
+#define SIMDi_STOREU(p,a) _mm_storeu_si128(reinterpret_cast<__m128i*>(p),a)
+#define SIMDi_LOADU(p) _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))
+
 #define SIMDf_UNDEFINED() SIMDf_SET_ZERO()
 #define SIMDi_UNDEFINED() SIMDi_SET_ZERO()
 
@@ -367,6 +425,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_MIN(a,b) _mm_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm_max_ps(a,b)
 #define SIMDf_INV_SQRT(a) _mm_rsqrt_ps(a)
+#define SIMDf_SQRT(a) _mm_sqrt_ps(a)
 
 #define SIMDf_LESS_THAN(a,b) SIMDi_CAST_TO_INT(_mm_cmplt_ps(a,b))
 #define SIMDf_GREATER_THAN(a,b) SIMDi_CAST_TO_INT(_mm_cmpgt_ps(a,b))
@@ -429,6 +488,15 @@ static float FUNC(CAST_TO_FLOAT)(int i) { return *reinterpret_cast<float*>(&i);
 #define SIMDf_STORE(p,a) (*(p) = a)
 #define SIMDf_LOAD(p) (*p)
 
+// Integers may be read from byte rows, memcpy avoids misaligned int accesses
+static int FUNC(LOADU)(const int* p) { int i; std::memcpy(&i, p, sizeof(int)); return i; }
+static void FUNC(STOREU)(int* p, int a) { std::memcpy(p, &a, sizeof(int)); }
+
+#define SIMDf_STOREU(p,a) (*(p) = a)
+#define SIMDf_LOADU(p) (*(p))
+#define SIMDi_STOREU(p,a) FUNC(STOREU)(p,a)
+#define SIMDi_LOADU(p) FUNC(LOADU)(p)
+
 #define SIMDf_UNDEFINED() (0)
 #define SIMDi_UNDEFINED() (0)
 
@@ -450,6 +518,7 @@ static float FUNC(INV_SQRT)(float x)
 	return x;
 }
 #define SIMDf_INV_SQRT(a) FUNC(INV_SQRT)(a)
+#define SIMDf_SQRT(a) sqrtf(a)
 
 #define SIMDf_LESS_THAN(a,b) (((a) < (b)) ? 0xFFFFFFFF : 0)
 #define SIMDf_GREATER_THAN(a,b) (((a) > (b)) ? 0xFFFFFFFF : 0)
@@ -483,7 +552,11 @@ static float FUNC(INV_SQRT)(float x)
 #define SIMDi_GREATER_THAN(a,b) (((a) > (b)) ? 0xFFFFFFFF : 0)
 #define SIMDi_LESS_THAN(a,b) (((a) < (b)) ? 0xFFFFFFFF : 0)
 
+#ifdef FN_DETERMINISTIC
+#define SIMDi_CONVERT_TO_INT(a) static_cast<int>(rintf(a))
+#else
 #define SIMDi_CONVERT_TO_INT(a) static_cast<int>(roundf(a))
+#endif
 #define SIMDf_CONVERT_TO_FLOAT(a) static_cast<float>(a)
 #endif
 
@@ -535,7 +608,7 @@ static float FUNC(INV_SQRT)(float x)
 #endif
 
 // FMA
-#ifdef FN_USE_FMA
+#if defined(FN_USE_FMA) && !defined(FN_DETERMINISTIC)
 #if SIMD_LEVEL == FN_NEON
 #define SIMDf_MUL_ADD(a,b,c) vmlaq_f32(b,c,a)
 #define SIMDf_MUL_SUB(a,b,c) SIMDf_SUB(SIMDf_MUL(a,b),c) // Neon multiply sub swaps sides of minus compared to FMA making it unusable
@@ -557,134 +630,87 @@ static float FUNC(INV_SQRT)(float x)
 #define SIMDf_NMUL_ADD(a,b,c)  SIMDf_SUB(c, SIMDf_MUL(a,b))
 #endif
 
-static bool VAR(SIMD_Values_Set) = false;
-
-static SIMDf SIMDf_NUM(incremental);
-static SIMDf SIMDf_NUM(0);
-static SIMDf SIMDf_NUM(2);
-static SIMDf SIMDf_NUM(6);
-static SIMDf SIMDf_NUM(10);
-static SIMDf SIMDf_NUM(15);
-static SIMDf SIMDf_NUM(32);
-static SIMDf SIMDf_NUM(999999);
-static SIMDf SIMDf_NUM(_1);
-
-static SIMDf SIMDf_NUM(0_5);
-static SIMDf SIMDf_NUM(0_6);
-static SIMDf SIMDf_NUM(15_5);
-static SIMDf SIMDf_NUM(511_5);
-static SIMDf SIMDf_NUM(32768_5);
-
-//static SIMDf SIMDf_NUM(cellJitter);
-static SIMDf SIMDf_NUM(F3);
-static SIMDf SIMDf_NUM(G3);
-static SIMDf SIMDf_NUM(R3);
-static SIMDf SIMDf_NUM(G33);
-static SIMDf SIMDf_NUM(hash2Float);
-static SIMDf SIMDf_NUM(vectorSize);
-static SIMDf SIMDf_NUM(cubicBounding);
-
-#if SIMD_LEVEL == FN_AVX512
-static SIMDf SIMDf_NUM(X_GRAD);
-static SIMDf SIMDf_NUM(Y_GRAD);
-static SIMDf SIMDf_NUM(Z_GRAD);
-
-#else
-static SIMDi SIMDi_NUM(8);
-static SIMDi SIMDi_NUM(12);
-static SIMDi SIMDi_NUM(13);
+// The reciprocal square root estimate differs between SIMD levels and CPU vendors
+#ifdef FN_DETERMINISTIC
+#undef SIMDf_INV_SQRT
+#define SIMDf_INV_SQRT(a) SIMDf_DIV(SIMDf_NUM(1), SIMDf_SQRT(a))
 #endif
 
-static SIMDi SIMDi_NUM(incremental);
-static SIMDi SIMDi_NUM(1);
-static SIMDi SIMDi_NUM(2);
-static SIMDi SIMDi_NUM(255);
-static SIMDi SIMDi_NUM(60493);
-static SIMDi SIMDi_NUM(0x7fffffff);
-
-//static SIMDi SIMDi_NUM(xGradBits);
-//static SIMDi SIMDi_NUM(yGradBits);
-//static SIMDi SIMDi_NUM(zGradBits);
-
-static SIMDi SIMDi_NUM(xPrime);
-static SIMDi SIMDi_NUM(yPrime);
-static SIMDi SIMDi_NUM(zPrime);
-static SIMDi SIMDi_NUM(bit5Mask);
-static SIMDi SIMDi_NUM(bit10Mask);
-static SIMDi SIMDi_NUM(vectorSize);
-
-void FUNC(InitSIMDValues)()
-{
-	if (VAR(SIMD_Values_Set))
-		return;
-
-	uSIMDf incF;
-	uSIMDi incI;
-	for (int i = 0; i < VECTOR_SIZE; i++)
-	{
-		incF.a[i] = float(i);
-		incI.a[i] = i;
-	}
-	SIMDf_NUM(incremental) = incF.m;
-	SIMDi_NUM(incremental) = incI.m;
-
-	SIMDf_NUM(0) = SIMDf_SET_ZERO();
-	SIMDf_NUM(1) = SIMDf_SET(1.0f);
-	SIMDf_NUM(2) = SIMDf_SET(2.0f);
-	SIMDf_NUM(6) = SIMDf_SET(6.0f);
-	SIMDf_NUM(10) = SIMDf_SET(10.0f);
-	SIMDf_NUM(15) = SIMDf_SET(15.0f);
-	SIMDf_NUM(32) = SIMDf_SET(32.0f);
-	SIMDf_NUM(999999) = SIMDf_SET(999999.0f);
-	SIMDf_NUM(_1) = SIMDf_SET(-1.0f);
-
-	SIMDf_NUM(0_5) = SIMDf_SET(0.5f);
-	SIMDf_NUM(0_6) = SIMDf_SET(0.6f);
-	SIMDf_NUM(15_5) = SIMDf_SET(15.5f);
-	SIMDf_NUM(511_5) = SIMDf_SET(511.5f);
-	SIMDf_NUM(32768_5) = SIMDf_SET(32768.5f);
-
-	//SIMDf_NUM(cellJitter) = SIMDf_SET(0.39614f);
-	SIMDf_NUM(F3) = SIMDf_SET(1.f / 3.f);
-	SIMDf_NUM(G3) = SIMDf_SET(1.f / 6.f);
-	SIMDf_NUM(R3) = SIMDf_SET(2.f / 3.f);
-	SIMDf_NUM(G33) = SIMDf_SET((3.f / 6.f) - 1.f);
-	SIMDf_NUM(hash2Float) = SIMDf_SET(1.f / 2147483648.f);
-	SIMDf_NUM(vectorSize) = SIMDf_SET(VECTOR_SIZE);
-	SIMDf_NUM(cubicBounding) = SIMDf_SET(1.f / (1.5f*1.5f*1.5f));
+#define SIMDf_NUM_0 SIMDf_SET_ZERO()
+#define SIMDf_NUM_2 SIMDf_SET(2.0f)
+#define SIMDf_NUM_6 SIMDf_SET(6.0f)
+#define SIMDf_NUM_10 SIMDf_SET(10.0f)
+#define SIMDf_NUM_15 SIMDf_SET(15.0f)
+#define SIMDf_NUM_32 SIMDf_SET(32.0f)
+#define SIMDf_NUM_999999 SIMDf_SET(999999.0f)
+#define SIMDf_NUM__1 SIMDf_SET(-1.0f)
+
+#define SIMDf_NUM_0_5 SIMDf_SET(0.5f)
+#define SIMDf_NUM_0_6 SIMDf_SET(0.6f)
+#define SIMDf_NUM_1_5 SIMDf_SET(1.5f)
+#define SIMDf_NUM_0_8 SIMDf_SET(0.8f)
+#define SIMDf_NUM__0_8 SIMDf_SET(-0.8f)
+#define SIMDf_NUM__0_6 SIMDf_SET(-0.6f)
+#define SIMDf_NUM_0_36 SIMDf_SET(0.36f)
+#define SIMDf_NUM__0_48 SIMDf_SET(-0.48f)
+#define SIMDf_NUM_0_64 SIMDf_SET(0.64f)
+#define SIMDf_NUM_diffStep SIMDf_SET(1.0f / 64.0f)
+#define SIMDf_NUM_invDiffStep SIMDf_SET(64.0f)
+#define SIMDf_NUM_15_5 SIMDf_SET(15.5f)
+#define SIMDf_NUM_255_5 SIMDf_SET(255.5f)
+#define SIMDf_NUM_511_5 SIMDf_SET(511.5f)
+#define SIMDf_NUM_32768_5 SIMDf_SET(32768.5f)
+
+//#define SIMDf_NUM_cellJitter SIMDf_SET(0.39614f)
+#define SIMDf_NUM_F3 SIMDf_SET(1.f / 3.f)
+#define SIMDf_NUM_G3 SIMDf_SET(1.f / 6.f)
+#define SIMDf_NUM_R3 SIMDf_SET(2.f / 3.f)
+#define SIMDf_NUM_G33 SIMDf_SET((3.f / 6.f) - 1.f)
+#define SIMDf_NUM_hash2Float SIMDf_SET(1.f / 2147483648.f)
+#define SIMDf_NUM_vectorSize SIMDf_SET(VECTOR_SIZE)
+#define SIMDf_NUM_cubicBounding SIMDf_SET(1.f / (1.5f*1.5f*1.5f))
 
 #if SIMD_LEVEL == FN_AVX512
-	SIMDf_NUM(X_GRAD) = _mm512_set_ps(0, -1, 0, 1, 0, 0, 0, 0, -1, 1, -1, 1, -1, 1, -1, 1);
-	SIMDf_NUM(Y_GRAD) = _mm512_set_ps(-1, 1, -1, 1, -1, 1, -1, 1, 0, 0, 0, 0, -1, -1, 1, 1);
-	SIMDf_NUM(Z_GRAD) = _mm512_set_ps(-1, 0, 1, 0, -1, -1, 1, 1, -1, -1, 1, 1, 0, 0, 0, 0);
+#define SIMDf_NUM_X_GRAD _mm512_set_ps(0, -1, 0, 1, 0, 0, 0, 0, -1, 1, -1, 1, -1, 1, -1, 1)
+#define SIMDf_NUM_Y_GRAD _mm512_set_ps(-1, 1, -1, 1, -1, 1, -1, 1, 0, 0, 0, 0, -1, -1, 1, 1)
+#define SIMDf_NUM_Z_GRAD _mm512_set_ps(-1, 0, 1, 0, -1, -1, 1, 1, -1, -1, 1, 1, 0, 0, 0, 0)
 
 #else
-	SIMDi_NUM(8) = SIMDi_SET(8);
-	SIMDi_NUM(12) = SIMDi_SET(12);
-	SIMDi_NUM(13) = SIMDi_SET(13);
+#define SIMDi_NUM_8 SIMDi_SET(8)
+#define SIMDi_NUM_12 SIMDi_SET(12)
+#define SIMDi_NUM_13 SIMDi_SET(13)
 #endif
 
-	SIMDi_NUM(1) = SIMDi_SET(1);
-	SIMDi_NUM(2) = SIMDi_SET(2);
-	SIMDi_NUM(255) = SIMDi_SET(255);
-	SIMDi_NUM(60493) = SIMDi_SET(60493);
-	SIMDi_NUM(0x7fffffff) = SIMDi_SET(0x7fffffff);
-
-	//SIMDi_NUM(xGradBits) = SIMDi_SET(1683327112);
-	//SIMDi_NUM(yGradBits) = SIMDi_SET(-2004331104);
-	//SIMDi_NUM(zGradBits) = SIMDi_SET(-1851744171);
-
-	SIMDi_NUM(xPrime) = SIMDi_SET(1619);
-	SIMDi_NUM(yPrime) = SIMDi_SET(31337);
-	SIMDi_NUM(zPrime) = SIMDi_SET(6971);
-	SIMDi_NUM(bit5Mask) = SIMDi_SET(31);
-	SIMDi_NUM(bit10Mask) = SIMDi_SET(1023);
-	SIMDi_NUM(vectorSize) = SIMDi_SET(VECTOR_SIZE);
-
-	SIMDi_NUM(0xffffffff) = SIMDi_SET(-1);
-
-	VAR(SIMD_Values_Set) = true;
-}
+// Lane index, { 0, 1, 2, ... VECTOR_SIZE - 1 }
+#if SIMD_LEVEL == FN_NEON
+static const int32_t VAR(incrementalLanes)[4] = { 0, 1, 2, 3 };
+#define SIMDi_NUM_incremental vld1q_s32(VAR(incrementalLanes))
+#elif SIMD_LEVEL == FN_AVX512
+#define SIMDi_NUM_incremental _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#elif SIMD_LEVEL == FN_AVX2
+#define SIMDi_NUM_incremental _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0)
+#elif SIMD_LEVEL > FN_NO_SIMD_FALLBACK
+#define SIMDi_NUM_incremental _mm_set_epi32(3, 2, 1, 0)
+#else
+#define SIMDi_NUM_incremental 0
+#endif
+#define SIMDi_NUM_1 SIMDi_SET(1)
+#define SIMDi_NUM_2 SIMDi_SET(2)
+#define SIMDi_NUM_255 SIMDi_SET(255)
+#define SIMDi_NUM_60493 SIMDi_SET(60493)
+#define SIMDi_NUM_0x7fffffff SIMDi_SET(0x7fffffff)
+
+//#define SIMDi_NUM_xGradBits SIMDi_SET(1683327112)
+//#define SIMDi_NUM_yGradBits SIMDi_SET(-2004331104)
+//#define SIMDi_NUM_zGradBits SIMDi_SET(-1851744171)
+
+#define SIMDi_NUM_xPrime SIMDi_SET(1619)
+#define SIMDi_NUM_yPrime SIMDi_SET(31337)
+#define SIMDi_NUM_zPrime SIMDi_SET(6971)
+#define SIMDi_NUM_bit5Mask SIMDi_SET(31)
+#define SIMDi_NUM_bit9Mask SIMDi_SET(511)
+#define SIMDi_NUM_bit10Mask SIMDi_SET(1023)
+#define SIMDi_NUM_vectorSize SIMDi_SET(VECTOR_SIZE)
 
 static SIMDf VECTORCALL FUNC(Lerp)(SIMDf a, SIMDf b, SIMDf t)
 {
@@ -950,8 +976,8 @@ static SIMDf VECTORCALL FUNC(OpenSimplex2Single)(SIMDi seed, SIMDf x, SIMDf y, S
 		SIMDf score0yr = SIMDf_ABS(d0yr);
 		SIMDf score0zr = SIMDf_ABS(d0zr);
 		MASK dir0xr = SIMDf_LESS_EQUAL(SIMDf_MAX(score0yr, score0zr), score0xr);
-		MASK dir0yr = SIMDi_AND_NOT(dir0xr, SIMDf_LESS_EQUAL(SIMDf_MAX(score0zr, score0xr), score0yr));
-		MASK dir0zr = SIMDi_NOT(SIMDi_OR(dir0xr, dir0yr));
+		MASK dir0yr = MASK_AND_NOT(dir0xr, SIMDf_LESS_EQUAL(SIMDf_MAX(score0zr, score0xr), score0yr));
+		MASK dir0zr = MASK_NOT(MASK_OR(dir0xr, dir0yr));
 		SIMDf v1xr = SIMDf_ADD(v0xr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0xr, SIMDf_NUM(0))), dir0xr));
 		SIMDf v1yr = SIMDf_ADD(v0yr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0yr, SIMDf_NUM(0))), dir0yr));
 		SIMDf v1zr = SIMDf_ADD(v0zr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0zr, SIMDf_NUM(0))), dir0zr));
@@ -1094,13 +1120,180 @@ static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp,
 	z = SIMDf_MUL_ADD(FUNC(Lerp)(z0y, z1y, zs), perturbAmp, z);
 }
 
+// Peak corner sum is ~1/30 for unit vectors, rescaled from the 9 bit vectors to the +-511.5 range of GradientPerturbSingle
+#define SIMPLEX_PERTURB_BOUNDING (30.f * 511.5f / (255.5f * 255.5f))
+
+// One hash per corner gives a random vector, used both as the gradient and as the direction to displace along
+#define SIMPLEX_PERTURB_CORNER(_t, _xi, _yi, _zi, _xd, _yd, _zd)\
+{\
+	SIMDi hash = FUNC(Hash)(seed, _xi, _yi, _zi);\
+	SIMDf xg = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit9Mask))), SIMDf_NUM(255_5));\
+	SIMDf yg = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash, 9), SIMDi_NUM(bit9Mask))), SIMDf_NUM(255_5));\
+	SIMDf zg = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash, 18), SIMDi_NUM(bit9Mask))), SIMDf_NUM(255_5));\
+	SIMDf t = SIMDf_MAX(_t, SIMDf_NUM(0));\
+	t = SIMDf_MUL(t, t);\
+	t = SIMDf_MUL(SIMDf_MUL(t, t), SIMDf_MUL_ADD(zg, _zd, SIMDf_MUL_ADD(yg, _yd, SIMDf_MUL(xg, _xd))));\
+	xv = SIMDf_MUL_ADD(xg, t, xv);\
+	yv = SIMDf_MUL_ADD(yg, t, yv);\
+	zv = SIMDf_MUL_ADD(zg, t, zv);\
+}
+
+static void VECTORCALL FUNC(SimplexPerturbSingle)(SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency, SIMDf& x, SIMDf& y, SIMDf& z)
+{
+	SIMDf xf = SIMDf_MUL(x, perturbFrequency);
+	SIMDf yf = SIMDf_MUL(y, perturbFrequency);
+	SIMDf zf = SIMDf_MUL(z, perturbFrequency);
+
+	SIMDf f = SIMDf_MUL(SIMDf_NUM(F3), SIMDf_ADD(SIMDf_ADD(xf, yf), zf));
+	SIMDf x0 = SIMDf_FLOOR(SIMDf_ADD(xf, f));
+	SIMDf y0 = SIMDf_FLOOR(SIMDf_ADD(yf, f));
+	SIMDf z0 = SIMDf_FLOOR(SIMDf_ADD(zf, f));
+
+	SIMDi i = SIMDi_MUL(SIMDi_CONVERT_TO_INT(x0), SIMDi_NUM(xPrime));
+	SIMDi j = SIMDi_MUL(SIMDi_CONVERT_TO_INT(y0), SIMDi_NUM(yPrime));
+	SIMDi k = SIMDi_MUL(SIMDi_CONVERT_TO_INT(z0), SIMDi_NUM(zPrime));
+
+	SIMDf g = SIMDf_MUL(SIMDf_NUM(G3), SIMDf_ADD(SIMDf_ADD(x0, y0), z0));
+	x0 = SIMDf_SUB(xf, SIMDf_SUB(x0, g));
+	y0 = SIMDf_SUB(yf, SIMDf_SUB(y0, g));
+	z0 = SIMDf_SUB(zf, SIMDf_SUB(z0, g));
+
+	MASK x0_ge_y0 = SIMDf_GREATER_EQUAL(x0, y0);
+	MASK y0_ge_z0 = SIMDf_GREATER_EQUAL(y0, z0);
+	MASK x0_ge_z0 = SIMDf_GREATER_EQUAL(x0, z0);
+
+	MASK i1 = MASK_AND(x0_ge_y0, x0_ge_z0);
+	MASK j1 = MASK_AND_NOT(x0_ge_y0, y0_ge_z0);
+	MASK k1 = MASK_AND_NOT(x0_ge_z0, MASK_NOT(y0_ge_z0));
+
+	MASK i2 = MASK_OR(x0_ge_y0, x0_ge_z0);
+	MASK j2 = MASK_OR(MASK_NOT(x0_ge_y0), y0_ge_z0);
+	MASK k2 = MASK_NOT(MASK_AND(x0_ge_z0, y0_ge_z0));
+
+	SIMDf x1 = SIMDf_ADD(SIMDf_MASK_SUB(i1, x0, SIMDf_NUM(1)), SIMDf_NUM(G3));
+	SIMDf y1 = SIMDf_ADD(SIMDf_MASK_SUB(j1, y0, SIMDf_NUM(1)), SIMDf_NUM(G3));
+	SIMDf z1 = SIMDf_ADD(SIMDf_MASK_SUB(k1, z0, SIMDf_NUM(1)), SIMDf_NUM(G3));
+	SIMDf x2 = SIMDf_ADD(SIMDf_MASK_SUB(i2, x0, SIMDf_NUM(1)), SIMDf_NUM(F3));
+	SIMDf y2 = SIMDf_ADD(SIMDf_MASK_SUB(j2, y0, SIMDf_NUM(1)), SIMDf_NUM(F3));
+	SIMDf z2 = SIMDf_ADD(SIMDf_MASK_SUB(k2, z0, SIMDf_NUM(1)), SIMDf_NUM(F3));
+	SIMDf x3 = SIMDf_ADD(x0, SIMDf_NUM(G33));
+	SIMDf y3 = SIMDf_ADD(y0, SIMDf_NUM(G33));
+	SIMDf z3 = SIMDf_ADD(z0, SIMDf_NUM(G33));
+
+	SIMDf t0 = SIMDf_NMUL_ADD(z0, z0, SIMDf_NMUL_ADD(y0, y0, SIMDf_NMUL_ADD(x0, x0, SIMDf_NUM(0_6))));
+	SIMDf t1 = SIMDf_NMUL_ADD(z1, z1, SIMDf_NMUL_ADD(y1, y1, SIMDf_NMUL_ADD(x1, x1, SIMDf_NUM(0_6))));
+	SIMDf t2 = SIMDf_NMUL_ADD(z2, z2, SIMDf_NMUL_ADD(y2, y2, SIMDf_NMUL_ADD(x2, x2, SIMDf_NUM(0_6))));
+	SIMDf t3 = SIMDf_NMUL_ADD(z3, z3, SIMDf_NMUL_ADD(y3, y3, SIMDf_NMUL_ADD(x3, x3, SIMDf_NUM(0_6))));
+
+	SIMDf xv = SIMDf_NUM(0);
+	SIMDf yv = SIMDf_NUM(0);
+	SIMDf zv = SIMDf_NUM(0);
+
+	SIMPLEX_PERTURB_CORNER(t0, i, j, k, x0, y0, z0);
+	SIMPLEX_PERTURB_CORNER(t1, SIMDi_MASK_ADD(i1, i, SIMDi_NUM(xPrime)), SIMDi_MASK_ADD(j1, j, SIMDi_NUM(yPrime)), SIMDi_MASK_ADD(k1, k, SIMDi_NUM(zPrime)), x1, y1, z1);
+	SIMPLEX_PERTURB_CORNER(t2, SIMDi_MASK_ADD(i2, i, SIMDi_NUM(xPrime)), SIMDi_MASK_ADD(j2, j, SIMDi_NUM(yPrime)), SIMDi_MASK_ADD(k2, k, SIMDi_NUM(zPrime)), x2, y2, z2);
+	SIMPLEX_PERTURB_CORNER(t3, SIMDi_ADD(i, SIMDi_NUM(xPrime)), SIMDi_ADD(j, SIMDi_NUM(yPrime)), SIMDi_ADD(k, SIMDi_NUM(zPrime)), x3, y3, z3);
+
+	x = SIMDf_MUL_ADD(xv, perturbAmp, x);
+	y = SIMDf_MUL_ADD(yv, perturbAmp, y);
+	z = SIMDf_MUL_ADD(zv, perturbAmp, z);
+}
+
+static void VECTORCALL FUNC(OpenSimplex2PerturbSingle)(SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency, SIMDf& x, SIMDf& y, SIMDf& z)
+{
+	SIMDf xf = SIMDf_MUL(x, perturbFrequency);
+	SIMDf yf = SIMDf_MUL(y, perturbFrequency);
+	SIMDf zf = SIMDf_MUL(z, perturbFrequency);
+
+	SIMDf f = SIMDf_MUL(SIMDf_NUM(R3), SIMDf_ADD(SIMDf_ADD(xf, yf), zf));
+	SIMDf xr = SIMDf_SUB(f, xf);
+	SIMDf yr = SIMDf_SUB(f, yf);
+	SIMDf zr = SIMDf_SUB(f, zf);
+
+	SIMDf xv = SIMDf_NUM(0);
+	SIMDf yv = SIMDf_NUM(0);
+	SIMDf zv = SIMDf_NUM(0);
+
+	for (int i = 0; i < 2; i++)
+	{
+		SIMDf v0xr = SIMDf_FLOOR(SIMDf_ADD(xr, SIMDf_NUM(0_5)));
+		SIMDf v0yr = SIMDf_FLOOR(SIMDf_ADD(yr, SIMDf_NUM(0_5)));
+		SIMDf v0zr = SIMDf_FLOOR(SIMDf_ADD(zr, SIMDf_NUM(0_5)));
+		SIMDf d0xr = SIMDf_SUB(xr, v0xr);
+		SIMDf d0yr = SIMDf_SUB(yr, v0yr);
+		SIMDf d0zr = SIMDf_SUB(zr, v0zr);
+
+		SIMDf score0xr = SIMDf_ABS(d0xr);
+		SIMDf score0yr = SIMDf_ABS(d0yr);
+		SIMDf score0zr = SIMDf_ABS(d0zr);
+		MASK dir0xr = SIMDf_LESS_EQUAL(SIMDf_MAX(score0yr, score0zr), score0xr);
+		MASK dir0yr = MASK_AND_NOT(dir0xr, SIMDf_LESS_EQUAL(SIMDf_MAX(score0zr, score0xr), score0yr));
+		MASK dir0zr = MASK_NOT(MASK_OR(dir0xr, dir0yr));
+		SIMDf v1xr = SIMDf_ADD(v0xr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0xr, SIMDf_NUM(0))), dir0xr));
+		SIMDf v1yr = SIMDf_ADD(v0yr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0yr, SIMDf_NUM(0))), dir0yr));
+		SIMDf v1zr = SIMDf_ADD(v0zr, SIMDf_BLENDV(SIMDf_NUM(0), SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_NUM(_1), SIMDf_LESS_THAN(d0zr, SIMDf_NUM(0))), dir0zr));
+		SIMDf d1xr = SIMDf_SUB(xr, v1xr);
+		SIMDf d1yr = SIMDf_SUB(yr, v1yr);
+		SIMDf d1zr = SIMDf_SUB(zr, v1zr);
+
+		SIMDf t0 = SIMDf_NMUL_ADD(d0zr, d0zr, SIMDf_NMUL_ADD(d0yr, d0yr, SIMDf_NMUL_ADD(d0xr, d0xr, SIMDf_NUM(0_6))));
+		SIMDf t1 = SIMDf_NMUL_ADD(d1zr, d1zr, SIMDf_NMUL_ADD(d1yr, d1yr, SIMDf_NMUL_ADD(d1xr, d1xr, SIMDf_NUM(0_6))));
+
+		SIMPLEX_PERTURB_CORNER(t0,
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v0xr), SIMDi_NUM(xPrime)),
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v0yr), SIMDi_NUM(yPrime)),
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v0zr), SIMDi_NUM(zPrime)),
+			d0xr, d0yr, d0zr);
+		SIMPLEX_PERTURB_CORNER(t1,
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v1xr), SIMDi_NUM(xPrime)),
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v1yr), SIMDi_NUM(yPrime)),
+			SIMDi_MUL(SIMDi_CONVERT_TO_INT(v1zr), SIMDi_NUM(zPrime)),
+			d1xr, d1yr, d1zr);
+
+		if (i == 0) {
+			xr = SIMDf_ADD(xr, SIMDf_NUM(32768_5));
+			yr = SIMDf_ADD(yr, SIMDf_NUM(32768_5));
+			zr = SIMDf_ADD(zr, SIMDf_NUM(32768_5));
+		}
+	}
+
+	x = SIMDf_MUL_ADD(xv, perturbAmp, x);
+	y = SIMDf_MUL_ADD(yv, perturbAmp, y);
+	z = SIMDf_MUL_ADD(zv, perturbAmp, z);
+}
+
 SIMD_LEVEL_CLASS::FASTNOISE_SIMD_CLASS(SIMD_LEVEL)(int seed)
 {
 	m_seed = seed;
-	m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain);
-	m_perturbFractalBounding = CalculateFractalBounding(m_perturbOctaves, m_perturbGain);
-	FUNC(InitSIMDValues)();
-	s_currentSIMDLevel = SIMD_LEVEL;
+	m_simdLevel = SIMD_LEVEL;
+}
+
+SIMD_LEVEL_CLASS::FASTNOISE_SIMD_CLASS(SIMD_LEVEL)(const FastNoiseConfig& config, const FastNoiseOutputTransform* outputTransform, FastNoiseReduction* reduction)
+	: m_outputTransform(outputTransform), m_reduction(reduction)
+{
+	SetConfig(config);
+	m_simdLevel = SIMD_LEVEL;
+}
+
+// The settings are copied into a stack object of this level, the copy is small next to any fill
+void SIMD_LEVEL_CLASS::FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier,
+	const FastNoiseOutputTransform* transform, FastNoiseReduction* reduction) const
+{
+	assert(!reduction || (reduction->histogramBins >= 0 && reduction->histogramBins <= FN_MAX_HISTOGRAM_BINS));
+	assert(!reduction || reduction->histogramBins == 0 || reduction->histogramMax > reduction->histogramMin);
+
+	FASTNOISE_SIMD_CLASS(SIMD_LEVEL) noise(config, transform, reduction);
+	noise.FillNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+}
+
+void SIMD_LEVEL_CLASS::FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset,
+	const FastNoiseOutputTransform* transform, FastNoiseReduction* reduction) const
+{
+	assert(!reduction || (reduction->histogramBins >= 0 && reduction->histogramBins <= FN_MAX_HISTOGRAM_BINS));
+	assert(!reduction || reduction->histogramBins == 0 || reduction->histogramMax > reduction->histogramMin);
+
+	FASTNOISE_SIMD_CLASS(SIMD_LEVEL) noise(config, transform, reduction);
+	noise.FillNoiseSet(noiseSet, vectorSet, xOffset, yOffset, zOffset);
 }
 
 int SIMD_LEVEL_CLASS::AlignedSize(int size)
@@ -1116,15 +1309,31 @@ int SIMD_LEVEL_CLASS::AlignedSize(int size)
 	return size;
 }
 
-float* SIMD_LEVEL_CLASS::GetEmptySet(int size)
-{
-	size = AlignedSize(size);
-
-	float* noiseSet;
-	SIMD_ALLOCATE_SET(noiseSet, size);
+// Fill counters, see FastNoiseStats, compiled out unless FN_ENABLE_STATS is defined
+#ifdef FN_ENABLE_STATS
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define STATS_CYCLES() __rdtsc()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define STATS_CYCLES() __rdtsc()
+#else
+#include <chrono>
+#define STATS_CYCLES() uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())
+#endif
 
-	return noiseSet;
-}
+#define STATS_BEGIN() FastNoiseStats fillStats; uint64_t statsCycles = STATS_CYCLES();
+#define STATS_COUNT(_counter, _count) fillStats._counter += (_count);
+#define STATS_PHASE(_counter) { uint64_t _cycles = STATS_CYCLES(); fillStats._counter += _cycles - statsCycles; statsCycles = _cycles; }
+#define STATS_END(_points) fillStats.fills = 1; fillStats.points = uint64_t(_points); m_stats.Add(fillStats);
+#define STATS_OCTAVES(_count) m_stats.octaves += uint64_t(_count);
+#else
+#define STATS_BEGIN()
+#define STATS_COUNT(_counter, _count)
+#define STATS_PHASE(_counter)
+#define STATS_END(_points)
+#define STATS_OCTAVES(_count)
+#endif
 
 #define AXIS_RESET(_zSize, _start) for (int _i = (_zSize) * (_start); _i < VECTOR_SIZE; _i+=(_zSize)){\
 MASK _zReset = SIMDi_GREATER_THAN(z, zEndV);\
@@ -1142,6 +1351,182 @@ y = SIMDi_MASK_SUB(_yReset, y, ySizeV);}
 #define STORE_LAST_RESULT(_dest, _source) std::memcpy(_dest, &_source, (maxIndex - index) * 4)
 #endif
 
+// SIMD form of FastNoiseOutputTransform::Apply(), the exponent is evaluated per lane so every level gives the same result
+static SIMDf VECTORCALL FUNC(OutputTransform)(SIMDf v, const FastNoiseOutputTransform& transform)
+{
+	// Separate multiply and add like Apply(), SIMDf_MUL_ADD would fuse on FMA levels
+	// This only keeps them apart where the compiler doesn't contract them itself: the AVX2/AVX512 files are built
+	// with -ffp-contract=off, on other FMA targets such as NEON the results only match in FN_DETERMINISTIC builds
+	v = SIMDf_ADD(SIMDf_MUL(v, SIMDf_SET(transform.scale)), SIMDf_SET(transform.bias));
+
+	if (transform.abs)
+		v = SIMDf_ABS(v);
+
+	if (transform.exponent != 1.0f)
+	{
+		uSIMDf lanes;
+		lanes.m = v;
+		for (int i = 0; i < VECTOR_SIZE; i++)
+			lanes.a[i] = std::copysign(std::pow(std::fabs(lanes.a[i]), transform.exponent), lanes.a[i]);
+		v = lanes.m;
+	}
+
+	if (transform.terraceSteps > 0.0f)
+	{
+		float invSmoothness = transform.terraceSmoothness > 0.0f ? 1.0f / transform.terraceSmoothness : 0.0f;
+
+		SIMDf stepped = SIMDf_MUL(v, SIMDf_SET(transform.terraceSteps));
+		SIMDf level = SIMDf_FLOOR(stepped);
+		SIMDf ramp = SIMDf_SUB(SIMDf_SUB(stepped, level), SIMDf_SET(1.0f - transform.terraceSmoothness));
+		ramp = SIMDf_MIN(SIMDf_MUL(SIMDf_MAX(ramp, SIMDf_SET_ZERO()), SIMDf_SET(invSmoothness)), SIMDf_NUM(1));
+		v = SIMDf_MUL(SIMDf_ADD(level, ramp), SIMDf_SET(1.0f / transform.terraceSteps));
+	}
+
+	// Coefficients of every segment the value is past are blended in, the last one wins
+	if (transform.splineSegments > 0)
+	{
+		SIMDf x = SIMDf_MIN(SIMDf_MAX(v, SIMDf_SET(transform.splineX[0])), SIMDf_SET(transform.splineX[transform.splineSegments]));
+		SIMDf x0 = SIMDf_SET(transform.splineX[0]);
+		SIMDf invWidth = SIMDf_SET(transform.splineInvWidth[0]);
+		SIMDf c0 = SIMDf_SET(transform.splineCoefficients[0][0]);
+		SIMDf c1 = SIMDf_SET(transform.splineCoefficients[0][1]);
+		SIMDf c2 = SIMDf_SET(transform.splineCoefficients[0][2]);
+		SIMDf c3 = SIMDf_SET(transform.splineCoefficients[0][3]);
+
+		for (int i = 1; i < transform.splineSegments; i++)
+		{
+			SIMDf xi = SIMDf_SET(transform.splineX[i]);
+			MASK past = SIMDf_GREATER_EQUAL(x, xi);
+
+			x0 = SIMDf_BLENDV(x0, xi, past);
+			invWidth = SIMDf_BLENDV(invWidth, SIMDf_SET(transform.splineInvWidth[i]), past);
+			c0 = SIMDf_BLENDV(c0, SIMDf_SET(transform.splineCoefficients[i][0]), past);
+			c1 = SIMDf_BLENDV(c1, SIMDf_SET(transform.splineCoefficients[i][1]), past);
+			c2 = SIMDf_BLENDV(c2, SIMDf_SET(transform.splineCoefficients[i][2]), past);
+			c3 = SIMDf_BLENDV(c3, SIMDf_SET(transform.splineCoefficients[i][3]), past);
+		}
+
+		SIMDf t = SIMDf_MUL(SIMDf_SUB(x, x0), invWidth);
+		v = SIMDf_ADD(c0, SIMDf_MUL(t, SIMDf_ADD(c1, SIMDf_MUL(t, SIMDf_ADD(c2, SIMDf_MUL(t, c3))))));
+	}
+
+	if (transform.clamp)
+		v = SIMDf_MIN(SIMDf_MAX(v, SIMDf_SET(transform.clampMin)), SIMDf_SET(transform.clampMax));
+
+	return v;
+}
+
+// Only applied on the objects of the const fills given a transform
+#define OUTPUT_TRANSFORM_BEGIN() const FastNoiseOutputTransform* outputTransform = m_outputTransform;
+#define OUTPUT_TRANSFORM(_result) if (outputTransform) _result = FUNC(OutputTransform)(_result, *outputTransform);
+
+// Accumulators of FastNoiseReduction, only updated on the objects of the const fills given a reduction
+// Per lane sums are moved into a double every REDUCTION_FLUSH_VECTORS vectors to keep float precision
+#define REDUCTION_FLUSH_VECTORS 64
+
+#define REDUCTION_BEGIN()\
+FastNoiseReduction* reduction = m_reduction;\
+SIMDf reductionMinV = SIMDf_SET(std::numeric_limits<float>::infinity());\
+SIMDf reductionMaxV = SIMDf_SET(-std::numeric_limits<float>::infinity());\
+SIMDf reductionSumV = SIMDf_SET_ZERO();\
+double reductionSum = 0.0;\
+int reductionVectors = 0;
+
+#define REDUCTION_HISTOGRAM_SCALE (float(reduction->histogramBins) / (reduction->histogramMax - reduction->histogramMin))
+
+#define REDUCTION_FLUSH_SUM()\
+{\
+	uSIMDf _sum;\
+	_sum.m = reductionSumV;\
+	for (int _i = 0; _i < VECTOR_SIZE; _i++)\
+		reductionSum += _sum.a[_i];\
+	reductionSumV = SIMDf_SET_ZERO();\
+	reductionVectors = 0;\
+}
+
+// Bins are found in SIMD, only the counter increments are per lane
+#define REDUCE(_result)\
+if (reduction)\
+{\
+	reductionMinV = SIMDf_MIN(reductionMinV, _result);\
+	reductionMaxV = SIMDf_MAX(reductionMaxV, _result);\
+	reductionSumV = SIMDf_ADD(reductionSumV, _result);\
+	if (++reductionVectors == REDUCTION_FLUSH_VECTORS)\
+		REDUCTION_FLUSH_SUM()\
+	\
+	if (reduction->histogramBins > 0)\
+	{\
+		uSIMDf _bin;\
+		_bin.m = SIMDf_MUL(SIMDf_SUB(_result, SIMDf_SET(reduction->histogramMin)), SIMDf_SET(REDUCTION_HISTOGRAM_SCALE));\
+		_bin.m = SIMDf_MIN(SIMDf_MAX(_bin.m, SIMDf_SET_ZERO()), SIMDf_SET(float(reduction->histogramBins - 1)));\
+		for (int _i = 0; _i < VECTOR_SIZE; _i++)\
+			reduction->histogram[int(_bin.a[_i])]++;\
+	}\
+}
+
+// Only the first _count lanes of a partial vector hold set values
+#define REDUCE_LAST(_result, _count)\
+if (reduction)\
+{\
+	uSIMDf _last;\
+	_last.m = _result;\
+	for (int _i = 0; _i < (_count); _i++)\
+	{\
+		float _value = _last.a[_i];\
+		reduction->min = std::min(reduction->min, _value);\
+		reduction->max = std::max(reduction->max, _value);\
+		reductionSum += _value;\
+		\
+		if (reduction->histogramBins > 0)\
+		{\
+			float _bin = std::min(std::max((_value - reduction->histogramMin) * REDUCTION_HISTOGRAM_SCALE, 0.0f), float(reduction->histogramBins - 1));\
+			reduction->histogram[int(_bin)]++;\
+		}\
+	}\
+}
+
+#define REDUCTION_END(_points)\
+if (reduction)\
+{\
+	REDUCTION_FLUSH_SUM()\
+	uSIMDf _min, _max;\
+	_min.m = reductionMinV;\
+	_max.m = reductionMaxV;\
+	for (int _i = 0; _i < VECTOR_SIZE; _i++)\
+	{\
+		reduction->min = std::min(reduction->min, _min.a[_i]);\
+		reduction->max = std::max(reduction->max, _max.a[_i]);\
+	}\
+	reduction->sum += reductionSum;\
+	reduction->count += uint64_t(_points);\
+}
+
+// The transform is applied to the frequency scaled position, so the matrix becomes F * M * F^-1
+#define INIT_TRANSFORM_VALUES()\
+const bool transformEnabled = m_transformEnabled;\
+SIMDf transform00 = SIMDf_SET(m_transform[0]);\
+SIMDf transform01 = SIMDf_SET(m_transform[1] * m_xScale / m_yScale);\
+SIMDf transform02 = SIMDf_SET(m_transform[2] * m_xScale / m_zScale);\
+SIMDf transform03 = SIMDf_SET(m_transform[3] * m_xScale * m_frequency);\
+SIMDf transform10 = SIMDf_SET(m_transform[4] * m_yScale / m_xScale);\
+SIMDf transform11 = SIMDf_SET(m_transform[5]);\
+SIMDf transform12 = SIMDf_SET(m_transform[6] * m_yScale / m_zScale);\
+SIMDf transform13 = SIMDf_SET(m_transform[7] * m_yScale * m_frequency);\
+SIMDf transform20 = SIMDf_SET(m_transform[8] * m_zScale / m_xScale);\
+SIMDf transform21 = SIMDf_SET(m_transform[9] * m_zScale / m_yScale);\
+SIMDf transform22 = SIMDf_SET(m_transform[10]);\
+SIMDf transform23 = SIMDf_SET(m_transform[11] * m_zScale * m_frequency)
+
+#define TRANSFORM_COORDS()\
+if (transformEnabled)\
+{\
+	SIMDf xT = SIMDf_MUL_ADD(xF, transform00, SIMDf_MUL_ADD(yF, transform01, SIMDf_MUL_ADD(zF, transform02, transform03)));\
+	SIMDf yT = SIMDf_MUL_ADD(xF, transform10, SIMDf_MUL_ADD(yF, transform11, SIMDf_MUL_ADD(zF, transform12, transform13)));\
+	zF = SIMDf_MUL_ADD(xF, transform20, SIMDf_MUL_ADD(yF, transform21, SIMDf_MUL_ADD(zF, transform22, transform23)));\
+	xF = xT;\
+	yF = yT;\
+}
+
 #define INIT_PERTURB_VALUES() \
 SIMDf perturbAmpV, perturbFreqV, perturbLacunarityV, perturbGainV, perturbNormaliseLengthV;\
 switch (m_perturbType)\
@@ -1151,13 +1536,13 @@ case None:\
 case Gradient_Normalise:\
 	perturbNormaliseLengthV = SIMDf_SET(m_perturbNormaliseLength*m_frequency);\
 case Gradient:\
-	perturbAmpV = SIMDf_SET(m_perturbAmp);\
+	perturbAmpV = SIMDf_SET(m_perturbAmp / 511.5f);\
 	perturbFreqV = SIMDf_SET(m_perturbFrequency);\
 	break;\
 case GradientFractal_Normalise:\
 	perturbNormaliseLengthV = SIMDf_SET(m_perturbNormaliseLength*m_frequency);\
 case GradientFractal:\
-	perturbAmpV = SIMDf_SET(m_perturbAmp*m_fractalBounding);\
+	perturbAmpV = SIMDf_SET(m_perturbAmp / 511.5f*m_fractalBounding);\
 	perturbFreqV = SIMDf_SET(m_perturbFrequency);\
 	perturbLacunarityV = SIMDf_SET(m_perturbLacunarity);\
 	perturbGainV = SIMDf_SET(m_perturbGain);\
@@ -1165,23 +1550,27 @@ case GradientFractal:\
 case Normalise:\
 	perturbNormaliseLengthV = SIMDf_SET(m_perturbNormaliseLength*m_frequency);\
 	break;\
+case SimplexGradient:\
+case OpenSimplex2Gradient:\
+	perturbAmpV = SIMDf_SET(m_perturbAmp / 511.5f*SIMPLEX_PERTURB_BOUNDING);\
+	perturbFreqV = SIMDf_SET(m_perturbFrequency);\
+	break;\
+case SimplexGradientFractal:\
+case OpenSimplex2GradientFractal:\
+	perturbAmpV = SIMDf_SET(m_perturbAmp / 511.5f*m_fractalBounding*SIMPLEX_PERTURB_BOUNDING);\
+	perturbFreqV = SIMDf_SET(m_perturbFrequency);\
+	perturbLacunarityV = SIMDf_SET(m_perturbLacunarity);\
+	perturbGainV = SIMDf_SET(m_perturbGain);\
+	break;\
 }
 
-#define PERTURB_SWITCH()\
-switch (m_perturbType)\
+#define PERTURB_FRACTAL(perturbFunc)\
 {\
-case None:\
-	break;\
-case Gradient:\
-	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
-	break; \
-case GradientFractal:\
-	{\
 	SIMDi seedF = SIMDi_SUB(seedV, SIMDi_NUM(1));\
 	SIMDf freqF = perturbFreqV;\
 	SIMDf ampF = perturbAmpV;\
 	\
-	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+	FUNC(perturbFunc##PerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
 	\
 	int octaveIndex = 0;\
 	\
@@ -1191,44 +1580,57 @@ case GradientFractal:\
 		seedF = SIMDi_SUB(seedF, SIMDi_NUM(1));\
 		ampF = SIMDf_MUL(ampF, perturbGainV);\
 		\
-		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
-	}}\
-	break;\
-case Gradient_Normalise:\
-	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
-case Normalise:\
-	{\
-	SIMDf invMag = SIMDf_MUL(perturbNormaliseLengthV, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xF, xF, SIMDf_MUL_ADD(yF, yF, SIMDf_MUL(zF, zF)))));\
-	xF = SIMDf_MUL(xF, invMag);\
-	yF = SIMDf_MUL(yF, invMag);\
-	zF = SIMDf_MUL(zF, invMag);\
-	}break;\
-case GradientFractal_Normalise:\
-	{\
-	SIMDi seedF = SIMDi_SUB(seedV, SIMDi_NUM(1));\
-	SIMDf freqF = perturbFreqV;\
-	SIMDf ampF = perturbAmpV;\
-	\
-	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
-	\
-	int octaveIndex = 0;\
-	\
-	while (++octaveIndex < m_perturbOctaves)\
-	{\
-		freqF = SIMDf_MUL(freqF, perturbLacunarityV);\
-		seedF = SIMDi_SUB(seedF, SIMDi_NUM(1));\
-		ampF = SIMDf_MUL(ampF, perturbGainV);\
-		\
-		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+		FUNC(perturbFunc##PerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
 	}\
+}
+
+#define PERTURB_NORMALISE()\
+{\
 	SIMDf invMag = SIMDf_MUL(perturbNormaliseLengthV, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xF, xF, SIMDf_MUL_ADD(yF, yF, SIMDf_MUL(zF, zF)))));\
 	xF = SIMDf_MUL(xF, invMag);\
 	yF = SIMDf_MUL(yF, invMag);\
 	zF = SIMDf_MUL(zF, invMag);\
-	}break;\
+}
+
+#define PERTURB_SWITCH()\
+switch (m_perturbType)\
+{\
+case None:\
+	break;\
+case Gradient:\
+	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+	break; \
+case GradientFractal:\
+	PERTURB_FRACTAL(Gradient)\
+	break;\
+case Gradient_Normalise:\
+	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+case Normalise:\
+	PERTURB_NORMALISE()\
+	break;\
+case GradientFractal_Normalise:\
+	PERTURB_FRACTAL(Gradient)\
+	PERTURB_NORMALISE()\
+	break;\
+case SimplexGradient:\
+	FUNC(SimplexPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+	break; \
+case SimplexGradientFractal:\
+	PERTURB_FRACTAL(Simplex)\
+	break;\
+case OpenSimplex2Gradient:\
+	FUNC(OpenSimplex2PerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+	break; \
+case OpenSimplex2GradientFractal:\
+	PERTURB_FRACTAL(OpenSimplex2)\
+	break;\
 }
 
 #define SET_BUILDER(f)\
+{\
+STATS_BEGIN()\
+OUTPUT_TRANSFORM_BEGIN()\
+REDUCTION_BEGIN()\
 if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 {\
 	SIMDi yBase = SIMDi_SET(yStart);\
@@ -1251,10 +1653,17 @@ if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 			SIMDf yF = yf;\
 			SIMDf zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);\
 			\
+			TRANSFORM_COORDS()\
 			PERTURB_SWITCH()\
+			STATS_PHASE(positionCycles)\
 			SIMDf result;\
 			f;\
+			STATS_PHASE(noiseCycles)\
+			OUTPUT_TRANSFORM(result)\
 			SIMDf_STORE(&noiseSet[index], result);\
+			REDUCE(result)\
+			STATS_PHASE(storeCycles)\
+			STATS_COUNT(alignedVectors, 1)\
 			\
 			int iz = VECTOR_SIZE;\
 			while (iz < zSize)\
@@ -1266,10 +1675,17 @@ if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 				yF = yf;\
 				zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);\
 				\
+				TRANSFORM_COORDS()\
 				PERTURB_SWITCH()\
+				STATS_PHASE(positionCycles)\
 				SIMDf result;\
 				f;\
+				STATS_PHASE(noiseCycles)\
+				OUTPUT_TRANSFORM(result)\
 				SIMDf_STORE(&noiseSet[index], result);\
+				REDUCE(result)\
+				STATS_PHASE(storeCycles)\
+				STATS_COUNT(alignedVectors, 1)\
 			}\
 			index += VECTOR_SIZE;\
 			y = SIMDi_ADD(y, SIMDi_NUM(1));\
@@ -1299,10 +1715,17 @@ else\
 		SIMDf yF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(y), yFreqV);\
 		SIMDf zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);\
 		\
+		TRANSFORM_COORDS()\
 		PERTURB_SWITCH()\
+		STATS_PHASE(positionCycles)\
 		SIMDf result;\
 		f;\
+		STATS_PHASE(noiseCycles)\
+		OUTPUT_TRANSFORM(result)\
 		SIMDf_STORE(&noiseSet[index], result);\
+		REDUCE(result)\
+		STATS_PHASE(storeCycles)\
+		STATS_COUNT(resetVectors, 1)\
 		\
 		z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));\
 		\
@@ -1313,73 +1736,290 @@ else\
 	SIMDf yF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(y), yFreqV);\
 	SIMDf zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);\
 	\
+	TRANSFORM_COORDS()\
 	PERTURB_SWITCH()\
+	STATS_PHASE(positionCycles)\
 	SIMDf result;\
 	f;\
+	STATS_PHASE(noiseCycles)\
+	OUTPUT_TRANSFORM(result)\
 	STORE_LAST_RESULT(&noiseSet[index], result);\
+	REDUCE_LAST(result, maxIndex - index)\
+	STATS_PHASE(storeCycles)\
+	STATS_COUNT(resetVectors, 1)\
+	STATS_COUNT(tailStores, maxIndex - index < VECTOR_SIZE)\
+}\
+REDUCTION_END(xSize * ySize * zSize)\
+STATS_END(xSize * ySize * zSize)\
+}
+
+// Orthonormal rotation between octaves
+#define FRACTAL_OCTAVE_STEP(_lacunarity)\
+if (fractalRotation)\
+{\
+	SIMDf xR = SIMDf_MUL_ADD(yF, SIMDf_NUM(0_8), SIMDf_MUL(zF, SIMDf_NUM(0_6)));\
+	SIMDf yR = SIMDf_MUL_ADD(xF, SIMDf_NUM(_0_8), SIMDf_MUL_ADD(yF, SIMDf_NUM(0_36), SIMDf_MUL(zF, SIMDf_NUM(_0_48))));\
+	zF = SIMDf_MUL_ADD(xF, SIMDf_NUM(_0_6), SIMDf_MUL_ADD(yF, SIMDf_NUM(_0_48), SIMDf_MUL(zF, SIMDf_NUM(0_64))));\
+	xF = xR;\
+	yF = yR;\
+}\
+xF = SIMDf_MUL(xF, _lacunarity);\
+yF = SIMDf_MUL(yF, _lacunarity);\
+zF = SIMDf_MUL(zF, _lacunarity);
+
+// Per octave values from SetFractalOctaveWeights(), frequencyStep is relative to the previous octave
+struct FractalOctaveWeights
+{
+	SIMDf amplitude[FN_MAX_OCTAVE_WEIGHTS];
+	SIMDf frequencyStep[FN_MAX_OCTAVE_WEIGHTS];
+	SIMDi seedOffset[FN_MAX_OCTAVE_WEIGHTS];
+};
+
+#define INIT_OCTAVE_WEIGHTS()\
+FractalOctaveWeights octaveWeightsData;\
+const FractalOctaveWeights* octaveWeights = nullptr;\
+if (m_octaveWeightCount > 0)\
+{\
+	for (int i = 0; i < m_octaveWeightCount; i++)\
+	{\
+		octaveWeightsData.amplitude[i] = SIMDf_SET(m_octaveAmplitudes[i]);\
+		octaveWeightsData.frequencyStep[i] = SIMDf_SET(i == 0 ? m_octaveFrequencies[0] : m_octaveFrequencies[i] / m_octaveFrequencies[i - 1]);\
+		octaveWeightsData.seedOffset[i] = SIMDi_SET(m_octaveSeedOffsets[i]);\
+	}\
+	octaveWeights = &octaveWeightsData;\
 }
 
-// FBM SINGLE
-#define FBM_SINGLE(f)\
-	SIMDi seedF = seedV;\
+#define FRACTAL_FIRST_OCTAVE()\
+SIMDi seedF = seedV;\
+SIMDf ampF = SIMDf_NUM(1);\
+if (octaveWeights)\
+{\
+	xF = SIMDf_MUL(xF, octaveWeights->frequencyStep[0]);\
+	yF = SIMDf_MUL(yF, octaveWeights->frequencyStep[0]);\
+	zF = SIMDf_MUL(zF, octaveWeights->frequencyStep[0]);\
+	seedF = SIMDi_ADD(seedV, octaveWeights->seedOffset[0]);\
+	ampF = octaveWeights->amplitude[0];\
+}
+
+// Moves position, seed and amplitude on to octaveIndex
+#define FRACTAL_NEXT_OCTAVE()\
+if (octaveWeights)\
+{\
+	FRACTAL_OCTAVE_STEP(octaveWeights->frequencyStep[octaveIndex])\
+	seedF = SIMDi_ADD(seedV, octaveWeights->seedOffset[octaveIndex]);\
+	ampF = octaveWeights->amplitude[octaveIndex];\
+}\
+else\
+{\
+	FRACTAL_OCTAVE_STEP(lacunarityV)\
+	seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
+	ampF = SIMDf_MUL(ampF, gainV);\
+}\
+if (octaveIndex == fadeOctave)\
+	ampF = SIMDf_MUL(ampF, fadeV);
+
+// Anti-aliasing drops the octaves above the Nyquist limit and fades the last one
+#define INIT_FRACTAL_OCTAVES(_antiAliasing, _scaleModifier)\
+int fractalOctaves = GetFractalOctaveCount();\
+int fadeOctave = -1;\
+SIMDf fadeV = SIMDf_NUM(1);\
+if (_antiAliasing)\
+{\
+	float nyquistOctaves = CalculateNyquistOctaves(_scaleModifier);\
+	if (nyquistOctaves < float(fractalOctaves))\
+	{\
+		nyquistOctaves = std::max(nyquistOctaves, 1.0f);\
+		fractalOctaves = int(std::ceil(nyquistOctaves));\
+		float fade = nyquistOctaves - std::floor(nyquistOctaves);\
+		if (fade > 0.0f)\
+		{\
+			fadeOctave = fractalOctaves - 1;\
+			fadeV = SIMDf_SET(fade);\
+		}\
+	}\
+}
+
+// FBM SINGLE
+#define FBM_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
+	\
+	result = SIMDf_MUL(FUNC(f##Single)(seedF, xF, yF, zF), ampF);\
+	\
+	int octaveIndex = 0;\
+	\
+	while (++octaveIndex < fractalOctaves)\
+	{\
+		FRACTAL_NEXT_OCTAVE()\
+		result = SIMDf_MUL_ADD(FUNC(f##Single)(seedF, xF, yF, zF), ampF, result);\
+	}\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+// BILLOW SINGLE
+#define BILLOW_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
+	\
+	result = SIMDf_MUL(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1)), ampF);\
+	\
+	int octaveIndex = 0;\
+	\
+	while (++octaveIndex < fractalOctaves)\
+	{\
+		FRACTAL_NEXT_OCTAVE()\
+		result = SIMDf_MUL_ADD(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1)), ampF, result);\
+	}\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+// RIGIDMULTI SINGLE
+#define RIGIDMULTI_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
+	\
+	result = SIMDf_MUL(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF))), ampF);\
+	\
+	int octaveIndex = 0;\
+	\
+	while (++octaveIndex < fractalOctaves)\
+	{\
+		FRACTAL_NEXT_OCTAVE()\
+		result = SIMDf_NMUL_ADD(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF))), ampF, result);\
+	}
+
+// HYBRIDMULTI SINGLE
+#define HYBRIDMULTI_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
 	\
-	result = FUNC(f##Single)(seedF, xF, yF, zF);\
+	result = SIMDf_MUL(SIMDf_ADD(FUNC(f##Single)(seedF, xF, yF, zF), offsetV), ampF);\
+	SIMDf weightF = result;\
 	\
-	SIMDf ampF = SIMDf_NUM(1);\
 	int octaveIndex = 0;\
 	\
-	while (++octaveIndex < m_octaves)\
+	while (++octaveIndex < fractalOctaves)\
 	{\
-		xF = SIMDf_MUL(xF, lacunarityV);\
-		yF = SIMDf_MUL(yF, lacunarityV);\
-		zF = SIMDf_MUL(zF, lacunarityV);\
-		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
-		\
-		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_MUL_ADD(FUNC(f##Single)(seedF, xF, yF, zF), ampF, result);\
+		FRACTAL_NEXT_OCTAVE()\
+		weightF = SIMDf_MIN(weightF, SIMDf_NUM(1));\
+		SIMDf signalF = SIMDf_MUL(SIMDf_ADD(FUNC(f##Single)(seedF, xF, yF, zF), offsetV), ampF);\
+		result = SIMDf_MUL_ADD(weightF, signalF, result);\
+		weightF = SIMDf_MUL(weightF, signalF);\
 	}\
 	result = SIMDf_MUL(result, fractalBoundingV)
 
-// BILLOW SINGLE
-#define BILLOW_SINGLE(f)\
-	SIMDi seedF = seedV;\
+// HETEROTERRAIN SINGLE
+#define HETEROTERRAIN_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
 	\
-	result = SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1));\
+	result = SIMDf_MUL(SIMDf_ADD(FUNC(f##Single)(seedF, xF, yF, zF), offsetV), ampF);\
 	\
-	SIMDf ampF = SIMDf_NUM(1);\
 	int octaveIndex = 0;\
 	\
-	while (++octaveIndex < m_octaves)\
+	while (++octaveIndex < fractalOctaves)\
 	{\
-		xF = SIMDf_MUL(xF, lacunarityV);\
-		yF = SIMDf_MUL(yF, lacunarityV);\
-		zF = SIMDf_MUL(zF, lacunarityV);\
-		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
-		\
-		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_MUL_ADD(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1)), ampF, result);\
+		FRACTAL_NEXT_OCTAVE()\
+		result = SIMDf_MUL_ADD(SIMDf_MUL(SIMDf_ADD(FUNC(f##Single)(seedF, xF, yF, zF), offsetV), ampF), result, result);\
 	}\
 	result = SIMDf_MUL(result, fractalBoundingV)
 
-// RIGIDMULTI SINGLE
-#define RIGIDMULTI_SINGLE(f)\
-	SIMDi seedF = seedV;\
+// Forward difference slope of the octave, accumulated over octaves and used to damp the octave amplitude
+#define ERODED_OCTAVE(f)\
+{\
+	SIMDf noiseF = FUNC(f##Single)(seedF, xF, yF, zF);\
+	xSlopeF = SIMDf_MUL_ADD(SIMDf_SUB(FUNC(f##Single)(seedF, SIMDf_ADD(xF, SIMDf_NUM(diffStep)), yF, zF), noiseF), SIMDf_NUM(invDiffStep), xSlopeF);\
+	ySlopeF = SIMDf_MUL_ADD(SIMDf_SUB(FUNC(f##Single)(seedF, xF, SIMDf_ADD(yF, SIMDf_NUM(diffStep)), zF), noiseF), SIMDf_NUM(invDiffStep), ySlopeF);\
+	zSlopeF = SIMDf_MUL_ADD(SIMDf_SUB(FUNC(f##Single)(seedF, xF, yF, SIMDf_ADD(zF, SIMDf_NUM(diffStep))), noiseF), SIMDf_NUM(invDiffStep), zSlopeF);\
+	SIMDf slopeSqrF = SIMDf_MUL_ADD(xSlopeF, xSlopeF, SIMDf_MUL_ADD(ySlopeF, ySlopeF, SIMDf_MUL(zSlopeF, zSlopeF)));\
+	result = SIMDf_MUL_ADD(noiseF, SIMDf_DIV(ampF, SIMDf_MUL_ADD(slopeSqrF, erosionV, SIMDf_NUM(1))), result);\
+}
+
+// ERODEDFBM SINGLE
+#define ERODEDFBM_SINGLE(f)\
+	FRACTAL_FIRST_OCTAVE()\
+	SIMDf xSlopeF = SIMDf_SET_ZERO();\
+	SIMDf ySlopeF = SIMDf_SET_ZERO();\
+	SIMDf zSlopeF = SIMDf_SET_ZERO();\
 	\
-	result = SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)));\
+	result = SIMDf_SET_ZERO();\
+	ERODED_OCTAVE(f)\
 	\
-	SIMDf ampF = SIMDf_NUM(1);\
 	int octaveIndex = 0;\
 	\
-	while (++octaveIndex < m_octaves)\
+	while (++octaveIndex < fractalOctaves)\
 	{\
-		xF = SIMDf_MUL(xF, lacunarityV);\
-		yF = SIMDf_MUL(yF, lacunarityV);\
-		zF = SIMDf_MUL(zF, lacunarityV);\
-		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
-		\
-		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_NMUL_ADD(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF))), ampF, result);\
-	}
+		FRACTAL_NEXT_OCTAVE()\
+		ERODED_OCTAVE(f)\
+	}\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+// Sums the octaves [octaveStart, octaveEnd) scaled by bandScaleV, the octaves below octaveStart only step the position
+#define FRACTAL_BAND_SINGLE(_octaveValue, _accumulate)\
+	FRACTAL_FIRST_OCTAVE()\
+	result = SIMDf_SET_ZERO();\
+	\
+	int octaveIndex = 0;\
+	while (true)\
+	{\
+		if (octaveIndex >= octaveStart)\
+		{\
+			SIMDf octaveF = _octaveValue;\
+			_accumulate;\
+		}\
+		if (++octaveIndex >= octaveEnd)\
+			break;\
+		FRACTAL_NEXT_OCTAVE()\
+	}\
+	result = SIMDf_MUL(result, bandScaleV)
+
+#define FBM_BAND_SINGLE(f) FRACTAL_BAND_SINGLE(FUNC(f##Single)(seedF, xF, yF, zF), result = SIMDf_MUL_ADD(octaveF, ampF, result))
+
+#define BILLOW_BAND_SINGLE(f) FRACTAL_BAND_SINGLE(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1)), result = SIMDf_MUL_ADD(octaveF, ampF, result))
+
+// The first RigidMulti octave is added, all others are subtracted
+#define RIGIDMULTI_BAND_SINGLE(f) FRACTAL_BAND_SINGLE(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF))), \
+	if (octaveIndex == 0) result = SIMDf_MUL(octaveF, ampF); else result = SIMDf_NMUL_ADD(octaveF, ampF, result))
+
+#define FILL_FRACTAL_BAND_SET(func)\
+switch(m_fractalType)\
+{\
+case FBM:\
+	SET_BUILDER(FBM_BAND_SINGLE(func))\
+	break;\
+case Billow:\
+	SET_BUILDER(BILLOW_BAND_SINGLE(func))\
+	break;\
+case RigidMulti:\
+	SET_BUILDER(RIGIDMULTI_BAND_SINGLE(func))\
+	break;\
+case HybridMulti:\
+	SET_BUILDER(HYBRIDMULTI_SINGLE(func))\
+	break;\
+case HeteroTerrain:\
+	SET_BUILDER(HETEROTERRAIN_SINGLE(func))\
+	break;\
+case ErodedFBM:\
+	SET_BUILDER(ERODEDFBM_SINGLE(func))\
+	break;\
+}
+
+// Value of the octave before its amplitude, the octaves below only step the position
+#define FRACTAL_OCTAVE_SINGLE(_octaveValue)\
+	FRACTAL_FIRST_OCTAVE()\
+	\
+	for (int octaveIndex = 1; octaveIndex <= octave; octaveIndex++)\
+	{\
+		FRACTAL_NEXT_OCTAVE()\
+	}\
+	result = _octaveValue
+
+#define FILL_FRACTAL_OCTAVE_SET(func)\
+switch(m_fractalType)\
+{\
+case Billow:\
+	SET_BUILDER(FRACTAL_OCTAVE_SINGLE(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(func##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1))))\
+	break;\
+case RigidMulti:\
+	SET_BUILDER(FRACTAL_OCTAVE_SINGLE(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(func##Single)(seedF, xF, yF, zF)))))\
+	break;\
+default:\
+	SET_BUILDER(FRACTAL_OCTAVE_SINGLE(FUNC(func##Single)(seedF, xF, yF, zF)))\
+	break;\
+}
 
 #define FILL_SET(func) \
 void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)\
@@ -1388,6 +2028,7 @@ void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, int xStart, int yStart,
 	SIMD_ZERO_ALL();\
 	SIMDi seedV = SIMDi_SET(m_seed); \
 	INIT_PERTURB_VALUES();\
+	INIT_TRANSFORM_VALUES();\
 	\
 	scaleModifier *= m_frequency;\
 	\
@@ -1410,7 +2051,13 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, int xStart, int y
 	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
 	SIMDf gainV = SIMDf_SET(m_gain);\
 	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);\
+	SIMDf offsetV = SIMDf_SET(m_fractalOffset);\
+	SIMDf erosionV = SIMDf_SET(m_fractalErosion);\
+	const bool fractalRotation = m_fractalRotation;\
+	INIT_FRACTAL_OCTAVES(m_fractalAntiAliasing, scaleModifier);\
+	INIT_OCTAVE_WEIGHTS();\
 	INIT_PERTURB_VALUES();\
+	INIT_TRANSFORM_VALUES();\
 	\
 	scaleModifier *= m_frequency;\
 	\
@@ -1429,7 +2076,17 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, int xStart, int y
 	case RigidMulti:\
 		SET_BUILDER(RIGIDMULTI_SINGLE(func))\
 		break;\
+	case HybridMulti:\
+		SET_BUILDER(HYBRIDMULTI_SINGLE(func))\
+		break;\
+	case HeteroTerrain:\
+		SET_BUILDER(HETEROTERRAIN_SINGLE(func))\
+		break;\
+	case ErodedFBM:\
+		SET_BUILDER(ERODEDFBM_SINGLE(func))\
+		break;\
 	}\
+	STATS_OCTAVES(uint64_t(xSize) * ySize * zSize * fractalOctaves)\
 	SIMD_ZERO_ALL();\
 }
 
@@ -1450,6 +2107,248 @@ FILL_FRACTAL_SET(OpenSimplex2)
 FILL_SET(Cubic)
 FILL_FRACTAL_SET(Cubic)
 
+// Implicit vector sets walk the grid with the same counters as SET_BUILDER
+#define VECTOR_SET_INIT()\
+const FastNoiseVectorSet::Kind vectorSetKind = vectorSet->kind;\
+SIMDf m00 = SIMDf_SET(vectorSet->transform[0]);\
+SIMDf m01 = SIMDf_SET(vectorSet->transform[1]);\
+SIMDf m02 = SIMDf_SET(vectorSet->transform[2]);\
+SIMDf m03 = SIMDf_SET(vectorSet->transform[3]);\
+SIMDf m10 = SIMDf_SET(vectorSet->transform[4]);\
+SIMDf m11 = SIMDf_SET(vectorSet->transform[5]);\
+SIMDf m12 = SIMDf_SET(vectorSet->transform[6]);\
+SIMDf m13 = SIMDf_SET(vectorSet->transform[7]);\
+SIMDf m20 = SIMDf_SET(vectorSet->transform[8]);\
+SIMDf m21 = SIMDf_SET(vectorSet->transform[9]);\
+SIMDf m22 = SIMDf_SET(vectorSet->transform[10]);\
+SIMDf m23 = SIMDf_SET(vectorSet->transform[11]);\
+SIMDf radiusV = SIMDf_SET(vectorSet->radius);\
+\
+int gridSizeZ = vectorSet->gridSizeZ;\
+SIMDi ySizeV = SIMDi_SET(vectorSet->gridSizeY);\
+SIMDi zSizeV = SIMDi_SET(gridSizeZ);\
+SIMDi yEndV = SIMDi_SET(vectorSet->gridSizeY - 1);\
+SIMDi zEndV = SIMDi_SET(gridSizeZ - 1);\
+\
+SIMDi x = SIMDi_SET_ZERO();\
+SIMDi y = SIMDi_SET_ZERO();\
+SIMDi z = SIMDi_NUM(incremental);\
+if (vectorSetKind != FastNoiseVectorSet::Stored)\
+{\
+	AXIS_RESET(gridSizeZ, 1)\
+}
+
+#define VECTOR_SET_POSITION(_index)\
+SIMDf xF, yF, zF;\
+if (vectorSetKind == FastNoiseVectorSet::Stored)\
+{\
+	xF = SIMDf_LOAD(&vectorSet->xSet[_index]);\
+	yF = SIMDf_LOAD(&vectorSet->ySet[_index]);\
+	zF = SIMDf_LOAD(&vectorSet->zSet[_index]);\
+}\
+else\
+{\
+	SIMDf xi = SIMDf_CONVERT_TO_FLOAT(x);\
+	SIMDf yi = SIMDf_CONVERT_TO_FLOAT(y);\
+	SIMDf zi = SIMDf_CONVERT_TO_FLOAT(z);\
+	\
+	xF = SIMDf_MUL_ADD(xi, m00, SIMDf_MUL_ADD(yi, m01, SIMDf_MUL_ADD(zi, m02, m03)));\
+	yF = SIMDf_MUL_ADD(xi, m10, SIMDf_MUL_ADD(yi, m11, SIMDf_MUL_ADD(zi, m12, m13)));\
+	zF = SIMDf_MUL_ADD(xi, m20, SIMDf_MUL_ADD(yi, m21, SIMDf_MUL_ADD(zi, m22, m23)));\
+	\
+	if (vectorSetKind == FastNoiseVectorSet::Sphere)\
+	{\
+		SIMDf magSqr = SIMDf_MUL_ADD(xF, xF, SIMDf_MUL_ADD(yF, yF, SIMDf_MUL(zF, zF)));\
+		SIMDf invMag = SIMDf_INV_SQRT(magSqr);\
+		/* One Newton-Raphson step, the estimate alone is too coarse for planet sized radii */\
+		invMag = SIMDf_MUL(invMag, SIMDf_NMUL_ADD(SIMDf_MUL(magSqr, SIMDf_NUM(0_5)), SIMDf_MUL(invMag, invMag), SIMDf_NUM(1_5)));\
+		invMag = SIMDf_MUL(invMag, radiusV);\
+		xF = SIMDf_MUL(xF, invMag);\
+		yF = SIMDf_MUL(yF, invMag);\
+		zF = SIMDf_MUL(zF, invMag);\
+	}\
+	\
+	z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));\
+	AXIS_RESET(gridSizeZ, 0)\
+}\
+xF = SIMDf_MUL_ADD(xF, xFreqV, xOffsetV);\
+yF = SIMDf_MUL_ADD(yF, yFreqV, yOffsetV);\
+zF = SIMDf_MUL_ADD(zF, zFreqV, zOffsetV);
+
+void SIMD_LEVEL_CLASS::FillFractalBandSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octaveStart, int octaveEnd, float scaleModifier)
+{
+	assert(noiseSet);
+	assert(octaveStart >= 0);
+
+	bool fractal = false;
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+	case PerlinFractal:
+	case SimplexFractal:
+	case OpenSimplex2Fractal:
+	case CubicFractal:
+		fractal = true;
+		break;
+	default:
+		break;
+	}
+
+	octaveEnd = std::min(octaveEnd, fractal ? GetFractalOctaveCount() : 1);
+
+	if (octaveStart >= octaveEnd)
+	{
+		std::memset(noiseSet, 0, sizeof(float) * xSize * ySize * zSize);
+		return;
+	}
+
+	if (!fractal)
+	{
+		FillNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+		return;
+	}
+
+	// Octaves of the multiplicative types depend on the lower octaves, so the band is the difference of two prefix sums
+	bool additive = m_fractalType == FBM || m_fractalType == Billow || m_fractalType == RigidMulti;
+
+	if (!additive && octaveStart > 0)
+	{
+		FillFractalBandSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, 0, octaveEnd, scaleModifier);
+
+		float* lowSet = GetEmptySet(xSize * ySize * zSize);
+		FillFractalBandSet(lowSet, xStart, yStart, zStart, xSize, ySize, zSize, 0, octaveStart, scaleModifier);
+
+		for (int i = 0; i < xSize * ySize * zSize; i++)
+			noiseSet[i] -= lowSet[i];
+
+		FreeNoiseSet(lowSet);
+		return;
+	}
+
+	SIMD_ZERO_ALL();
+
+	SIMDi seedV = SIMDi_SET(m_seed);
+	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);
+	SIMDf gainV = SIMDf_SET(m_gain);
+	SIMDf bandScaleV = SIMDf_SET(m_fractalType == RigidMulti ? 1.0f : m_fractalBounding);
+	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);
+	SIMDf offsetV = SIMDf_SET(m_fractalOffset);
+	SIMDf erosionV = SIMDf_SET(m_fractalErosion);
+	const bool fractalRotation = m_fractalRotation;
+	int fractalOctaves = octaveEnd;
+	int fadeOctave = -1;
+	SIMDf fadeV = SIMDf_NUM(1);
+	INIT_OCTAVE_WEIGHTS();
+	INIT_PERTURB_VALUES();
+	INIT_TRANSFORM_VALUES();
+
+	scaleModifier *= m_frequency;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);
+
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+		FILL_FRACTAL_BAND_SET(Value)
+		break;
+	case PerlinFractal:
+		FILL_FRACTAL_BAND_SET(Perlin)
+		break;
+	case SimplexFractal:
+		FILL_FRACTAL_BAND_SET(Simplex)
+		break;
+	case OpenSimplex2Fractal:
+		FILL_FRACTAL_BAND_SET(OpenSimplex2)
+		break;
+	case CubicFractal:
+		FILL_FRACTAL_BAND_SET(Cubic)
+		break;
+	default:
+		break;
+	}
+	STATS_OCTAVES(uint64_t(xSize) * ySize * zSize * (octaveEnd - octaveStart))
+	SIMD_ZERO_ALL();
+}
+
+void SIMD_LEVEL_CLASS::FillFractalOctaveSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier)
+{
+	assert(noiseSet);
+	assert(octave >= 0);
+
+	bool fractal = false;
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+	case PerlinFractal:
+	case SimplexFractal:
+	case OpenSimplex2Fractal:
+	case CubicFractal:
+		fractal = true;
+		break;
+	default:
+		break;
+	}
+
+	if (!fractal)
+	{
+		if (octave == 0)
+			FillNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+		else
+			std::memset(noiseSet, 0, sizeof(float) * xSize * ySize * zSize);
+		return;
+	}
+
+	assert(octave < GetFractalOctaveCount());
+	SIMD_ZERO_ALL();
+
+	SIMDi seedV = SIMDi_SET(m_seed);
+	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);
+	SIMDf gainV = SIMDf_SET(m_gain);
+	const bool fractalRotation = m_fractalRotation;
+	int fadeOctave = -1;
+	SIMDf fadeV = SIMDf_NUM(1);
+	INIT_OCTAVE_WEIGHTS();
+	INIT_PERTURB_VALUES();
+	INIT_TRANSFORM_VALUES();
+
+	scaleModifier *= m_frequency;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);
+
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+		FILL_FRACTAL_OCTAVE_SET(Value)
+		break;
+	case PerlinFractal:
+		FILL_FRACTAL_OCTAVE_SET(Perlin)
+		break;
+	case SimplexFractal:
+		FILL_FRACTAL_OCTAVE_SET(Simplex)
+		break;
+	case OpenSimplex2Fractal:
+		FILL_FRACTAL_OCTAVE_SET(OpenSimplex2)
+		break;
+	case CubicFractal:
+		FILL_FRACTAL_OCTAVE_SET(Cubic)
+		break;
+	default:
+		break;
+	}
+	STATS_OCTAVES(uint64_t(xSize) * ySize * zSize)
+	SIMD_ZERO_ALL();
+}
+
+void SIMD_LEVEL_CLASS::FillFractalOctaveSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier) const
+{
+	FASTNOISE_SIMD_CLASS(SIMD_LEVEL) noise(config);
+	noise.FillFractalOctaveSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, octave, scaleModifier);
+}
+
 #ifdef FN_ALIGNED_SETS
 #define SIZE_MASK
 #define SAFE_LAST(f)
@@ -1460,34 +2359,58 @@ if (loopMax != vectorSet->size)\
 {\
 	std::size_t remaining = (vectorSet->size - loopMax) * 4;\
 	\
-	SIMDf xF = SIMDf_LOAD(&vectorSet->xSet[loopMax]);\
-	SIMDf yF = SIMDf_LOAD(&vectorSet->ySet[loopMax]);\
-	SIMDf zF = SIMDf_LOAD(&vectorSet->zSet[loopMax]);\
-	\
-	xF = SIMDf_MUL_ADD(xF, xFreqV, xOffsetV);\
-	yF = SIMDf_MUL_ADD(yF, yFreqV, yOffsetV);\
-	zF = SIMDf_MUL_ADD(zF, zFreqV, zOffsetV);\
+	VECTOR_SET_POSITION(loopMax)\
 	\
+	TRANSFORM_COORDS()\
+	PERTURB_SWITCH()\
+	STATS_PHASE(positionCycles)\
 	SIMDf result;\
 	f;\
+	STATS_PHASE(noiseCycles)\
+	OUTPUT_TRANSFORM(result)\
 	std::memcpy(&noiseSet[index], &result, remaining);\
+	REDUCE_LAST(result, vectorSet->size - loopMax)\
+	STATS_PHASE(storeCycles)\
+	STATS_COUNT(vectorSetVectors, 1)\
+	STATS_COUNT(tailStores, 1)\
 }
 #endif
 
 #define VECTOR_SET_BUILDER(f)\
-while (index < loopMax)\
 {\
-	SIMDf xF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->xSet[index]), xFreqV, xOffsetV);\
-	SIMDf yF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->ySet[index]), yFreqV, yOffsetV);\
-	SIMDf zF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->zSet[index]), zFreqV, zOffsetV);\
+	STATS_BEGIN()\
+	OUTPUT_TRANSFORM_BEGIN()\
+	REDUCTION_BEGIN()\
+	VECTOR_SET_INIT()\
 	\
-	PERTURB_SWITCH()\
-	SIMDf result;\
-	f;\
-	SIMDf_STORE(&noiseSet[index], result);\
-	index += VECTOR_SIZE;\
-}\
-SAFE_LAST(f)
+	while (index < loopMax)\
+	{\
+		VECTOR_SET_POSITION(index)\
+		\
+		TRANSFORM_COORDS()\
+		PERTURB_SWITCH()\
+		STATS_PHASE(positionCycles)\
+		SIMDf result;\
+		f;\
+		STATS_PHASE(noiseCycles)\
+		OUTPUT_TRANSFORM(result)\
+		SIMDf_STORE(&noiseSet[index], result);\
+		if (index + VECTOR_SIZE <= vectorSet->size)\
+		{\
+			REDUCE(result)\
+		}\
+		else\
+		{\
+			REDUCE_LAST(result, vectorSet->size - index)\
+		}\
+		STATS_PHASE(storeCycles)\
+		STATS_COUNT(vectorSetVectors, 1)\
+		index += VECTOR_SIZE;\
+	}\
+	SAFE_LAST(f)\
+	REDUCTION_END(vectorSet->size)\
+	STATS_END(vectorSet->size)\
+}
 
 #define FILL_VECTOR_SET(func)\
 void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)\
@@ -1505,6 +2428,7 @@ void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, FastNoiseVectorSet* vect
 	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
 	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
 	INIT_PERTURB_VALUES();\
+	INIT_TRANSFORM_VALUES();\
 	\
 	int index = 0;\
 	int loopMax = vectorSet->size SIZE_MASK;\
@@ -1525,6 +2449,11 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
 	SIMDf gainV = SIMDf_SET(m_gain);\
 	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);\
+	SIMDf offsetV = SIMDf_SET(m_fractalOffset);\
+	SIMDf erosionV = SIMDf_SET(m_fractalErosion);\
+	const bool fractalRotation = m_fractalRotation;\
+	INIT_FRACTAL_OCTAVES(false, 1.0f);\
+	INIT_OCTAVE_WEIGHTS();\
 	SIMDf xFreqV = SIMDf_SET(m_frequency * m_xScale);\
 	SIMDf yFreqV = SIMDf_SET(m_frequency * m_yScale);\
 	SIMDf zFreqV = SIMDf_SET(m_frequency * m_zScale);\
@@ -1532,6 +2461,7 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
 	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
 	INIT_PERTURB_VALUES();\
+	INIT_TRANSFORM_VALUES();\
 	\
 	int index = 0;\
 	int loopMax = vectorSet->size SIZE_MASK;\
@@ -1547,7 +2477,17 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 	case RigidMulti:\
 		VECTOR_SET_BUILDER(RIGIDMULTI_SINGLE(func))\
 		break;\
+	case HybridMulti:\
+		VECTOR_SET_BUILDER(HYBRIDMULTI_SINGLE(func))\
+		break;\
+	case HeteroTerrain:\
+		VECTOR_SET_BUILDER(HETEROTERRAIN_SINGLE(func))\
+		break;\
+	case ErodedFBM:\
+		VECTOR_SET_BUILDER(ERODEDFBM_SINGLE(func))\
+		break;\
 	}\
+	STATS_OCTAVES(uint64_t(vectorSet->size) * fractalOctaves)\
 	SIMD_ZERO_ALL();\
 }
 
@@ -1573,6 +2513,8 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 	assert(noiseSet);
 	SIMD_ZERO_ALL();
 	SIMDi seedV = SIMDi_SET(m_seed);
+	OUTPUT_TRANSFORM_BEGIN()
+	REDUCTION_BEGIN()
 
 	if ((zSize & (VECTOR_SIZE - 1)) == 0)
 	{
@@ -1592,7 +2534,10 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 			{
 				SIMDi z = zBase;
 
-				SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, x, y, z));
+				SIMDf result = FUNC(ValCoord)(seedV, x, y, z);
+				OUTPUT_TRANSFORM(result)
+				SIMDf_STORE(&noiseSet[index], result);
+				REDUCE(result)
 
 				int iz = VECTOR_SIZE;
 				while (iz < zSize)
@@ -1601,7 +2546,10 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 					index += VECTOR_SIZE;
 					iz += VECTOR_SIZE;
 
-					SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, x, y, z));
+					result = FUNC(ValCoord)(seedV, x, y, z);
+					OUTPUT_TRANSFORM(result)
+					SIMDf_STORE(&noiseSet[index], result);
+					REDUCE(result)
 				}
 				index += VECTOR_SIZE;
 				y = SIMDi_ADD(y, SIMDi_NUM(yPrime));
@@ -1627,15 +2575,21 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 
 		for (; index < maxIndex - VECTOR_SIZE; index += VECTOR_SIZE)
 		{
-			SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, SIMDi_MUL(x, SIMDi_NUM(xPrime)), SIMDi_MUL(y, SIMDi_NUM(yPrime)), SIMDi_MUL(z, SIMDi_NUM(zPrime))));
+			SIMDf result = FUNC(ValCoord)(seedV, SIMDi_MUL(x, SIMDi_NUM(xPrime)), SIMDi_MUL(y, SIMDi_NUM(yPrime)), SIMDi_MUL(z, SIMDi_NUM(zPrime)));
+			OUTPUT_TRANSFORM(result)
+			SIMDf_STORE(&noiseSet[index], result);
+			REDUCE(result)
 
 			z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));
 
 			AXIS_RESET(zSize, 0);
 		}
 		SIMDf result = FUNC(ValCoord)(seedV, SIMDi_MUL(x, SIMDi_NUM(xPrime)), SIMDi_MUL(y, SIMDi_NUM(yPrime)), SIMDi_MUL(z, SIMDi_NUM(zPrime)));
+		OUTPUT_TRANSFORM(result)
 		STORE_LAST_RESULT(&noiseSet[index], result);
+		REDUCE_LAST(result, maxIndex - index)
 	}
+	REDUCTION_END(xSize * ySize * zSize)
 	SIMD_ZERO_ALL();
 }
 
@@ -1718,13 +2672,23 @@ struct NoiseLookupSettings
 	SIMDf fractalLacunarity;
 	SIMDf fractalGain;
 	SIMDf fractalBounding;
+	SIMDf fractalOffset;
+	SIMDf fractalErosion;
+	bool fractalRotation;
+	const FractalOctaveWeights* octaveWeights;
 };
 
 #define CELLULAR_LOOKUP_FRACTAL_VALUE(noiseType){\
 SIMDf lacunarityV = noiseLookupSettings.fractalLacunarity;\
 SIMDf gainV = noiseLookupSettings.fractalGain;\
 SIMDf fractalBoundingV = noiseLookupSettings.fractalBounding;\
-int m_octaves = noiseLookupSettings.fractalOctaves;\
+SIMDf offsetV = noiseLookupSettings.fractalOffset;\
+SIMDf erosionV = noiseLookupSettings.fractalErosion;\
+const bool fractalRotation = noiseLookupSettings.fractalRotation;\
+const FractalOctaveWeights* octaveWeights = noiseLookupSettings.octaveWeights;\
+int fractalOctaves = noiseLookupSettings.fractalOctaves;\
+int fadeOctave = -1;\
+SIMDf fadeV = SIMDf_NUM(1);\
 switch(noiseLookupSettings.fractalType)\
 {\
 	case FastNoiseSIMD::FBM:\
@@ -1736,6 +2700,15 @@ switch(noiseLookupSettings.fractalType)\
 	case FastNoiseSIMD::RigidMulti:\
 		{RIGIDMULTI_SINGLE(noiseType);}\
 		break;\
+	case FastNoiseSIMD::HybridMulti:\
+		{HYBRIDMULTI_SINGLE(noiseType);}\
+		break;\
+	case FastNoiseSIMD::HeteroTerrain:\
+		{HETEROTERRAIN_SINGLE(noiseType);}\
+		break;\
+	case FastNoiseSIMD::ErodedFBM:\
+		{ERODEDFBM_SINGLE(noiseType);}\
+		break;\
 }}\
 
 #define CELLULAR_LOOKUP_SINGLE(distanceFunc)\
@@ -2045,6 +3018,7 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 	SIMD_ZERO_ALL();
 	SIMDi seedV = SIMDi_SET(m_seed);
 	INIT_PERTURB_VALUES();
+	INIT_TRANSFORM_VALUES();
 
 	scaleModifier *= m_frequency;
 
@@ -2054,6 +3028,7 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
 
 	NoiseLookupSettings nls;
+	INIT_OCTAVE_WEIGHTS();
 
 	switch (m_cellularReturnType)
 	{
@@ -2085,10 +3060,14 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 		nls.type = m_cellularNoiseLookupType;
 		nls.frequency = SIMDf_SET(m_cellularNoiseLookupFrequency);
 		nls.fractalType = m_fractalType;
-		nls.fractalOctaves = m_octaves;
+		nls.fractalOctaves = GetFractalOctaveCount();
 		nls.fractalLacunarity = SIMDf_SET(m_lacunarity);
 		nls.fractalGain = SIMDf_SET(m_gain);
 		nls.fractalBounding = SIMDf_SET(m_fractalBounding);
+		nls.fractalRotation = m_fractalRotation;
+		nls.octaveWeights = octaveWeights;
+		nls.fractalOffset = SIMDf_SET(m_fractalOffset);
+		nls.fractalErosion = SIMDf_SET(m_fractalErosion);
 
 		switch (m_cellularDistanceFunction)
 		{
@@ -2151,10 +3130,12 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vect
 	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);
 	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
 	INIT_PERTURB_VALUES();
+	INIT_TRANSFORM_VALUES();
 
 	int index = 0;
 	int loopMax = vectorSet->size SIZE_MASK;
 	NoiseLookupSettings nls;
+	INIT_OCTAVE_WEIGHTS();
 
 	switch (m_cellularReturnType)
 	{
@@ -2186,10 +3167,14 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vect
 		nls.type = m_cellularNoiseLookupType;
 		nls.frequency = SIMDf_SET(m_cellularNoiseLookupFrequency);
 		nls.fractalType = m_fractalType;
-		nls.fractalOctaves = m_octaves;
+		nls.fractalOctaves = GetFractalOctaveCount();
 		nls.fractalLacunarity = SIMDf_SET(m_lacunarity);
 		nls.fractalGain = SIMDf_SET(m_gain);
 		nls.fractalBounding = SIMDf_SET(m_fractalBounding);
+		nls.fractalRotation = m_fractalRotation;
+		nls.octaveWeights = octaveWeights;
+		nls.fractalOffset = SIMDf_SET(m_fractalOffset);
+		nls.fractalErosion = SIMDf_SET(m_fractalErosion);
 
 		switch (m_cellularDistanceFunction)
 		{
@@ -2360,7 +3345,8 @@ void SIMD_LEVEL_CLASS::FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet*
 
 	int sampleScale = vectorSet->sampleScale;
 
-	if (sampleScale <= 0)
+	// Implicit sets have no sample lattice, every position is filled
+	if (sampleScale <= 0 || vectorSet->kind != FastNoiseVectorSet::Stored)
 	{
 		FillNoiseSet(noiseSet, vectorSet, xOffset, yOffset, zOffset);
 		return;
@@ -2493,5 +3479,222 @@ void SIMD_LEVEL_CLASS::FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet*
 	SIMD_ZERO_ALL();
 }
 
+// Compressed volume bricks, see FastNoiseSIMD_volume.h
+// Every lane is its own delta chain, so each row of a block decodes as whole vectors
+static_assert(FN_VOLUME_BLOCK_LANES % VECTOR_SIZE == 0, "Volume block rows must be whole vectors");
+
+// Shifts by a count only known at run time, NEON shifts right with a negative left shift
+#if SIMD_LEVEL == FN_NEON
+#define SIMDi_SHIFT_R_BY(a,b) SIMDi_VSHIFT_L(a,SIMDi_SET(-(b)))
+#define SIMDi_SHIFT_L_BY(a,b) SIMDi_VSHIFT_L(a,SIMDi_SET(b))
+#else
+#define SIMDi_SHIFT_R_BY(a,b) SIMDi_SHIFT_R(a,b)
+#define SIMDi_SHIFT_L_BY(a,b) SIMDi_SHIFT_L(a,b)
+#endif
+
+static void FUNC(DecodeVolumeBlocks)(const uint8_t* widths, const uint32_t* words, int count, float min, float step, float* values)
+{
+	const int rowVectors = FN_VOLUME_BLOCK_LANES / VECTOR_SIZE;
+	const int* blockWords = reinterpret_cast<const int*>(words);
+	SIMDf minV = SIMDf_SET(min);
+	SIMDf stepV = SIMDf_SET(step);
+
+	// Quantized values of the last row
+	SIMDi q[rowVectors];
+	for (int v = 0; v < rowVectors; v++)
+		q[v] = SIMDi_SET_ZERO();
+
+	for (int blockStart = 0; blockStart < count; blockStart += FN_VOLUME_BLOCK_LANES * FN_VOLUME_BLOCK_ROWS)
+	{
+		int width = *widths++;
+		int rows = std::min((count - blockStart + FN_VOLUME_BLOCK_LANES - 1) / FN_VOLUME_BLOCK_LANES, FN_VOLUME_BLOCK_ROWS);
+		SIMDi widthMask = SIMDi_SET(int((uint64_t(1) << width) - 1));
+
+		for (int row = 0; row < rows; row++)
+		{
+			const int* rowWords = blockWords + (row * width / 32) * FN_VOLUME_BLOCK_LANES;
+			int shift = row * width % 32;
+			int rowStart = blockStart + row * FN_VOLUME_BLOCK_LANES;
+
+			for (int v = 0; v < rowVectors; v++)
+			{
+				SIMDi zigzag = SIMDi_SET_ZERO();
+				if (width > 0)
+				{
+					zigzag = SIMDi_SHIFT_R_BY(SIMDi_LOADU(rowWords + v * VECTOR_SIZE), shift);
+
+					// Values split over two words, the arithmetic shift filled the bits above the low part with the sign
+					if (shift + width > 32)
+						zigzag = SIMDi_OR(SIMDi_AND(zigzag, SIMDi_SET((1 << (32 - shift)) - 1)),
+							SIMDi_SHIFT_L_BY(SIMDi_LOADU(rowWords + FN_VOLUME_BLOCK_LANES + v * VECTOR_SIZE), 32 - shift));
+
+					zigzag = SIMDi_AND(zigzag, widthMask);
+				}
+
+				q[v] = SIMDi_ADD(q[v], SIMDi_XOR(SIMDi_SHIFT_R(zigzag, 1), SIMDi_SUB(SIMDi_SET_ZERO(), SIMDi_AND(zigzag, SIMDi_NUM(1)))));
+				SIMDf value = SIMDf_ADD(minV, SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(q[v]), stepV));
+
+				// The last row of a brick may end part way through a vector
+				int index = rowStart + v * VECTOR_SIZE;
+				if (index + VECTOR_SIZE <= count)
+				{
+					SIMDf_STOREU(values + index, value);
+				}
+				else if (index < count)
+				{
+					uSIMDf partial;
+					partial.m = value;
+					std::memcpy(values + index, partial.a, (count - index) * sizeof(float));
+				}
+			}
+		}
+
+		blockWords += FN_VOLUME_BLOCK_LANES * ((rows * width + 31) / 32);
+	}
+}
+
+// Loads and stores of the first count lanes, for the ends of rows that aren't whole vectors
+static SIMDf VECTORCALL FUNC(LOAD_PARTIAL)(const float* p, int count)
+{
+	if (count == VECTOR_SIZE)
+		return SIMDf_LOADU(p);
+
+	uSIMDf partial;
+	partial.m = SIMDf_SET_ZERO();
+	std::memcpy(partial.a, p, count * sizeof(float));
+	return partial.m;
+}
+
+static void VECTORCALL FUNC(STORE_PARTIAL)(float* p, SIMDf a, int count)
+{
+	if (count == VECTOR_SIZE)
+	{
+		SIMDf_STOREU(p, a);
+		return;
+	}
+
+	uSIMDf partial;
+	partial.m = a;
+	std::memcpy(p, partial.a, count * sizeof(float));
+}
+
+// Surface nets classification, see FastNoiseMesher
+static void FUNC(ClassifyDensityRow)(const float* density, uint8_t* inside, int count, float isoLevel)
+{
+	SIMDf isoLevelV = SIMDf_SET(isoLevel);
+
+	for (int i = 0; i < count; i += VECTOR_SIZE)
+	{
+		int lanes = std::min(VECTOR_SIZE, count - i);
+		uSIMDi sides;
+		sides.m = SIMDi_MASK_ADD(SIMDf_GREATER_THAN(FUNC(LOAD_PARTIAL)(density + i, lanes), isoLevelV), SIMDi_SET_ZERO(), SIMDi_NUM(1));
+
+		for (int lane = 0; lane < lanes; lane++)
+			inside[i + lane] = uint8_t(sides.a[lane]);
+	}
+}
+
+// Bytes are 0 or 1, so shifting whole int lanes never carries into the next byte
+static SIMDi VECTORCALL FUNC(CellMasks)(const uint8_t* r00, const uint8_t* r01, const uint8_t* r10, const uint8_t* r11)
+{
+#define CELL_CORNERS(_row, _offset) SIMDi_LOADU(reinterpret_cast<const int*>(_row + _offset))
+	SIMDi masks = SIMDi_OR(CELL_CORNERS(r00, 0), SIMDi_SHIFT_L(CELL_CORNERS(r00, 1), 1));
+	masks = SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r01, 0), 2));
+	masks = SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r01, 1), 3));
+	masks = SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r10, 0), 4));
+	masks = SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r10, 1), 5));
+	masks = SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r11, 0), 6));
+	return SIMDi_OR(masks, SIMDi_SHIFT_L(CELL_CORNERS(r11, 1), 7));
+#undef CELL_CORNERS
+}
+
+static void FUNC(CellMaskRow)(const uint8_t* r00, const uint8_t* r01, const uint8_t* r10, const uint8_t* r11, uint8_t* masks, int count)
+{
+	const int vectorBytes = VECTOR_SIZE * int(sizeof(int));
+	int i = 0;
+
+	for (; i + vectorBytes <= count; i += vectorBytes)
+		SIMDi_STOREU(reinterpret_cast<int*>(masks + i), FUNC(CellMasks)(r00 + i, r01 + i, r10 + i, r11 + i));
+
+	if (i == count)
+		return;
+
+	// The end of the row goes through zero padded copies
+	uint8_t rows[4][VECTOR_SIZE * sizeof(int) + 1] = {};
+	const uint8_t* sources[4] = { r00, r01, r10, r11 };
+	for (int r = 0; r < 4; r++)
+		std::memcpy(rows[r], sources[r] + i, count - i + 1);
+
+	uSIMDi tail;
+	tail.m = FUNC(CellMasks)(rows[0], rows[1], rows[2], rows[3]);
+	std::memcpy(masks + i, tail.a, count - i);
+}
+
+// Height map products, see FastNoiseHeightmapBaker::Derive()
+// The normal of a height field is (-gx, -gy, 1) / length, its octahedral form only needs the L1 norm so no square root
+// The surface faces up, the lower hemisphere fold of EncodeNormal() is never needed
+static void FUNC(DeriveHeightRow)(const float* low, const float* row, const float* high, int count, float heightScale, float gradientScale, float curvatureScale,
+	float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures)
+{
+	static_assert(sizeof(FastNoisePackedNormal) == sizeof(int), "Packed normals are stored as one int lane each");
+
+	SIMDf heightScaleV = SIMDf_SET(heightScale);
+	SIMDf gradientScaleV = SIMDf_SET(gradientScale);
+	SIMDf curvatureScaleV = SIMDf_SET(curvatureScale);
+	SIMDf snormScaleV = SIMDf_SET(32767.0f);
+
+	for (int y = 0; y < count; y += VECTOR_SIZE)
+	{
+		int lanes = std::min(VECTOR_SIZE, count - y);
+		SIMDf h = FUNC(LOAD_PARTIAL)(row + y + 1, lanes);
+		SIMDf hLow = FUNC(LOAD_PARTIAL)(low + y + 1, lanes);
+		SIMDf hHigh = FUNC(LOAD_PARTIAL)(high + y + 1, lanes);
+		SIMDf hDown = FUNC(LOAD_PARTIAL)(row + y, lanes);
+		SIMDf hUp = FUNC(LOAD_PARTIAL)(row + y + 2, lanes);
+
+		SIMDf gx = SIMDf_MUL(SIMDf_SUB(hHigh, hLow), gradientScaleV);
+		SIMDf gy = SIMDf_MUL(SIMDf_SUB(hUp, hDown), gradientScaleV);
+
+		if (heights)
+			FUNC(STORE_PARTIAL)(heights + y, SIMDf_MUL(h, heightScaleV), lanes);
+
+		if (normals)
+		{
+			SIMDf inv = SIMDf_DIV(SIMDf_NUM(1), SIMDf_ADD(SIMDf_ADD(SIMDf_ABS(gx), SIMDf_ABS(gy)), SIMDf_NUM(1)));
+			SIMDi u = SIMDi_CONVERT_TO_INT(SIMDf_MUL(SIMDf_MUL(SIMDf_SUB(SIMDf_NUM(0), gx), inv), snormScaleV));
+			SIMDi v = SIMDi_CONVERT_TO_INT(SIMDf_MUL(SIMDf_MUL(SIMDf_SUB(SIMDf_NUM(0), gy), inv), snormScaleV));
+
+			// u is the low half of each normal on little endian targets
+			uSIMDi packed;
+			packed.m = SIMDi_OR(SIMDi_AND(u, SIMDi_SET(0xffff)), SIMDi_SHIFT_L(v, 16));
+
+			if (lanes == VECTOR_SIZE)
+				SIMDi_STOREU(reinterpret_cast<int*>(normals + y), packed.m);
+			else
+				std::memcpy(normals + y, packed.a, lanes * sizeof(FastNoisePackedNormal));
+		}
+
+		if (slopes)
+			FUNC(STORE_PARTIAL)(slopes + y, SIMDf_SQRT(SIMDf_ADD(SIMDf_MUL(gx, gx), SIMDf_MUL(gy, gy))), lanes);
+
+		if (curvatures)
+		{
+			SIMDf sum = SIMDf_ADD(SIMDf_ADD(hLow, hHigh), SIMDf_ADD(hDown, hUp));
+			FUNC(STORE_PARTIAL)(curvatures + y, SIMDf_MUL(SIMDf_SUB(sum, SIMDf_MUL(h, SIMDf_SET(4.0f))), curvatureScaleV), lanes);
+		}
+	}
+}
+
+namespace FastNoiseSIMD_internal
+{
+	const FastNoiseKernels FASTNOISE_SIMD_KERNELS(SIMD_LEVEL) =
+	{
+		FUNC(DecodeVolumeBlocks),
+		FUNC(ClassifyDensityRow),
+		FUNC(CellMaskRow),
+		FUNC(DeriveHeightRow),
+	};
+}
+
 #undef SIMD_LEVEL
 #endif
@@ -37,12 +37,18 @@ namespace FastNoiseSIMD_internal
 	class FASTNOISE_SIMD_CLASS(SIMD_LEVEL_H) : public FastNoiseSIMD
 	{
 	public:
-		// Do not call this, use SetSIMDLevel(int) to have NewFastNoiseSIMD() return the level you want
+		// Do not call this, use NewFastNoiseSIMDAtLevel() to create the level you want
 		FASTNOISE_SIMD_CLASS(SIMD_LEVEL_H)(int seed = 1337);
+		explicit FASTNOISE_SIMD_CLASS(SIMD_LEVEL_H)(const FastNoiseConfig& config, const FastNoiseOutputTransform* outputTransform = nullptr, FastNoiseReduction* reduction = nullptr);
 
-		static float* GetEmptySet(int size);
 		static int AlignedSize(int size);
 
+		using FastNoiseSIMD::FillNoiseSet;
+		void FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f,
+			const FastNoiseOutputTransform* transform = nullptr, FastNoiseReduction* reduction = nullptr) const override;
+		void FillNoiseSet(const FastNoiseConfig& config, float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f,
+			const FastNoiseOutputTransform* transform = nullptr, FastNoiseReduction* reduction = nullptr) const override;
+
 		void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale) override;
 		void FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
 
@@ -76,6 +82,14 @@ namespace FastNoiseSIMD_internal
 		void FillCubicFractalSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillCubicSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
 		void FillCubicFractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
+
+		void FillFractalBandSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octaveStart, int octaveEnd, float scaleModifier = 1.0f) override;
+		void FillFractalOctaveSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier = 1.0f) override;
+		void FillFractalOctaveSet(const FastNoiseConfig& config, float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int octave, float scaleModifier = 1.0f) const override;
+	private:
+		// Only set on the objects the const fills create for a single fill
+		const FastNoiseOutputTransform* const m_outputTransform = nullptr;
+		FastNoiseReduction* const m_reduction = nullptr;
 	};
 }
 #undef SIMD_LEVEL_H
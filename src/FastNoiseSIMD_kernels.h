@@ -0,0 +1,73 @@
+// FastNoiseSIMD_kernels.h
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#ifndef FASTNOISE_SIMD_KERNELS_H
+#define FASTNOISE_SIMD_KERNELS_H
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+struct FastNoisePackedNormal;
+
+// Loops of the volume codec, FastNoiseMesher and FastNoiseHeightmapBaker that run at a SIMD level without a noise object, one table per compiled level
+struct FastNoiseKernels
+{
+	// Decodes the blocks of a compressed volume brick into count values
+	// The caller validates the widths and the length of words first, see FastNoiseSIMD_volume.h
+	void (*decodeVolumeBlocks)(const uint8_t* widths, const uint32_t* words, int count, float min, float step, float* values);
+
+	// Surface nets row loops, inside[i] = density[i] > isoLevel as 0 or 1
+	void (*classifyDensityRow)(const float* density, uint8_t* inside, int count, float isoLevel);
+
+	// Corner masks of count cells along z, bit dx * 4 + dy * 2 + dz is set for inside corners
+	// rXY is the inside row at (x + X, y + Y), each row is read up to count + 1
+	void (*cellMaskRow)(const uint8_t* r00, const uint8_t* r01, const uint8_t* r10, const uint8_t* r11, uint8_t* masks, int count);
+
+	// One row of count texels of FastNoiseHeightmapBaker::Derive(), outputs that are null are skipped
+	// low, row and high are the apron rows x - 1, x and x + 1, each starting at y = -1
+	void (*deriveHeightRow)(const float* low, const float* row, const float* high, int count, float heightScale, float gradientScale, float curvatureScale,
+		float* heights, FastNoisePackedNormal* normals, float* slopes, float* curvatures);
+};
+
+#define FASTNOISE_SIMD_KERNELS2(x) FastNoiseKernels_L##x
+#define FASTNOISE_SIMD_KERNELS(level) FASTNOISE_SIMD_KERNELS2(level)
+
+namespace FastNoiseSIMD_internal
+{
+	// Defined at the end of FastNoiseSIMD_internal.cpp for each compiled level
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_NO_SIMD_FALLBACK);
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_SSE2);
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_SSE41);
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_AVX2);
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_AVX512);
+	extern const FastNoiseKernels FASTNOISE_SIMD_KERNELS(FN_NEON);
+
+	// Kernels of the level NewFastNoiseSIMDAtLevel() creates for level, each table is looked up once
+	const FastNoiseKernels& GetKernels(int level);
+}
+
+#endif
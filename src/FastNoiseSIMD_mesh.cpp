@@ -0,0 +1,220 @@
+// FastNoiseSIMD_mesh.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD/FastNoiseSIMD_mesh.h"
+#include "FastNoiseSIMD_kernels.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+void FastNoiseMesh::Clear()
+{
+	positions.clear();
+	normals.clear();
+	indices.clear();
+}
+
+void FastNoiseMesher::Generate(FastNoiseMesh& mesh, const FastNoiseSIMD* noise, const FastNoiseConfig& config,
+	int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier) const
+{
+	assert(noise);
+
+	float* density = FastNoiseSIMD::GetEmptySet(xSize + 2, ySize + 2, zSize + 2);
+	noise->FillNoiseSet(config, density, xStart - 1, yStart - 1, zStart - 1, xSize + 2, ySize + 2, zSize + 2, scaleModifier);
+
+	Extract(FastNoiseSIMD_internal::GetKernels(noise->GetInstanceSIMDLevel()), mesh, density, xSize, ySize, zSize);
+	FastNoiseSIMD::FreeNoiseSet(density);
+}
+
+// Extent of one brick of cells, cell i spans samples i and i + 1
+struct MeshBrick
+{
+	int x0, y0, z0;
+	int x1, y1, z1;
+};
+
+void FastNoiseMesher::Extract(FastNoiseMesh& mesh, const float* density, int xSize, int ySize, int zSize) const
+{
+	Extract(FastNoiseSIMD_internal::GetKernels(FastNoiseSIMD::GetSIMDLevel()), mesh, density, xSize, ySize, zSize);
+}
+
+void FastNoiseMesher::Extract(const FastNoiseKernels& kernels, FastNoiseMesh& mesh, const float* density, int xSize, int ySize, int zSize) const
+{
+	assert(density);
+	assert(xSize > 0 && ySize > 0 && zSize > 0);
+	assert(brickSize > 0);
+
+	mesh.Clear();
+
+	// Samples run from -1 to size on each axis, cells from -1 to size - 1
+	const int xSamples = xSize + 2;
+	const int ySamples = ySize + 2;
+	const int zSamples = zSize + 2;
+	const int xCells = xSize + 1;
+	const int yCells = ySize + 1;
+	const int zCells = zSize + 1;
+	const size_t sampleCount = size_t(xSamples) * ySamples * zSamples;
+	const size_t xStride = size_t(ySamples) * zSamples;
+
+	std::vector<uint8_t> inside(sampleCount);
+	for (size_t row = 0; row < size_t(xSamples) * ySamples; row++)
+		kernels.classifyDensityRow(density + row * zSamples, &inside[row * zSamples], zSamples, isoLevel);
+
+	// A brick is skipped when every sample of its cells has the same side, including the samples shared with its neighbours
+	std::vector<MeshBrick> bricks;
+	for (int x0 = 0; x0 < xCells; x0 += brickSize)
+	{
+		for (int y0 = 0; y0 < yCells; y0 += brickSize)
+		{
+			for (int z0 = 0; z0 < zCells; z0 += brickSize)
+			{
+				MeshBrick brick = { x0, y0, z0, std::min(x0 + brickSize, xCells), std::min(y0 + brickSize, yCells), std::min(z0 + brickSize, zCells) };
+				uint8_t side = inside[x0 * xStride + y0 * zSamples + z0];
+				bool crossed = false;
+
+				for (int x = brick.x0; !crossed && x <= brick.x1; x++)
+				{
+					for (int y = brick.y0; !crossed && y <= brick.y1; y++)
+						crossed = std::memchr(&inside[x * xStride + y * zSamples + brick.z0], side ^ 1, brick.z1 - brick.z0 + 1) != nullptr;
+				}
+
+				if (crossed)
+					bricks.push_back(brick);
+			}
+		}
+	}
+
+	// Cells share the sample indexing, the last sample of each axis has no cell
+	std::vector<int32_t> cellVertices(sampleCount, -1);
+	std::vector<uint8_t> masks(brickSize);
+
+	for (const MeshBrick& brick : bricks)
+	{
+		for (int x = brick.x0; x < brick.x1; x++)
+		{
+			for (int y = brick.y0; y < brick.y1; y++)
+			{
+				const size_t row = x * xStride + y * zSamples;
+				kernels.cellMaskRow(&inside[row + brick.z0], &inside[row + zSamples + brick.z0],
+					&inside[row + xStride + brick.z0], &inside[row + xStride + zSamples + brick.z0], masks.data(), brick.z1 - brick.z0);
+
+				for (int z = brick.z0; z < brick.z1; z++)
+				{
+					uint8_t mask = masks[z - brick.z0];
+					if (mask == 0 || mask == 0xFF)
+						continue;
+
+					float corners[8];
+					for (int c = 0; c < 8; c++)
+						corners[c] = density[row + (c >> 2) * xStride + ((c >> 1) & 1) * zSamples + z + (c & 1)];
+
+					// Mean of the crossings on the edges between corners c and c | axis
+					float position[3] = { 0.0f, 0.0f, 0.0f };
+					int crossings = 0;
+					for (int c = 0; c < 8; c++)
+					{
+						for (int axis = 0; axis < 3; axis++)
+						{
+							int bit = 4 >> axis;
+							if ((c & bit) || ((mask >> c) & 1) == ((mask >> (c | bit)) & 1))
+								continue;
+
+							float t = (isoLevel - corners[c]) / (corners[c | bit] - corners[c]);
+							position[0] += float((c >> 2) & 1);
+							position[1] += float((c >> 1) & 1);
+							position[2] += float(c & 1);
+							position[axis] += t;
+							crossings++;
+						}
+					}
+
+					cellVertices[row + z] = int32_t(mesh.GetVertexCount());
+					mesh.positions.push_back(float(x - 1) + position[0] / crossings);
+					mesh.positions.push_back(float(y - 1) + position[1] / crossings);
+					mesh.positions.push_back(float(z - 1) + position[2] / crossings);
+
+					if (normals)
+					{
+						// Density grows into the surface, the outward normal is the negative gradient
+						float gradient[3] = { 0.0f, 0.0f, 0.0f };
+						for (int c = 0; c < 8; c++)
+						{
+							gradient[0] += (c & 4) ? corners[c] : -corners[c];
+							gradient[1] += (c & 2) ? corners[c] : -corners[c];
+							gradient[2] += (c & 1) ? corners[c] : -corners[c];
+						}
+
+						float length = std::sqrt(gradient[0] * gradient[0] + gradient[1] * gradient[1] + gradient[2] * gradient[2]);
+						float scale = length > 0.0f ? -1.0f / length : 0.0f;
+						for (float g : gradient)
+							mesh.normals.push_back(g * scale);
+					}
+				}
+			}
+		}
+	}
+
+	// Quad of the 4 cells around a crossed edge, wound to face from inside to outside
+	auto emitQuad = [&](size_t a, size_t b, size_t c, size_t d, bool insideFirst)
+	{
+		uint32_t quad[4] = { uint32_t(cellVertices[a]), uint32_t(cellVertices[b]), uint32_t(cellVertices[c]), uint32_t(cellVertices[d]) };
+		assert(cellVertices[a] >= 0 && cellVertices[b] >= 0 && cellVertices[c] >= 0 && cellVertices[d] >= 0);
+
+		if (!insideFirst)
+			std::swap(quad[1], quad[3]);
+
+		const uint32_t triangles[6] = { quad[0], quad[1], quad[2], quad[0], quad[2], quad[3] };
+		mesh.indices.insert(mesh.indices.end(), triangles, triangles + 6);
+	};
+
+	// Edges start at samples 0 to size - 1 of the chunk, the apron edges belong to the neighbouring chunks
+	for (const MeshBrick& brick : bricks)
+	{
+		for (int x = std::max(brick.x0, 1); x < brick.x1; x++)
+		{
+			for (int y = std::max(brick.y0, 1); y < brick.y1; y++)
+			{
+				for (int z = std::max(brick.z0, 1); z < brick.z1; z++)
+				{
+					const size_t i = x * xStride + y * zSamples + z;
+					const bool side = inside[i] != 0;
+
+					if (side != (inside[i + xStride] != 0))
+						emitQuad(i - zSamples - 1, i - 1, i, i - zSamples, side);
+
+					if (side != (inside[i + zSamples] != 0))
+						emitQuad(i - xStride - 1, i - xStride, i, i - 1, side);
+
+					if (side != (inside[i + 1] != 0))
+						emitQuad(i - xStride - zSamples, i - zSamples, i, i - xStride, side);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,698 @@
+// FastNoiseSIMD_volume.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD/FastNoiseSIMD_volume.h"
+#include "FastNoiseSIMD/FastNoiseSIMD_async.h"
+#include "FastNoiseSIMD_kernels.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <future>
+
+#ifdef FN_VOLUME_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+static_assert(sizeof(FastNoiseVolumeHeader) == 64, "Volume data must start on a cache line");
+
+static const char s_volumeMagic[4] = { 'F', 'N', 'V', 'L' };
+
+// Values per block of a compressed brick
+#define FN_VOLUME_BLOCK_VALUES (FN_VOLUME_BLOCK_LANES * FN_VOLUME_BLOCK_ROWS)
+
+// Deltas of 24 bit quantized values fit 25 bits
+#define FN_VOLUME_MAX_WIDTH 25
+
+uint64_t FastNoiseVolumeHeader::GetDataSize() const
+{
+	switch (layout)
+	{
+	case Float:
+		return uint64_t(xSize) * ySize * zSize * sizeof(float);
+	case Quantized:
+		return uint64_t(xSize) * ySize * zSize * sizeof(uint16_t);
+	case Bricked:
+		return uint64_t(GetBrickCount()) * brickSize * brickSize * brickSize * sizeof(float);
+	default:
+		return 0;
+	}
+}
+
+static size_t CompressedTableOffset(const FastNoiseVolumeHeader& header)
+{
+	return sizeof(FastNoiseVolumeHeader) + ((size_t(header.configSize) + 7) & ~size_t(7));
+}
+
+// Fills the region in slabs of slabX, the next slab fills on a background thread while write() handles the current one
+static void FillSlabs(const FastNoiseSIMD* noise, const FastNoiseConfig& config, FastNoiseFillPool* pool, const FastNoiseVolumeHeader& header,
+	int slabX, float* slabs[2], const std::function<void(int slab, const float* slabSet, int x0, int xCount)>& write)
+{
+	int slabCount = (header.xSize + slabX - 1) / slabX;
+
+	auto fillSlab = [&](int slab)
+	{
+		int x0 = slab * slabX;
+		int xCount = std::min(slabX, header.xSize - x0);
+
+		if (pool)
+			pool->FillNoiseSet(noise, config, slabs[slab & 1], header.xStart + x0, header.yStart, header.zStart, xCount, header.ySize, header.zSize, header.scaleModifier);
+		else
+			noise->FillNoiseSet(config, slabs[slab & 1], header.xStart + x0, header.yStart, header.zStart, xCount, header.ySize, header.zSize, header.scaleModifier);
+	};
+
+	std::future<void> filling = std::async(std::launch::async, fillSlab, 0);
+
+	for (int slab = 0; slab < slabCount; slab++)
+	{
+		filling.get();
+
+		if (slab + 1 < slabCount)
+			filling = std::async(std::launch::async, fillSlab, slab + 1);
+
+		int x0 = slab * slabX;
+		write(slab, slabs[slab & 1], x0, std::min(slabX, header.xSize - x0));
+	}
+}
+
+// Copies brick (bx, by, bz) out of a slab starting at x0, positions past the volume are 0
+static void CopyBrick(const FastNoiseVolumeHeader& header, const float* slab, int x0, int xCount, int bx, int by, int bz, float* brick)
+{
+	int brickSize = header.brickSize;
+	size_t rowSize = size_t(header.ySize) * header.zSize;
+	int zCount = std::min(brickSize, header.zSize - bz * brickSize);
+
+	for (int ix = 0; ix < brickSize; ix++)
+	{
+		int x = bx * brickSize + ix - x0;
+
+		for (int iy = 0; iy < brickSize; iy++)
+		{
+			int y = by * brickSize + iy;
+			float* row = brick + (ix * brickSize + iy) * brickSize;
+
+			if (x >= xCount || y >= header.ySize)
+			{
+				std::memset(row, 0, brickSize * sizeof(float));
+				continue;
+			}
+
+			std::memcpy(row, slab + (x * rowSize + size_t(y) * header.zSize + bz * brickSize), zCount * sizeof(float));
+			std::memset(row + zCount, 0, (brickSize - zCount) * sizeof(float));
+		}
+	}
+}
+
+// Rows of a block, only the last block of a brick can be short
+static int BlockRows(int count, int block)
+{
+	return std::min((count - block * FN_VOLUME_BLOCK_VALUES + FN_VOLUME_BLOCK_LANES - 1) / FN_VOLUME_BLOCK_LANES, FN_VOLUME_BLOCK_ROWS);
+}
+
+static size_t BlockWords(int rows, int width)
+{
+	return size_t(FN_VOLUME_BLOCK_LANES) * ((rows * width + 31) / 32);
+}
+
+// See the Compressed layout in FastNoiseSIMD_volume.h
+static void EncodeBrick(const float* brick, int count, int bits, std::vector<uint8_t>& out)
+{
+	float min = brick[0];
+	float max = brick[0];
+	for (int i = 1; i < count; i++)
+	{
+		min = std::min(min, brick[i]);
+		max = std::max(max, brick[i]);
+	}
+
+	uint32_t qMax = (1u << bits) - 1;
+	float step = max > min ? (max - min) / float(qMax) : 0.0f;
+
+	// A step that rounds to 0 next to min is a constant brick
+	if (min + step == min)
+		step = 0.0f;
+
+	size_t start = out.size();
+	out.resize(start + 2 * sizeof(float));
+	std::memcpy(&out[start], &min, sizeof(float));
+	std::memcpy(&out[start + sizeof(float)], &step, sizeof(float));
+
+	if (step == 0.0f)
+		return;
+
+	int blockCount = (count + FN_VOLUME_BLOCK_VALUES - 1) / FN_VOLUME_BLOCK_VALUES;
+	size_t widthOffset = out.size();
+	out.resize(widthOffset + ((blockCount + 3) & ~3), 0);
+
+	float invStep = 1.0f / step;
+	uint32_t previous[FN_VOLUME_BLOCK_LANES] = {};
+	uint32_t zigzags[FN_VOLUME_BLOCK_VALUES];
+	std::vector<uint32_t> words;
+
+	for (int block = 0; block < blockCount; block++)
+	{
+		int blockStart = block * FN_VOLUME_BLOCK_VALUES;
+		int blockValues = BlockRows(count, block) * FN_VOLUME_BLOCK_LANES;
+		uint32_t used = 0;
+
+		// The end of a short last row is padded with 0
+		for (int i = 0; i < blockValues; i++)
+		{
+			uint32_t zigzag = 0;
+			if (blockStart + i < count)
+			{
+				uint32_t q = std::min(uint32_t((brick[blockStart + i] - min) * invStep + 0.5f), qMax);
+				int32_t delta = int32_t(q - previous[i % FN_VOLUME_BLOCK_LANES]);
+				zigzag = (uint32_t(delta) << 1) ^ uint32_t(delta >> 31);
+				previous[i % FN_VOLUME_BLOCK_LANES] = q;
+			}
+			zigzags[i] = zigzag;
+			used |= zigzag;
+		}
+
+		int width = 0;
+		while (width < 32 && (used >> width) != 0)
+			width++;
+		out[widthOffset + block] = uint8_t(width);
+
+		words.assign(BlockWords(blockValues / FN_VOLUME_BLOCK_LANES, width), 0);
+		for (int i = 0; i < blockValues && width > 0; i++)
+		{
+			int bit = i / FN_VOLUME_BLOCK_LANES * width;
+			uint32_t* word = &words[bit / 32 * FN_VOLUME_BLOCK_LANES + i % FN_VOLUME_BLOCK_LANES];
+
+			word[0] |= zigzags[i] << (bit % 32);
+			if (bit % 32 + width > 32)
+				word[FN_VOLUME_BLOCK_LANES] |= zigzags[i] >> (32 - bit % 32);
+		}
+
+		const uint8_t* wordBytes = reinterpret_cast<const uint8_t*>(words.data());
+		out.insert(out.end(), wordBytes, wordBytes + words.size() * sizeof(uint32_t));
+	}
+}
+
+// Returns false if the brick data runs past end or holds wider values than any brick is written with
+static bool DecodeCompressedBrick(const FastNoiseKernels& kernels, const uint8_t* data, const uint8_t* end, int count, float* brick)
+{
+	float min, step;
+	if (end - data < ptrdiff_t(2 * sizeof(float)))
+		return false;
+
+	std::memcpy(&min, data, sizeof(float));
+	std::memcpy(&step, data + sizeof(float), sizeof(float));
+	data += 2 * sizeof(float);
+
+	if (step == 0.0f)
+	{
+		std::fill(brick, brick + count, min);
+		return true;
+	}
+
+	int blockCount = (count + FN_VOLUME_BLOCK_VALUES - 1) / FN_VOLUME_BLOCK_VALUES;
+	size_t widthBytes = size_t(blockCount + 3) & ~size_t(3);
+	if (size_t(end - data) < widthBytes)
+		return false;
+
+	size_t wordCount = 0;
+	for (int block = 0; block < blockCount; block++)
+	{
+		if (data[block] > FN_VOLUME_MAX_WIDTH)
+			return false;
+		wordCount += BlockWords(BlockRows(count, block), data[block]);
+	}
+
+	if (size_t(end - data) - widthBytes < wordCount * sizeof(uint32_t))
+		return false;
+
+	kernels.decodeVolumeBlocks(data, reinterpret_cast<const uint32_t*>(data + widthBytes), count, min, step, brick);
+	return true;
+}
+
+bool FastNoiseVolumeWriter::Generate(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config,
+	int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier) const
+{
+	assert(path && noise);
+	assert(xSize > 0 && ySize > 0 && zSize > 0);
+	assert(layout < FastNoiseVolumeHeader::Bricked || brickSize > 0);
+	assert(layout != FastNoiseVolumeHeader::Quantized || quantizeMax > quantizeMin);
+	assert(layout != FastNoiseVolumeHeader::Compressed || (compressedBits >= 1 && compressedBits <= 24));
+
+	FastNoiseVolumeHeader header = {};
+	std::memcpy(header.magic, s_volumeMagic, sizeof(header.magic));
+	header.version = FN_VOLUME_VERSION;
+	header.layout = layout;
+	header.xStart = xStart;
+	header.yStart = yStart;
+	header.zStart = zStart;
+	header.xSize = xSize;
+	header.ySize = ySize;
+	header.zSize = zSize;
+	header.brickSize = layout >= FastNoiseVolumeHeader::Bricked ? brickSize : 0;
+	header.quantizeMin = quantizeMin;
+	header.quantizeMax = quantizeMax;
+	header.scaleModifier = scaleModifier;
+	header.configHash = config.GetHash();
+
+	if (layout == FastNoiseVolumeHeader::Compressed)
+		return GenerateCompressed(path, noise, config, header);
+
+	return GenerateMapped(path, noise, config, header);
+}
+
+// Two slabs fit the budget, bricked slabs are whole brick layers
+// Large rows give slabs of one x or brick layer, the pool then splits each slab over its workers along y
+static int SlabSize(const FastNoiseVolumeHeader& header, size_t memoryBudget)
+{
+	size_t rowBytes = size_t(header.ySize) * header.zSize * sizeof(float);
+	int slabStep = header.brickSize > 0 ? header.brickSize : 1;
+	int slabX = std::max(int(memoryBudget / 2 / (rowBytes * slabStep)), 1) * slabStep;
+
+	return std::min(slabX, (header.xSize + slabStep - 1) / slabStep * slabStep);
+}
+
+// fseek with 64 bit offsets, long is 32 bits on Windows
+static bool SeekFile(std::FILE* file, uint64_t offset)
+{
+#ifdef _WIN32
+	return _fseeki64(file, int64_t(offset), SEEK_SET) == 0;
+#else
+	return fseeko(file, off_t(offset), SEEK_SET) == 0;
+#endif
+}
+
+bool FastNoiseVolumeWriter::GenerateCompressed(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config, FastNoiseVolumeHeader& header) const
+{
+	std::vector<uint8_t> configData = config.SaveBinary();
+	header.configSize = uint32_t(configData.size());
+
+	std::FILE* file = std::fopen(path, "wb");
+	if (!file)
+		return false;
+
+	const uint64_t tableOffset = CompressedTableOffset(header);
+	const size_t brickCount = size_t(header.GetBrickCount());
+	configData.resize(size_t(tableOffset) - sizeof(header), 0);
+
+	// The table is written slab by slab, the bricks start after it
+	uint64_t offset = tableOffset + (brickCount + 1) * sizeof(uint64_t);
+	bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+		std::fwrite(configData.data(), configData.size(), 1, file) == 1 &&
+		SeekFile(file, offset);
+
+	int slabX = SlabSize(header, memoryBudget);
+	float* slabs[2] = { FastNoiseSIMD::GetEmptySet(slabX * header.ySize * header.zSize), FastNoiseSIMD::GetEmptySet(slabX * header.ySize * header.zSize) };
+	ok &= slabs[0] && slabs[1];
+
+	if (ok)
+	{
+		int brickSize = header.brickSize;
+		int yBricks = header.GetBrickCount(header.ySize);
+		int zBricks = header.GetBrickCount(header.zSize);
+		int brickFloats = brickSize * brickSize * brickSize;
+		std::vector<float> brick(brickFloats);
+		std::vector<uint8_t> encoded;
+		std::vector<uint64_t> offsets;
+
+		// Bricks are stored in set order, so each slab's bricks and table entries follow the last slab's
+		FillSlabs(noise, config, pool, header, slabX, slabs, [&](int, const float* slab, int x0, int xCount)
+		{
+			encoded.clear();
+			offsets.clear();
+
+			for (int bx = x0 / brickSize; bx * brickSize < x0 + xCount; bx++)
+			{
+				for (int by = 0; by < yBricks; by++)
+				{
+					for (int bz = 0; bz < zBricks; bz++)
+					{
+						offsets.push_back(offset + encoded.size());
+						CopyBrick(header, slab, x0, xCount, bx, by, bz, brick.data());
+						EncodeBrick(brick.data(), brickFloats, compressedBits, encoded);
+					}
+				}
+			}
+
+			ok &= std::fwrite(encoded.data(), 1, encoded.size(), file) == encoded.size();
+			offset += encoded.size();
+
+			size_t firstBrick = size_t(x0 / brickSize) * yBricks * zBricks;
+			ok &= SeekFile(file, tableOffset + firstBrick * sizeof(uint64_t)) &&
+				std::fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), file) == offsets.size() &&
+				SeekFile(file, offset);
+		});
+
+		ok &= SeekFile(file, tableOffset + brickCount * sizeof(uint64_t)) &&
+			std::fwrite(&offset, sizeof(uint64_t), 1, file) == 1;
+	}
+
+	FastNoiseSIMD::FreeNoiseSet(slabs[0]);
+	FastNoiseSIMD::FreeNoiseSet(slabs[1]);
+	ok &= std::fclose(file) == 0;
+	return ok;
+}
+
+#ifdef FN_VOLUME_MMAP
+// Writes back and drops the pages of a range, msync and madvise need page aligned starts
+static void FlushRange(uint8_t* mapping, size_t start, size_t end, bool drop)
+{
+	size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+	start -= start % pageSize;
+
+	msync(mapping + start, end - start, drop ? MS_SYNC : MS_ASYNC);
+	if (drop)
+		madvise(mapping + start, end - start, MADV_DONTNEED);
+}
+
+// Copies x rows [x0, x0 + xCount) of a filled slab into the mapped data
+static void WriteSlab(const FastNoiseVolumeHeader& header, uint8_t* data, const float* slab, int x0, int xCount)
+{
+	size_t rowSize = size_t(header.ySize) * header.zSize;
+	size_t slabSize = xCount * rowSize;
+
+	switch (header.layout)
+	{
+	case FastNoiseVolumeHeader::Float:
+		std::memcpy(data + x0 * rowSize * sizeof(float), slab, slabSize * sizeof(float));
+		break;
+
+	case FastNoiseVolumeHeader::Quantized:
+	{
+		uint16_t* dest = reinterpret_cast<uint16_t*>(data) + x0 * rowSize;
+		float scale = 65535.0f / (header.quantizeMax - header.quantizeMin);
+
+		for (size_t i = 0; i < slabSize; i++)
+		{
+			float q = (std::min(std::max(slab[i], header.quantizeMin), header.quantizeMax) - header.quantizeMin) * scale;
+			dest[i] = uint16_t(q + 0.5f);
+		}
+		break;
+	}
+
+	case FastNoiseVolumeHeader::Bricked:
+	{
+		// Slabs hold whole brick layers, the last may be short
+		int brickSize = header.brickSize;
+		int yBricks = header.GetBrickCount(header.ySize);
+		int zBricks = header.GetBrickCount(header.zSize);
+		size_t brickFloats = size_t(brickSize) * brickSize * brickSize;
+		float* bricks = reinterpret_cast<float*>(data);
+
+		for (int bx = x0 / brickSize; bx * brickSize < x0 + xCount; bx++)
+		{
+			for (int by = 0; by < yBricks; by++)
+			{
+				for (int bz = 0; bz < zBricks; bz++)
+					CopyBrick(header, slab, x0, xCount, bx, by, bz, bricks + ((size_t(bx) * yBricks + by) * zBricks + bz) * brickFloats);
+			}
+		}
+		break;
+	}
+	}
+}
+#endif
+
+bool FastNoiseVolumeWriter::GenerateMapped(const char* path, const FastNoiseSIMD* noise, const FastNoiseConfig& config, FastNoiseVolumeHeader& header) const
+{
+#ifdef FN_VOLUME_MMAP
+	size_t fileSize = sizeof(header) + size_t(header.GetDataSize());
+
+	int file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (file < 0)
+		return false;
+
+	if (ftruncate(file, off_t(fileSize)) != 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* mappingPtr = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	close(file);
+	if (mappingPtr == MAP_FAILED)
+		return false;
+
+	uint8_t* mapping = static_cast<uint8_t*>(mappingPtr);
+	std::memcpy(mapping, &header, sizeof(header));
+	uint8_t* data = mapping + sizeof(header);
+
+	int slabX = SlabSize(header, memoryBudget);
+	float* slabs[2] = { FastNoiseSIMD::GetEmptySet(slabX * header.ySize * header.zSize), FastNoiseSIMD::GetEmptySet(slabX * header.ySize * header.zSize) };
+	if (!slabs[0] || !slabs[1])
+	{
+		FastNoiseSIMD::FreeNoiseSet(slabs[0]);
+		FastNoiseSIMD::FreeNoiseSet(slabs[1]);
+		munmap(mapping, fileSize);
+		return false;
+	}
+
+	// Byte range of the mapping written by each slab
+	auto slabEnd = [&](int slab)
+	{
+		int x1 = std::min((slab + 1) * slabX, header.xSize);
+		if (header.layout == FastNoiseVolumeHeader::Bricked)
+			return sizeof(header) + size_t(header.GetDataSize()) * size_t(header.GetBrickCount(x1)) / size_t(header.GetBrickCount(header.xSize));
+		return sizeof(header) + size_t(x1) * size_t(header.GetDataSize() / header.xSize);
+	};
+
+	// The slab before the one just written is written back and dropped
+	FillSlabs(noise, config, pool, header, slabX, slabs, [&](int slab, const float* slabSet, int x0, int xCount)
+	{
+		WriteSlab(header, data, slabSet, x0, xCount);
+		FlushRange(mapping, slab == 0 ? 0 : slabEnd(slab - 1), slabEnd(slab), false);
+
+		if (slab > 0)
+			FlushRange(mapping, slab == 1 ? 0 : slabEnd(slab - 2), slabEnd(slab - 1), true);
+	});
+
+	bool synced = msync(mapping, fileSize, MS_SYNC) == 0;
+
+	FastNoiseSIMD::FreeNoiseSet(slabs[0]);
+	FastNoiseSIMD::FreeNoiseSet(slabs[1]);
+	munmap(mapping, fileSize);
+	return synced;
+#else
+	(void)path;
+	(void)noise;
+	(void)config;
+	(void)header;
+	return false;
+#endif
+}
+
+// Read only mapping of a whole file, returns nullptr if the file is missing or shorter than a header
+static void* MapFile(const char* path, size_t& size)
+{
+#ifdef FN_VOLUME_MMAP
+	int file = open(path, O_RDONLY);
+	if (file < 0)
+		return nullptr;
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || size_t(fileStat.st_size) < sizeof(FastNoiseVolumeHeader))
+	{
+		close(file);
+		return nullptr;
+	}
+
+	size = size_t(fileStat.st_size);
+	void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+	close(file);
+	return mapping == MAP_FAILED ? nullptr : mapping;
+#elif defined(_WIN32)
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return nullptr;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || uint64_t(fileSize.QuadPart) < sizeof(FastNoiseVolumeHeader) || uint64_t(fileSize.QuadPart) > SIZE_MAX)
+	{
+		CloseHandle(file);
+		return nullptr;
+	}
+
+	// The view keeps the file mapping open after both handles are closed
+	size = size_t(fileSize.QuadPart);
+	HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!fileMapping)
+		return nullptr;
+
+	void* mapping = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(fileMapping);
+	return mapping;
+#else
+	(void)path;
+	(void)size;
+	return nullptr;
+#endif
+}
+
+bool FastNoiseVolumeFile::Open(const char* path)
+{
+	assert(path);
+	Close();
+
+	size_t size = 0;
+	void* mapping = MapFile(path, size);
+	if (!mapping)
+		return false;
+
+	m_mapping = mapping;
+	m_mappingSize = size;
+
+	const FastNoiseVolumeHeader& header = GetHeader();
+	bool valid = std::memcmp(header.magic, s_volumeMagic, sizeof(s_volumeMagic)) == 0 &&
+		header.version == FN_VOLUME_VERSION &&
+		header.layout <= FastNoiseVolumeHeader::Compressed &&
+		header.xSize > 0 && header.ySize > 0 && header.zSize > 0 &&
+		(header.layout < FastNoiseVolumeHeader::Bricked || header.brickSize > 0) &&
+		sizeof(FastNoiseVolumeHeader) + header.GetDataSize() <= size;
+
+	if (valid && header.layout == FastNoiseVolumeHeader::Compressed)
+		valid = ValidateCompressed();
+
+	if (!valid)
+		Close();
+	return valid;
+}
+
+// The table must fit the file and the brick offsets must be 4 byte aligned and ascend within it
+bool FastNoiseVolumeFile::ValidateCompressed()
+{
+	const FastNoiseVolumeHeader& header = GetHeader();
+	size_t tableOffset = CompressedTableOffset(header);
+	size_t brickCount = size_t(header.GetBrickCount());
+
+	if (tableOffset + (brickCount + 1) * sizeof(uint64_t) > m_mappingSize)
+		return false;
+
+	m_brickOffsets = reinterpret_cast<const uint64_t*>(static_cast<const uint8_t*>(m_mapping) + tableOffset);
+
+	for (size_t i = 0; i < brickCount; i++)
+	{
+		if (m_brickOffsets[i] > m_brickOffsets[i + 1] || m_brickOffsets[i] % 4 != 0)
+			return false;
+	}
+	return m_brickOffsets[brickCount] <= m_mappingSize;
+}
+
+void FastNoiseVolumeFile::Close()
+{
+#ifdef FN_VOLUME_MMAP
+	if (m_mapping)
+		munmap(m_mapping, m_mappingSize);
+#elif defined(_WIN32)
+	if (m_mapping)
+		UnmapViewOfFile(m_mapping);
+#endif
+	m_mapping = nullptr;
+	m_mappingSize = 0;
+	m_brickOffsets = nullptr;
+}
+
+bool FastNoiseVolumeFile::GetConfig(FastNoiseConfig& config) const
+{
+	assert(IsOpen());
+	if (GetHeader().layout != FastNoiseVolumeHeader::Compressed)
+		return false;
+
+	return config.LoadBinary(static_cast<const uint8_t*>(GetData()), GetHeader().configSize);
+}
+
+bool FastNoiseVolumeFile::DecodeBrick(int bx, int by, int bz, float* brick) const
+{
+	assert(IsOpen());
+	assert(brick);
+	const FastNoiseVolumeHeader& header = GetHeader();
+	assert(header.brickSize == 0 || (bx < header.GetBrickCount(header.xSize) && by < header.GetBrickCount(header.ySize) && bz < header.GetBrickCount(header.zSize)));
+
+	size_t index = (size_t(bx) * header.GetBrickCount(header.ySize) + by) * header.GetBrickCount(header.zSize) + bz;
+	int brickFloats = header.brickSize * header.brickSize * header.brickSize;
+
+	switch (header.layout)
+	{
+	case FastNoiseVolumeHeader::Bricked:
+		std::memcpy(brick, static_cast<const float*>(GetData()) + index * brickFloats, brickFloats * sizeof(float));
+		return true;
+
+	case FastNoiseVolumeHeader::Compressed:
+	{
+		const uint8_t* base = static_cast<const uint8_t*>(m_mapping);
+		return DecodeCompressedBrick(FastNoiseSIMD_internal::GetKernels(FastNoiseSIMD::GetSIMDLevel()), base + m_brickOffsets[index], base + m_brickOffsets[index + 1], brickFloats, brick);
+	}
+
+	default:
+		return false;
+	}
+}
+
+float FastNoiseVolumeFile::GetValue(int x, int y, int z) const
+{
+	assert(IsOpen());
+	const FastNoiseVolumeHeader& header = GetHeader();
+	assert(x >= 0 && x < header.xSize && y >= 0 && y < header.ySize && z >= 0 && z < header.zSize);
+
+	size_t index = (size_t(x) * header.ySize + y) * header.zSize + z;
+
+	switch (header.layout)
+	{
+	case FastNoiseVolumeHeader::Float:
+		return static_cast<const float*>(GetData())[index];
+
+	case FastNoiseVolumeHeader::Quantized:
+		return header.quantizeMin + float(static_cast<const uint16_t*>(GetData())[index]) * ((header.quantizeMax - header.quantizeMin) / 65535.0f);
+
+	default:
+	{
+		int brickSize = header.brickSize;
+		size_t inBrick = (size_t(x % brickSize) * brickSize + y % brickSize) * brickSize + z % brickSize;
+
+		if (header.layout == FastNoiseVolumeHeader::Bricked)
+		{
+			size_t brick = (size_t(x / brickSize) * header.GetBrickCount(header.ySize) + y / brickSize) * header.GetBrickCount(header.zSize) + z / brickSize;
+			return static_cast<const float*>(GetData())[brick * brickSize * brickSize * brickSize + inBrick];
+		}
+
+		std::vector<float> brick(size_t(brickSize) * brickSize * brickSize);
+		if (!DecodeBrick(x / brickSize, y / brickSize, z / brickSize, brick.data()))
+			return 0.0f;
+		return brick[inBrick];
+	}
+	}
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch.hpp>
+
+#include <climits>
+#include <cstring>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_async.h"
+
+static uint64_t GetJobTotal(const FastNoiseFillPool& pool)
+{
+    uint64_t total = 0;
+    for (uint64_t count : pool.GetJobCounts())
+        total += count;
+    return total;
+}
+
+TEST_CASE("pool fills match blocking fills", "[FastNoiseSIMD]")
+{
+    const int jobCount = 12;
+    const int size = 8 * 8 * 13;
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseFillPool pool(3);
+    REQUIRE(pool.GetThreadCount() == 3);
+
+    std::vector<float*> sets;
+    std::vector<FastNoiseFillJob> jobs;
+    for (int i = 0; i < jobCount; i++)
+    {
+        sets.push_back(FastNoiseSIMD::GetEmptySet(size));
+        jobs.push_back(pool.Submit(noise, sets[i], i * 8, 0, 0, 8, 8, 13));
+    }
+
+    for (int i = 0; i < jobCount; i++)
+    {
+        REQUIRE(jobs[i].done.get());
+
+        float* expected = noise->GetNoiseSet(i * 8, 0, 0, 8, 8, 13);
+        REQUIRE(std::memcmp(sets[i], expected, size * sizeof(float)) == 0);
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(sets[i]);
+    }
+
+    delete noise;
+}
+
+TEST_CASE("pool runs higher priorities first and cancels queued jobs", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    float* set = FastNoiseSIMD::GetEmptySet(4 * 4 * 4);
+    FastNoiseFillPool pool(1);
+
+    // The only worker waits in the first callback until every other job is queued
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<int> order;
+    std::vector<bool> cancelled;
+
+    FastNoiseFillJob blocker = pool.Submit(noise, set, 0, 0, 0, 4, 4, 4, 1.0f, 0, [&started, released](bool)
+    {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    // The extremes of int order like any other priority
+    const int priorities[] = { 0, 5, INT_MIN, 5, 2, INT_MAX };
+    std::vector<FastNoiseFillJob> jobs;
+    for (int i = 0; i < 6; i++)
+    {
+        jobs.push_back(pool.Submit(noise, set, 0, 0, 0, 4, 4, 4, 1.0f, priorities[i], [&order, &cancelled, i](bool filled)
+        {
+            if (filled)
+                order.push_back(i);
+            else
+                cancelled.push_back(i);
+        }));
+    }
+
+    REQUIRE(pool.Cancel(jobs[4].id));
+    REQUIRE_FALSE(pool.Cancel(jobs[4].id));
+    REQUIRE(cancelled.size() == 1);
+    REQUIRE_FALSE(jobs[4].done.get());
+
+    release.set_value();
+    for (FastNoiseFillJob& job : jobs)
+        job.done.wait();
+
+    REQUIRE(blocker.done.get());
+    REQUIRE_FALSE(pool.Cancel(jobs[0].id));
+    REQUIRE(pool.GetQueuedCount() == 0);
+    REQUIRE(order == std::vector<int>({ 5, 1, 3, 0, 2 }));
+
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
+
+TEST_CASE("pool splits a region over its workers", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::WhiteNoise);
+    FastNoiseFillPool pool(4, true);
+    REQUIRE(pool.GetNodeCount() >= 1);
+
+    // Odd rows need slabs of several x to keep every slab on a vector boundary
+    const int xSizes[] = { 1, 3, 37 };
+    for (int xSize : xSizes)
+    {
+        const int size = xSize * 5 * 13;
+        float* set = pool.GetEmptySet(size, pool.GetNodeCount() - 1);
+        REQUIRE(set[size - 1] == 0.0f);
+
+        uint64_t jobTotal = GetJobTotal(pool);
+        pool.FillNoiseSet(noise, noise->GetConfig(), set, -4, 2, 9, xSize, 5, 13);
+
+        // A single x step is split into a band of y for every worker
+        if (xSize == 1)
+            REQUIRE(GetJobTotal(pool) - jobTotal == 4);
+
+        float* expected = noise->GetNoiseSet(-4, 2, 9, xSize, 5, 13);
+        REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(set);
+    }
+
+    delete noise;
+}
+
+TEST_CASE("pool only binds jobs to nodes with workers", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+
+    // Four nodes that all hold CPU 0, so the layout exists on any machine
+    const std::vector<std::vector<int>> nodeCpus(4, std::vector<int>({ 0 }));
+
+    for (int threadCount : { 1, 3 })
+    {
+        FastNoiseFillPool pool(threadCount, nodeCpus);
+        REQUIRE(pool.GetNodeCount() == threadCount);
+
+        const int size = 9 * 6 * 13;
+        float* set = pool.GetEmptySet(size, pool.GetNodeCount() - 1);
+        pool.FillNoiseSet(noise, noise->GetConfig(), set, 0, 0, 0, 9, 6, 13);
+
+        float* expected = noise->GetNoiseSet(0, 0, 0, 9, 6, 13);
+        INFO("thread count " << threadCount);
+        REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(set);
+    }
+
+    delete noise;
+}
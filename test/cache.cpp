@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_cache.h"
+
+TEST_CASE("cached sets match uncached fills", "[FastNoiseSIMD]")
+{
+    const int size = 8 * 8 * 13;
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseSetCache cache(1 << 20, 4);
+
+    float* expected = noise->GetNoiseSet(3, -2, 7, 8, 8, 13);
+    float* set = FastNoiseSIMD::GetEmptySet(size);
+
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 3, -2, 7, 8, 8, 13));
+    std::memset(set, 0, size * sizeof(float));
+    REQUIRE(cache.FillNoiseSet(noise, set, 3, -2, 7, 8, 8, 13));
+    REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+    // Any change to the settings, region or scale is a different set
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 3, -2, 7, 8, 8, 13, 2.0f));
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 3, -2, 8, 8, 8, 13));
+    noise->SetFrequency(0.02f);
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 3, -2, 7, 8, 8, 13));
+
+    FastNoiseSetCacheStats stats = cache.GetStats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 4);
+    REQUIRE(stats.entries == 4);
+    REQUIRE(stats.bytes == 4 * size * sizeof(float));
+
+    cache.Clear();
+    REQUIRE(cache.GetStats().entries == 0);
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
+
+TEST_CASE("cache keys on passed in hashes and the SIMD level", "[FastNoiseSIMD]")
+{
+    const int size = 8 * 8 * 8;
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    const uint64_t configHash = noise->GetConfig().GetHash();
+    FastNoiseSetCache cache(1 << 20, 2);
+    float* set = FastNoiseSIMD::GetEmptySet(size);
+
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, noise->GetConfig(), configHash, set, 0, 8, 0, 8, 8, 8));
+    REQUIRE(cache.FillNoiseSet(noise, set, 0, 8, 0, 8, 8, 8));
+
+    // Every level that was created fills its own set once
+    std::set<int> levels = { noise->GetInstanceSIMDLevel() };
+    for (int level = FN_NO_SIMD_FALLBACK; level <= FastNoiseSIMD::GetSIMDLevel(); level++)
+    {
+        FastNoiseSIMD* other = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(level);
+        float* expected = other->GetNoiseSet(0, 8, 0, 8, 8, 8);
+        bool seen = !levels.insert(other->GetInstanceSIMDLevel()).second;
+
+        INFO("SIMD level " << level);
+        REQUIRE(cache.FillNoiseSet(other, other->GetConfig(), configHash, set, 0, 8, 0, 8, 8, 8) == seen);
+        REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+        REQUIRE(cache.FillNoiseSet(other, other->GetConfig(), configHash, set, 0, 8, 0, 8, 8, 8));
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        delete other;
+    }
+
+    REQUIRE(cache.GetStats().entries == levels.size());
+
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
+
+TEST_CASE("cache evicts the least recently used sets over its budget", "[FastNoiseSIMD]")
+{
+    const int size = 16 * 16 * 16;
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseSetCache cache(3 * size * sizeof(float), 1);
+    float* set = FastNoiseSIMD::GetEmptySet(size);
+
+    for (int i = 0; i < 3; i++)
+        cache.FillNoiseSet(noise, set, i * 16, 0, 0, 16, 16, 16);
+
+    // Touch the first set so the second is the oldest
+    REQUIRE(cache.FillNoiseSet(noise, set, 0, 0, 0, 16, 16, 16));
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 48, 0, 0, 16, 16, 16));
+
+    FastNoiseSetCacheStats stats = cache.GetStats();
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.entries == 3);
+    REQUIRE(cache.FillNoiseSet(noise, set, 0, 0, 0, 16, 16, 16));
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, set, 16, 0, 0, 16, 16, 16));
+
+    // Larger than the budget, filled but never stored
+    float* large = FastNoiseSIMD::GetEmptySet(4 * size);
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, large, 0, 0, 0, 64, 16, 16));
+    REQUIRE_FALSE(cache.FillNoiseSet(noise, large, 0, 0, 0, 64, 16, 16));
+
+    FastNoiseSIMD::FreeNoiseSet(large);
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
+
+TEST_CASE("cache is shared between threads", "[FastNoiseSIMD]")
+{
+    const int threadCount = 4;
+    const int size = 8 * 8 * 8;
+    const FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseSetCache cache(1 << 20);
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(threadCount, 0);
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            float* set = FastNoiseSIMD::GetEmptySet(size);
+            float* expected = FastNoiseSIMD::GetEmptySet(size);
+
+            for (int i = 0; i < 64; i++)
+            {
+                int chunk = (i * 7 + t) % 16;
+                cache.FillNoiseSet(noise, set, chunk * 8, 0, 0, 8, 8, 8);
+                noise->FillNoiseSet(noise->GetConfig(), expected, chunk * 8, 0, 0, 8, 8, 8);
+                mismatches[t] += std::memcmp(set, expected, size * sizeof(float)) != 0;
+            }
+
+            FastNoiseSIMD::FreeNoiseSet(set);
+            FastNoiseSIMD::FreeNoiseSet(expected);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int t = 0; t < threadCount; t++)
+        REQUIRE(mismatches[t] == 0);
+
+    FastNoiseSetCacheStats stats = cache.GetStats();
+    REQUIRE(stats.hits + stats.misses == threadCount * 64);
+    REQUIRE(stats.entries == 16);
+
+    delete noise;
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+static FastNoiseConfig GetTestConfig(int seed)
+{
+    FastNoiseConfig config(seed);
+    config.SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    config.SetFrequency(0.03f);
+    config.SetFractalType(FastNoiseSIMD::Billow);
+    config.SetFractalOctaves(5);
+    config.SetFractalGain(0.6f);
+    config.SetPerturbType(FastNoiseSIMD::GradientFractal);
+    return config;
+}
+
+TEST_CASE("config fills match fills with the same settings", "[FastNoiseSIMD]")
+{
+    const FastNoiseConfig config = GetTestConfig(99);
+    const int size = 8 * 8 * 13;
+
+    FastNoiseSIMD* configured = FastNoiseSIMD::NewFastNoiseSIMD();
+    configured->SetConfig(config);
+    REQUIRE(configured->GetSeed() == 99);
+
+    const FastNoiseSIMD* engine = FastNoiseSIMD::NewFastNoiseSIMD(7);
+    float* expected = configured->GetNoiseSet(-3, 5, 9, 8, 8, 13);
+    float* set = engine->GetNoiseSet(config, -3, 5, 9, 8, 8, 13);
+    REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+    // The engine's own settings are untouched
+    REQUIRE(engine->GetSeed() == 7);
+
+    FastNoiseVectorSet vectorSet;
+    FastNoiseSIMD::FillVectorSet(&vectorSet, 8, 8, 13);
+    configured->FillNoiseSet(expected, &vectorSet, 1.0f, 2.0f, 3.0f);
+    engine->FillNoiseSet(config, set, &vectorSet, 1.0f, 2.0f, 3.0f);
+    REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete configured;
+    delete engine;
+}
+
+TEST_CASE("one engine serves several threads with their own configs", "[FastNoiseSIMD]")
+{
+    const int threadCount = 4;
+    const int size = 16 * 16 * 16;
+
+    const FastNoiseSIMD* engine = FastNoiseSIMD::NewFastNoiseSIMD();
+    std::vector<float*> sets(threadCount);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([engine, &sets, t]()
+        {
+            sets[t] = engine->GetNoiseSet(GetTestConfig(t), 0, 0, 0, 16, 16, 16);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        float* expected = engine->GetNoiseSet(GetTestConfig(t), 0, 0, 0, 16, 16, 16);
+
+        INFO("thread " << t);
+        REQUIRE(std::memcmp(sets[t], expected, size * sizeof(float)) == 0);
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(sets[t]);
+    }
+
+    delete engine;
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+// Without FN_DETERMINISTIC only the levels without FMA or a different rsqrt estimate are expected to match
+static int MaxDeterministicLevel()
+{
+#ifdef FN_DETERMINISTIC
+    return FastNoiseSIMD::GetSIMDLevel();
+#else
+    return std::min(FastNoiseSIMD::GetSIMDLevel(), FN_SSE41);
+#endif
+}
+
+// The scalar fallback uses its own rsqrt and rounding, only FN_DETERMINISTIC makes it match the SIMD levels
+static int ReferenceLevel()
+{
+#if defined(FN_COMPILE_NO_SIMD_FALLBACK) && !defined(FN_DETERMINISTIC)
+    return FN_SSE2;
+#else
+    return FN_NO_SIMD_FALLBACK;
+#endif
+}
+
+static float* GetConfiguredSet(int level, FastNoiseSIMD::NoiseType noiseType, FastNoiseSIMD::FractalType fractalType,
+    FastNoiseSIMD::PerturbType perturbType, FastNoiseSIMD::CellularReturnType cellularReturnType)
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(level, 4242);
+    noise->SetFrequency(0.037f);
+    noise->SetNoiseType(noiseType);
+    noise->SetFractalType(fractalType);
+    noise->SetFractalOctaves(4);
+    noise->SetPerturbType(perturbType);
+    noise->SetPerturbAmp(2.5f);
+    noise->SetCellularReturnType(cellularReturnType);
+    noise->SetCellularNoiseLookupType(FastNoiseSIMD::Perlin);
+
+    float* set = noise->GetNoiseSet(-7, 3, 11, 8, 8, 21);
+
+    delete noise;
+    return set;
+}
+
+TEST_CASE("all SIMD levels produce identical output", "[FastNoiseSIMD]")
+{
+    const int referenceLevel = ReferenceLevel();
+    const int maxLevel = MaxDeterministicLevel();
+    const int size = 8 * 8 * 21;
+
+    const FastNoiseSIMD::NoiseType noiseTypes[] = { FastNoiseSIMD::Value, FastNoiseSIMD::PerlinFractal, FastNoiseSIMD::SimplexFractal,
+        FastNoiseSIMD::OpenSimplex2Fractal, FastNoiseSIMD::WhiteNoise, FastNoiseSIMD::CubicFractal, FastNoiseSIMD::Cellular };
+    const FastNoiseSIMD::PerturbType perturbTypes[] = { FastNoiseSIMD::None, FastNoiseSIMD::GradientFractal_Normalise, FastNoiseSIMD::SimplexGradient };
+    const FastNoiseSIMD::CellularReturnType cellularReturnTypes[] = { FastNoiseSIMD::Distance, FastNoiseSIMD::Distance2Div, FastNoiseSIMD::NoiseLookup };
+
+    for (FastNoiseSIMD::NoiseType noiseType : noiseTypes)
+    {
+        for (FastNoiseSIMD::PerturbType perturbType : perturbTypes)
+        {
+            for (FastNoiseSIMD::CellularReturnType cellularReturnType : cellularReturnTypes)
+            {
+                if (noiseType != FastNoiseSIMD::Cellular && cellularReturnType != FastNoiseSIMD::Distance)
+                    continue;
+
+                FastNoiseSIMD::FractalType fractalType = perturbType == FastNoiseSIMD::None ? FastNoiseSIMD::ErodedFBM : FastNoiseSIMD::RigidMulti;
+                float* expected = GetConfiguredSet(referenceLevel, noiseType, fractalType, perturbType, cellularReturnType);
+
+                for (int level = referenceLevel + 1; level <= maxLevel; level++)
+                {
+                    float* set = GetConfiguredSet(level, noiseType, fractalType, perturbType, cellularReturnType);
+
+                    INFO("noise type " << noiseType << ", perturb type " << perturbType << ", SIMD level " << level);
+                    REQUIRE(std::memcmp(set, expected, size * sizeof(float)) == 0);
+
+                    FastNoiseSIMD::FreeNoiseSet(set);
+                }
+
+                FastNoiseSIMD::FreeNoiseSet(expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("instances of different SIMD levels side by side", "[FastNoiseSIMD]")
+{
+    const int defaultLevel = FastNoiseSIMD::GetSIMDLevel();
+
+    FastNoiseSIMD* low = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(FN_NO_SIMD_FALLBACK);
+    FastNoiseSIMD* high = FastNoiseSIMD::NewFastNoiseSIMD();
+    REQUIRE(FastNoiseSIMD::GetSIMDLevel() == defaultLevel);
+    REQUIRE(low->GetInstanceSIMDLevel() <= high->GetInstanceSIMDLevel());
+
+    // Requests above the detected level get the detected level
+    FastNoiseSIMD* unsupported = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(FN_NEON + 1);
+    REQUIRE(unsupported->GetInstanceSIMDLevel() == high->GetInstanceSIMDLevel());
+    delete unsupported;
+
+    // A set from either instance can be filled by the other and freed by FreeNoiseSet()
+    float* lowSet = low->GetNoiseSet(0, 0, 0, 4, 4, 13);
+    float* highSet = high->GetNoiseSet(0, 0, 0, 4, 4, 13);
+    high->FillNoiseSet(lowSet, 0, 0, 0, 4, 4, 13);
+    low->FillNoiseSet(highSet, 0, 0, 0, 4, 4, 13);
+
+    for (int i = 0; i < 4 * 4 * 13; i++)
+        REQUIRE(lowSet[i] == Approx(highSet[i]).margin(1e-5));
+
+    FastNoiseSIMD::FreeNoiseSet(lowSet);
+    FastNoiseSIMD::FreeNoiseSet(highSet);
+    delete low;
+    delete high;
+}
+
+TEST_CASE("instances created concurrently match", "[FastNoiseSIMD]")
+{
+    const int threadCount = 8;
+    const int size = 4 * 4 * 13;
+
+    // Every constructor and the first fill run at the same time, nothing is initialised beforehand
+    std::vector<float*> sets(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&sets, t]()
+        {
+            FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(FastNoiseSIMD::GetSIMDLevel() - t % 2, 1337);
+            sets[t] = noise->GetNoiseSet(0, 0, 0, 4, 4, 13);
+            delete noise;
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int t = 2; t < threadCount; t++)
+    {
+        INFO("thread " << t);
+        REQUIRE(std::memcmp(sets[t], sets[t % 2], size * sizeof(float)) == 0);
+    }
+
+    for (float* set : sets)
+        FastNoiseSIMD::FreeNoiseSet(set);
+}
@@ -0,0 +1,171 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+// Golden sets are xSize * ySize * zSize, only the first GOLDEN_Z_SIZE of each z row is stored
+// The region crosses a lattice cell boundary on every axis at GOLDEN_FREQUENCY
+#define GOLDEN_X_START -13
+#define GOLDEN_Y_START 5
+#define GOLDEN_Z_START 91
+#define GOLDEN_X_SIZE 3
+#define GOLDEN_Y_SIZE 3
+#define GOLDEN_Z_SIZE 13
+#define GOLDEN_FREQUENCY 0.35f
+#define GOLDEN_SAMPLE_COUNT (GOLDEN_X_SIZE * GOLDEN_Y_SIZE * GOLDEN_Z_SIZE)
+
+#include "golden_data.h"
+
+struct GoldenMode
+{
+    FastNoiseSIMD::NoiseType noiseType;
+    FastNoiseSIMD::FractalType fractalType;
+    FastNoiseSIMD::PerturbType perturbType;
+    FastNoiseSIMD::CellularReturnType cellularReturnType;
+    FastNoiseSIMD::CellularDistanceFunction cellularDistanceFunction;
+    float tolerance;
+};
+
+// FMA changes the last bits, octaves that feed into the next (ErodedFBM, fractal perturbs) carry that further
+// The rsqrt estimate used by cellular jitter and perturb normalise differs more between levels
+static std::vector<GoldenMode> GetGoldenModes()
+{
+    const float defaultTolerance = 1e-5f;
+    const float feedbackTolerance = 1e-4f;
+    const float rsqrtTolerance = 5e-3f;
+
+    std::vector<GoldenMode> modes;
+    GoldenMode mode = { FastNoiseSIMD::Value, FastNoiseSIMD::FBM, FastNoiseSIMD::None, FastNoiseSIMD::Distance, FastNoiseSIMD::Euclidean, defaultTolerance };
+
+    for (int noiseType = FastNoiseSIMD::Value; noiseType <= FastNoiseSIMD::CubicFractal; noiseType++)
+    {
+        mode.noiseType = FastNoiseSIMD::NoiseType(noiseType);
+        mode.tolerance = mode.noiseType == FastNoiseSIMD::Cellular ? rsqrtTolerance : defaultTolerance;
+        modes.push_back(mode);
+    }
+
+    const FastNoiseSIMD::NoiseType fractalNoiseTypes[] = { FastNoiseSIMD::ValueFractal, FastNoiseSIMD::PerlinFractal,
+        FastNoiseSIMD::SimplexFractal, FastNoiseSIMD::OpenSimplex2Fractal, FastNoiseSIMD::CubicFractal };
+
+    for (FastNoiseSIMD::NoiseType noiseType : fractalNoiseTypes)
+    {
+        for (int fractalType = FastNoiseSIMD::FBM; fractalType <= FastNoiseSIMD::ErodedFBM; fractalType++)
+        {
+            mode.noiseType = noiseType;
+            mode.fractalType = FastNoiseSIMD::FractalType(fractalType);
+            mode.tolerance = mode.fractalType == FastNoiseSIMD::ErodedFBM ? feedbackTolerance : defaultTolerance;
+            modes.push_back(mode);
+        }
+    }
+    mode.fractalType = FastNoiseSIMD::FBM;
+
+    for (int perturbType = FastNoiseSIMD::Gradient; perturbType <= FastNoiseSIMD::OpenSimplex2GradientFractal; perturbType++)
+    {
+        mode.noiseType = FastNoiseSIMD::Simplex;
+        mode.perturbType = FastNoiseSIMD::PerturbType(perturbType);
+        bool normalise = mode.perturbType == FastNoiseSIMD::Normalise || mode.perturbType == FastNoiseSIMD::Gradient_Normalise ||
+            mode.perturbType == FastNoiseSIMD::GradientFractal_Normalise;
+        bool fractal = mode.perturbType == FastNoiseSIMD::GradientFractal || mode.perturbType == FastNoiseSIMD::SimplexGradientFractal ||
+            mode.perturbType == FastNoiseSIMD::OpenSimplex2GradientFractal;
+        mode.tolerance = normalise ? rsqrtTolerance : fractal ? feedbackTolerance : defaultTolerance;
+        modes.push_back(mode);
+    }
+    mode.perturbType = FastNoiseSIMD::None;
+
+    for (int distanceFunction = FastNoiseSIMD::Euclidean; distanceFunction <= FastNoiseSIMD::Natural; distanceFunction++)
+    {
+        for (int returnType = FastNoiseSIMD::CellValue; returnType <= FastNoiseSIMD::Distance2Cave; returnType++)
+        {
+            mode.noiseType = FastNoiseSIMD::Cellular;
+            mode.cellularDistanceFunction = FastNoiseSIMD::CellularDistanceFunction(distanceFunction);
+            mode.cellularReturnType = FastNoiseSIMD::CellularReturnType(returnType);
+            mode.tolerance = rsqrtTolerance;
+            modes.push_back(mode);
+        }
+    }
+
+    return modes;
+}
+
+static float* GetGoldenSet(int level, const GoldenMode& mode, int zSize)
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(level, 1337);
+    noise->SetFrequency(GOLDEN_FREQUENCY);
+    noise->SetNoiseType(mode.noiseType);
+    noise->SetFractalType(mode.fractalType);
+    noise->SetFractalOctaves(4);
+    noise->SetPerturbType(mode.perturbType);
+    noise->SetPerturbAmp(2.0f);
+    noise->SetCellularReturnType(mode.cellularReturnType);
+    noise->SetCellularDistanceFunction(mode.cellularDistanceFunction);
+
+    float* set = noise->GetNoiseSet(GOLDEN_X_START, GOLDEN_Y_START, GOLDEN_Z_START, GOLDEN_X_SIZE, GOLDEN_Y_SIZE, zSize);
+
+    delete noise;
+    return set;
+}
+
+TEST_CASE("noise output matches golden data at every SIMD level", "[FastNoiseSIMD]")
+{
+    const std::vector<GoldenMode> modes = GetGoldenModes();
+    REQUIRE(modes.size() == sizeof(s_goldenData) / sizeof(s_goldenData[0]));
+
+    const int starts[] = { GOLDEN_X_START, GOLDEN_Y_START, GOLDEN_Z_START };
+    const int sizes[] = { GOLDEN_X_SIZE, GOLDEN_Y_SIZE, GOLDEN_Z_SIZE };
+    for (int axis = 0; axis < 3; axis++)
+        REQUIRE(std::floor(starts[axis] * GOLDEN_FREQUENCY) != std::floor((starts[axis] + sizes[axis] - 1) * GOLDEN_FREQUENCY));
+
+    // zSize 16 fills whole vectors at every level, 13 leaves a partial vector
+    const int zSizes[] = { 16, GOLDEN_Z_SIZE };
+
+    for (int level = FN_NO_SIMD_FALLBACK; level <= FastNoiseSIMD::GetSIMDLevel(); level++)
+    {
+        for (int zSize : zSizes)
+        {
+            for (size_t m = 0; m < modes.size(); m++)
+            {
+                float* set = GetGoldenSet(level, modes[m], zSize);
+
+                for (int i = 0; i < GOLDEN_SAMPLE_COUNT; i++)
+                {
+                    int row = i / GOLDEN_Z_SIZE;
+                    float value = set[row * zSize + i % GOLDEN_Z_SIZE];
+
+                    INFO("mode " << m << ", SIMD level " << level << ", zSize " << zSize << ", sample " << i);
+                    REQUIRE(value == Approx(s_goldenData[m][i]).margin(modes[m].tolerance));
+                }
+
+                FastNoiseSIMD::FreeNoiseSet(set);
+            }
+        }
+    }
+}
+
+// Writes golden_data.h to the working directory from the lowest compiled level, only run after an intended output change
+TEST_CASE("generate golden data", "[.generate_golden]")
+{
+    const std::vector<GoldenMode> modes = GetGoldenModes();
+
+    std::ofstream file("golden_data.h");
+    file << "// Generated by the \"[.generate_golden]\" test case, see golden.cpp\n";
+    file << "static const float s_goldenData[][GOLDEN_SAMPLE_COUNT] =\n{\n";
+    file << std::setprecision(9) << std::showpoint;
+
+    for (size_t m = 0; m < modes.size(); m++)
+    {
+        float* set = GetGoldenSet(FN_NO_SIMD_FALLBACK, modes[m], GOLDEN_Z_SIZE);
+
+        file << "    { ";
+        for (int i = 0; i < GOLDEN_SAMPLE_COUNT; i++)
+            file << set[i] << "f" << (i + 1 < GOLDEN_SAMPLE_COUNT ? ", " : " ");
+        file << "},\n";
+
+        FastNoiseSIMD::FreeNoiseSet(set);
+    }
+
+    file << "};\n";
+}
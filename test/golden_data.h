@@ -0,0 +1,82 @@
+// Generated by the "[.generate_golden]" test case, see golden.cpp
+static const float s_goldenData[][GOLDEN_SAMPLE_COUNT] =
+{
+    { 0.307040274f, 0.271356344f, -0.112280309f, -0.397792935f, -0.292974204f, 0.327682734f, 0.666698277f, 0.675306916f, 0.702490985f, 0.713114977f, 0.632587433f, 0.426530510f, 0.370270073f, 0.279537022f, 0.240754381f, -0.159009904f, -0.456525177f, -0.336137056f, 0.373054206f, 0.760428905f, 0.762365878f, 0.764278591f, 0.765026152f, 0.689661980f, 0.496817350f, 0.444096476f, 0.139519826f, 0.111088373f, -0.0971337706f, -0.252098262f, -0.181982264f, 0.228860408f, 0.453271091f, 0.448581129f, 0.428243309f, 0.420294940f, 0.340577871f, 0.136594892f, 0.0814037099f, 0.104899459f, 0.0642465353f, -0.284081101f, -0.543315828f, -0.436634123f, 0.191284478f, 0.534266472f, 0.561843693f, 0.658967197f, 0.696924627f, 0.664444089f, 0.581331611f, 0.558948517f, 0.0160055757f, -0.0307327826f, -0.405512899f, -0.684434295f, -0.562806547f, 0.151083529f, 0.541024804f, 0.584471822f, 0.739518642f, 0.800113440f, 0.745156705f, 0.604531348f, 0.566582859f, -0.0358576477f, -0.0792003423f, -0.372421116f, -0.590643823f, -0.499568760f, 0.0361193419f, 0.328723133f, 0.345799506f, 0.404856086f, 0.427936375f, 0.324378997f, 0.0593925118f, -0.0117334211f, 0.0967364386f, 0.0566347279f, -0.284212887f, -0.537880778f, -0.435888350f, 0.165130436f, 0.493419170f, 0.523198664f, 0.628646433f, 0.669857144f, 0.649362922f, 0.596921504f, 0.582880616f, 0.00415407121f, -0.0422592461f, -0.411308199f, -0.685964286f, -0.569476902f, 0.115146458f, 0.489101708f, 0.536386728f, 0.705811501f, 0.772025406f, 0.727358758f, 0.613064170f, 0.582290471f, -0.0364946127f, -0.0800736770f, -0.380351573f, -0.603826404f, -0.514744580f, 0.0104254484f, 0.297284067f, 0.315973043f, 0.381057709f, 0.406493872f, 0.306411117f, 0.0503156185f, -0.0183604583f },
+    { 0.128394574f, 0.220326632f, -0.139262959f, -0.0405719802f, -0.239323109f, 0.0180938132f, 0.250286579f, 0.397662669f, 0.500572383f, 0.581523359f, 0.188636363f, 0.0433064252f, 0.204041928f, 0.344020486f, 0.286872149f, -0.0756014213f, -0.0970365554f, -0.251412481f, 0.0417868756f, 0.607872784f, 0.535864115f, 0.470061034f, 0.519620776f, 0.299227178f, 0.148701981f, 0.0716821700f, 0.0417220779f, 0.0427527018f, 0.205952987f, -0.0546310060f, -0.153558388f, -0.0166300628f, 0.407109082f, 0.210116789f, 0.236891702f, 0.237152889f, 0.221106693f, 0.0306723118f, -0.0557301715f, -0.0379746780f, 0.0916314647f, -0.194820791f, -0.295388877f, -0.310168535f, -0.0323254913f, 0.361477256f, 0.366598636f, 0.346582681f, 0.549790144f, 0.346501350f, 0.226749688f, 0.210911915f, -0.0280588157f, -0.0969510749f, -0.138411090f, -0.394132316f, -0.277510077f, 0.146133825f, 0.343219638f, 0.322754562f, 0.380916297f, 0.500061214f, 0.226871535f, 0.308808386f, 0.270896435f, -0.0647163168f, -0.129596651f, -0.154697463f, -0.136385635f, -0.244775727f, -0.137808666f, 0.0440433845f, 0.149646208f, 0.341928869f, 0.267237663f, 0.120199665f, -0.0710796490f, -0.0575302802f, 0.0457316004f, 0.141148865f, -0.125905678f, -0.411232322f, -0.258064449f, -0.00365155353f, 0.446655214f, 0.202360541f, 0.194941625f, 0.405676872f, 0.227029517f, 0.220066369f, 0.314017206f, -0.121189922f, -0.110650733f, -0.274496913f, -0.512282252f, -0.432769388f, 0.132880732f, 0.375112265f, 0.231541947f, 0.304324776f, 0.402084500f, 0.226759672f, 0.294203460f, 0.366212815f, -0.0490679927f, -0.147245079f, -0.351957589f, -0.314955354f, -0.325350791f, -0.0527287461f, -0.0703634322f, 0.208565414f, 0.325365484f, 0.179510489f, 0.0266822949f, -0.0291909557f, 0.0340915136f },
+    { -0.633587360f, -0.503916621f, -0.127184898f, -0.0414115489f, -0.192701891f, -0.170043632f, 0.194007456f, 0.360039651f, 0.165787101f, 0.303342938f, 0.689042509f, 0.592203379f, 0.181285635f, -0.464619637f, -0.297509402f, 0.0897344798f, 0.147633731f, -0.0800110549f, -0.383474439f, -0.151874214f, 0.0905423537f, 0.0426849127f, 0.231987223f, 0.663485587f, 0.655554414f, 0.258770019f, -0.0175506175f, 0.0290308595f, 0.295803487f, 0.421026349f, 0.228344768f, -0.362294674f, -0.381399751f, -0.0520464107f, 0.206816912f, 0.273492485f, 0.397223175f, 0.503095925f, 0.455937296f, -0.408037513f, -0.0813626498f, 0.165705144f, -0.134006500f, -0.450442731f, -0.395500183f, 0.104766726f, 0.302045226f, 0.0720748901f, 0.164831758f, 0.488636434f, 0.296101868f, -0.118251950f, -0.370968163f, 0.00374654680f, 0.293563724f, -0.0277187228f, -0.413407624f, -0.564064384f, -0.158215463f, 0.0402984470f, -0.167196333f, -0.0397584215f, 0.416181833f, 0.470793456f, 0.0908081830f, 0.0430663526f, 0.161046118f, 0.409356594f, 0.246755034f, -0.170246333f, -0.659656525f, -0.566543996f, -0.314655632f, -0.0816741437f, -0.000184684992f, 0.166244671f, 0.381376386f, 0.363737166f, -0.102887034f, 0.237897485f, 0.489007115f, 0.173509657f, -0.194473445f, -0.333359629f, 0.0733960271f, 0.278269291f, 0.0607103109f, 0.154077530f, 0.444908917f, 0.191071570f, -0.221097708f, -0.00995039940f, 0.376241326f, 0.627045274f, 0.256351233f, -0.179515421f, -0.499007642f, -0.175669730f, 0.0175614804f, -0.207403958f, -0.0865617469f, 0.356375307f, 0.392788947f, 0.0256356094f, 0.259607434f, 0.385544479f, 0.611828387f, 0.411794245f, -0.0320645049f, -0.546872377f, -0.466894627f, -0.250953019f, -0.103267752f, -0.0440797508f, 0.0909587145f, 0.216855228f, 0.184275731f },
+    { -0.325189233f, -0.254728973f, -0.00624015974f, -0.0367105640f, -0.132244229f, -0.118168451f, 0.130060568f, 0.279117584f, -0.00308774528f, -0.00543521671f, 0.469911158f, 0.381209821f, 0.0296501853f, -0.207769006f, -0.239364266f, 0.0884419903f, 0.157764778f, 0.00641833199f, -0.300420612f, -0.142999381f, -0.000164091602f, -0.0247851778f, 0.177902669f, 0.199636176f, 0.347149760f, 0.170626298f, -0.00143687136f, 0.118336096f, 0.136191666f, 0.279998928f, 0.144735962f, -0.122285865f, -0.193844363f, 0.0476684086f, 0.128490135f, 0.0623251311f, 0.328834444f, 0.175769821f, 0.233794808f, -0.155611232f, 0.00991235580f, 0.0312698632f, -0.118256964f, -0.314243585f, -0.327010065f, 0.146329209f, 0.186411858f, -0.0539720617f, 0.0838955268f, 0.328205734f, 0.161715701f, -0.0595154949f, -0.188549429f, -0.0218219999f, 0.121668436f, 0.0102581419f, -0.170936406f, -0.425658345f, -0.118538730f, 0.0326489992f, -0.133183718f, -0.169499367f, 0.209611267f, 0.260959744f, 0.0888506845f, -0.0417015851f, 0.0864068344f, 0.282027662f, 0.187563553f, 0.0665397197f, -0.366448164f, -0.405489177f, -0.159982592f, 0.0614362508f, 0.103998370f, 0.184450567f, 0.115901507f, 0.172137529f, 0.0678459555f, 0.248532280f, 0.157324836f, 0.106939398f, -0.224629611f, -0.272559583f, 0.248012900f, 0.259195149f, -0.00393351121f, 0.0651405230f, 0.266026884f, 0.173880026f, -0.0704185814f, -0.116078451f, 0.233577982f, 0.420120746f, 0.225070268f, 0.00834543910f, -0.292035669f, -0.0724783838f, 0.0772662982f, -0.134723186f, -0.0957325399f, 0.173047125f, 0.308917016f, 0.0139060225f, 0.0236144438f, 0.0938251689f, 0.336483330f, 0.0820939317f, -0.0281141698f, -0.374189466f, -0.209293857f, -0.200436056f, -0.0682610944f, -0.0241140481f, 0.0508382469f, 0.0537088625f, 0.144088343f },
+    { -0.593732119f, -0.378377259f, -0.477345884f, 0.253225684f, 0.0602514483f, -0.364279836f, -0.237590134f, 0.147980243f, 0.892002702f, 0.483207017f, 0.373345375f, 0.294234812f, 0.100982793f, -0.195573345f, -0.0325150639f, 0.0940963551f, 0.253607810f, 0.404599011f, 0.0653650612f, 0.0903242156f, 0.315870732f, 0.256642103f, 0.542184234f, -0.170494124f, 0.158137575f, 0.0256605744f, 0.201135159f, 0.319356352f, 0.344424248f, 0.696073771f, 0.800116956f, -0.187401593f, -0.549306035f, -0.797443688f, -0.330266118f, -0.00218659011f, -0.491820514f, 0.502602160f, 0.377896309f, 0.355936527f, -0.0395542495f, -0.468699008f, 0.571836770f, 0.670484304f, 0.736151874f, 0.485033423f, 0.107393838f, 0.322667956f, 0.426888525f, 0.318240643f, -0.173938632f, -0.138845697f, 0.866547883f, -0.00890246034f, -0.693748236f, -0.432742983f, 0.150005147f, 0.254847407f, 0.424081504f, -0.165767282f, -0.209696054f, 0.591439962f, 0.647588313f, 0.635210335f, 0.543973744f, 0.629534543f, -0.0739492774f, 0.223417729f, 0.738973618f, -0.0338356718f, -0.818358898f, -0.213055909f, -0.566052973f, 0.0716083720f, 0.672261119f, -0.426939011f, -0.226189002f, 0.193860978f, -0.0200930201f, -0.648091972f, -0.221827552f, 0.217939690f, 0.236876667f, -0.00365683436f, 0.576859832f, 0.590970457f, -0.357441038f, -0.352255285f, 0.141312093f, -0.633751452f, -0.495794117f, -0.00524159474f, -0.931483269f, -0.608922243f, 0.0121836215f, 0.679241598f, 0.0982250124f, 0.818700135f, -0.238266826f, -0.855539083f, -0.497340977f, 0.430513620f, 0.106210321f, 0.484554261f, 0.224418908f, -0.421926200f, -0.610686958f, 0.121765256f, -0.0966585204f, -0.663179755f, -0.0388893038f, -0.822621346f, -0.212224156f, 0.137741461f, 0.505153179f, 0.325297087f, 0.753093719f },
+    { -0.230761766f, 0.0184757877f, -0.152534977f, -0.108367249f, -0.0958768278f, -0.221957639f, -0.0505504981f, -0.0561011769f, 0.494520307f, 0.399226278f, 0.159215719f, 0.0341488831f, 0.100435510f, -0.122535139f, -0.0545901880f, -0.143644050f, 0.201322019f, 0.0712717175f, -0.186531261f, 0.0528061055f, 0.333800465f, 0.130311772f, 0.0759707466f, 0.0743073672f, 0.192283481f, 0.202840880f, -0.103315465f, 0.398950160f, 0.0744278282f, 0.442907244f, 0.540559590f, -0.00511037931f, -0.366129726f, -0.216074571f, -0.296083659f, 0.0660054311f, -0.101572044f, 0.319218874f, 0.498612165f, 0.165209830f, 0.188745901f, -0.110425107f, 0.509767354f, 0.448827595f, 0.290704221f, 0.157361582f, -0.158813819f, 0.0118275452f, 0.195347130f, -0.0279434919f, 0.185091004f, -0.123217605f, 0.429369986f, 0.0304784719f, -0.473715365f, -0.207067743f, 0.221427470f, 0.318723917f, 0.374064714f, -0.0721634775f, -0.0826301202f, 0.330228984f, 0.339825779f, 0.213573441f, 0.556199074f, 0.463890195f, -0.194807097f, 0.231744349f, 0.461510271f, -0.223875433f, -0.362391353f, -0.286370695f, -0.0747494549f, 0.103522062f, 0.255387634f, -0.0398826413f, 0.0357245021f, 0.219763741f, -0.0402128883f, -0.350106806f, -0.279848993f, 0.137886971f, -0.00755858468f, -0.155455664f, 0.155928269f, 0.101889074f, 0.00313305482f, -0.282382190f, 0.203045577f, -0.238596708f, -0.144524664f, 0.0738485157f, -0.594929755f, -0.465514034f, -0.00801614206f, 0.307980448f, 0.133018553f, 0.548609555f, -0.362542927f, -0.482411206f, -0.130915985f, 0.383238465f, -0.0818608329f, 0.183063120f, -0.0420989543f, -0.187863246f, -0.605936170f, 0.256561339f, -0.219895035f, -0.418783158f, -0.0305225793f, -0.559869707f, -0.0152646033f, 0.00790544413f, 0.178438351f, 0.273905188f, 0.318008453f },
+    { -0.132248193f, -0.199030802f, 0.0356282443f, 0.237652317f, -0.271104962f, -0.364499182f, 0.420514882f, -0.772638917f, -0.207337737f, 0.0869864821f, -0.329742163f, -0.409275949f, -0.792919397f, -0.110744685f, 0.337176412f, 0.267958939f, -0.128027886f, -0.256029069f, -0.555956304f, 0.302570313f, 0.851700664f, 0.420962155f, 0.247069299f, -0.532195568f, -0.226340473f, -0.421499193f, 0.0503909066f, 0.112456962f, -0.404989034f, 0.200811371f, -0.404859543f, -0.182897389f, 0.0507993475f, 0.00000000f, 0.0138865514f, 0.0272421576f, 0.0256721377f, 0.711006939f, 0.301160216f, 0.440962553f, 0.412826240f, 0.482027590f, 0.379734039f, -0.419556588f, -0.0566795655f, 0.876675129f, -0.276013732f, -0.169541657f, 0.504007936f, 0.620417714f, 0.347343773f, -0.746183097f, 0.701600552f, 0.370204955f, -0.349370837f, -0.868650019f, -0.274530709f, -0.0755074471f, 0.0551895350f, 0.497964174f, -0.376182824f, -0.291917145f, 0.383015901f, 0.314538598f, -0.423528731f, -0.0851361752f, -0.0807040334f, -0.443081170f, 0.429408520f, 0.140797526f, 0.179029226f, -0.238490582f, 0.106080987f, 0.326667637f, 0.127400070f, 0.403705031f, 0.612623394f, 0.0910473168f, -0.126047373f, -0.327367008f, 0.161168084f, -0.0571188778f, -0.0733768791f, -0.327883422f, 0.160766482f, 0.401128411f, -0.0342108682f, 0.552249074f, 0.564025104f, 0.754452109f, 0.129949033f, -0.518360794f, -0.751556873f, -0.377928972f, -0.348830193f, 0.646813154f, 0.197692066f, -0.431931376f, 0.713532269f, -0.264939368f, -0.331818074f, 0.301359236f, 0.299843907f, 0.181165308f, -0.109119102f, 0.0403847396f, -0.177878544f, 0.117235184f, 0.662337065f, 0.159884617f, -0.920477450f, -0.325158834f, 0.106539346f, -0.0295706093f, -0.264819741f, -0.584516048f, 0.132018909f },
+    { -0.194225848f, 0.0749091059f, 0.0931577906f, 0.305154264f, -0.0316255689f, -0.0803398862f, 0.198510289f, -0.505405784f, -0.0670453832f, -0.105374344f, -0.0514624193f, -0.332873344f, -0.590717554f, -0.0831998363f, -0.0362010449f, 0.344960898f, -0.348592192f, -0.0895501971f, -0.104537845f, 0.0193124227f, 0.645963967f, 0.161063895f, -0.0270633437f, -0.410965949f, -0.122769617f, -0.0250946488f, 0.0844664425f, -0.0215818249f, -0.473087847f, -0.139800042f, -0.105570599f, -0.199723184f, -0.00450323056f, -0.196147263f, -0.0257724617f, 0.202085793f, 0.292000949f, 0.292584240f, 0.410957128f, -0.0176327713f, 0.356883705f, 0.258846104f, 0.288598090f, 0.0134621011f, 0.175147489f, 0.479336321f, 0.0854906887f, -0.215812594f, 0.389047176f, 0.377614886f, 0.121671155f, -0.498752028f, 0.467808366f, 0.211490437f, -0.286268264f, -0.462013215f, -0.119868383f, -0.0940096751f, 0.135235295f, 0.146950915f, -0.115399197f, -0.145909354f, 0.114388004f, 0.401094615f, -0.364637077f, -0.217604399f, 0.186432153f, -0.305831164f, 0.140283868f, 0.135357678f, 0.0305167623f, -0.219077125f, 0.000481895637f, 0.0610342100f, 0.223799556f, 0.337229192f, 0.170942932f, 0.0982168019f, 0.0592365861f, -0.126206622f, 0.163708135f, -0.273332357f, -0.0721473917f, -0.0186076146f, 0.0294792131f, -0.00847552624f, 0.117471874f, 0.152751625f, 0.232989788f, 0.448406428f, 0.00909387320f, -0.162102088f, -0.605093360f, -0.115268253f, -0.322046489f, 0.558518887f, 0.368881047f, -0.350732446f, 0.331825674f, -0.361460239f, -0.461850107f, 0.0728352591f, 0.00562551664f, 0.0167732500f, -0.0423381142f, 0.206517264f, -0.212903604f, 0.260810077f, 0.295981109f, 0.287680954f, -0.731158018f, -0.108339846f, 0.0339768194f, -0.0402932577f, -0.0269999504f, -0.373658627f, 0.0818904415f },
+    { 0.268051535f, 0.925448835f, 0.721657753f, 0.502745926f, -0.576576471f, 0.615978360f, 0.677006066f, 0.234565020f, -0.794268847f, -0.670630813f, -0.155683041f, -0.990792036f, 0.700805664f, 0.970501423f, -0.531194746f, -0.114953354f, -0.406386644f, -0.345779449f, -0.994061649f, 0.454348087f, -0.320470810f, -0.964216650f, 0.533617854f, 0.00378436456f, 0.718922019f, 0.572683334f, 0.707278669f, 0.194198042f, 0.984008789f, -0.111975417f, 0.234831065f, 0.654562593f, -0.439426392f, -0.0461575873f, 0.324760139f, -0.954694629f, 0.370548487f, -0.170520395f, -0.450123757f, -0.253913999f, 0.457246155f, -0.443061829f, -0.294424951f, 0.0150357559f, -0.575993299f, -0.00482050376f, 0.0889948159f, -0.795006514f, 0.0333081782f, -0.795658231f, 0.293246537f, -0.440158367f, 0.941917717f, 0.647514105f, -0.233288676f, 0.605882168f, -0.731089115f, -0.0447171107f, 0.523104906f, 0.716984987f, 0.914979994f, 0.486389428f, -0.500966311f, 0.327512860f, 0.201319441f, -0.696894646f, 0.141238973f, -0.0419855081f, -0.905164719f, 0.534655750f, -0.262362540f, 0.0379868373f, 0.791679621f, 0.727863312f, -0.930953145f, 0.475506335f, 0.0110557079f, 0.933149815f, 0.649399281f, -0.857187271f, 0.327034503f, -0.999642372f, 0.0661943704f, 0.110062703f, -0.437500000f, -0.904150844f, 0.402686447f, 0.573392570f, -0.498352677f, 0.233123660f, 0.672965229f, -0.0825227574f, -0.472964495f, 0.161064133f, 0.773397803f, -0.554528952f, 0.710937500f, 0.476958036f, 0.580422878f, 0.177124724f, 0.0927416980f, 0.448814005f, 0.0890116543f, 0.136207372f, 0.365987778f, 0.450498253f, 0.900036991f, 0.154408932f, -0.143363744f, -0.243126795f, 0.0284661241f, -0.602790654f, -0.249490976f, -0.509600997f, 0.251406938f, -0.298218936f, 0.259735614f },
+    { 0.317630410f, 0.266189158f, 0.143253446f, 0.0432141572f, 0.188175648f, 0.112102769f, 0.187738165f, 0.178418756f, 0.138908207f, 0.0228107218f, 0.151713714f, 0.113725491f, 0.197366104f, 0.538601220f, 0.256964445f, 0.220327765f, 0.227982581f, 0.370253772f, 0.200889155f, 0.262453198f, 0.0726288110f, 0.127802283f, 0.0400815085f, 0.168984503f, 0.0376106836f, 0.121251300f, 0.312446624f, 0.135018021f, 0.202588946f, 0.515157700f, 0.477729678f, 0.463314295f, 0.401663303f, 0.211838901f, 0.267012388f, 0.0851844102f, 0.143109500f, 0.206495926f, 0.290136546f, 0.374087989f, 0.0924511999f, 0.0558145232f, 0.264175713f, 0.176816911f, 0.00745228305f, 0.0830876827f, 0.403721452f, 0.269349307f, 0.153251827f, 0.276063502f, 0.114703149f, 0.198343754f, 0.364863276f, 0.0832265019f, 0.0465898290f, 0.254951030f, 0.265603274f, 0.0962386727f, 0.171874076f, 0.370559990f, 0.253199816f, 0.0661236644f, 0.124048762f, 0.0385883413f, 0.122228958f, 0.600638688f, 0.319001973f, 0.282365292f, 0.247474909f, 0.261066735f, 0.327786744f, 0.505660653f, 0.509770095f, 0.225943625f, 0.0388674811f, 0.0845913291f, 0.207473576f, 0.291114211f, 0.445349902f, 0.163713112f, 0.127076432f, 0.335437626f, 0.317166299f, 0.147801667f, 0.223437071f, 0.544070840f, 0.644790292f, 0.528692782f, 0.522041023f, 0.360680670f, 0.420739174f, 0.436125189f, 0.154488415f, 0.117851742f, 0.104914702f, 0.118506536f, 0.236588061f, 0.312223464f, 0.632857263f, 0.451882750f, 0.264806598f, 0.322731704f, 0.272269040f, 0.254600883f, 0.640609086f, 0.390263885f, 0.276644200f, 0.0452367216f, 0.0588285550f, 0.208961144f, 0.469177663f, 0.400341481f, 0.424626559f, 0.237550423f, 0.246358007f, 0.179498032f, 0.296191037f },
+    { 0.145812675f, 0.101628356f, -0.0407237038f, -0.141182408f, -0.0967526585f, 0.0355500355f, 0.196021259f, 0.301451355f, 0.314386725f, 0.288948685f, 0.263379127f, 0.218977168f, 0.126851559f, 0.0865389183f, 0.0125671858f, -0.112184845f, -0.168207869f, -0.0780130997f, 0.0828593299f, 0.261943966f, 0.372248977f, 0.369062006f, 0.323034048f, 0.282601357f, 0.231993273f, 0.148559853f, 0.0528147295f, -0.0364435390f, -0.102390036f, -0.102193452f, -0.0191221591f, 0.0959138274f, 0.220902905f, 0.309167296f, 0.317327261f, 0.264102578f, 0.178595915f, 0.0875699967f, 0.00820893142f, 0.100178599f, 0.0394016691f, -0.0812548026f, -0.149981365f, -0.0877765045f, 0.0477113053f, 0.198128730f, 0.279022843f, 0.264683008f, 0.235310286f, 0.224456668f, 0.209101066f, 0.186171293f, 0.0216380227f, -0.0915263593f, -0.213604063f, -0.253186375f, -0.158365026f, 0.00250148773f, 0.190011591f, 0.318264723f, 0.329891205f, 0.297997415f, 0.249397159f, 0.182461604f, 0.130125254f, 0.0155615807f, -0.121195324f, -0.220532104f, -0.237974465f, -0.154717341f, -0.0185725279f, 0.140827820f, 0.260160893f, 0.283290058f, 0.237509787f, 0.137035877f, 0.0217133723f, -0.0408601910f, 0.100276753f, 0.0566972680f, -0.0243508853f, -0.0769030452f, -0.0513008796f, 0.0254794937f, 0.115169100f, 0.156444907f, 0.140738621f, 0.150602430f, 0.199846298f, 0.243024737f, 0.274636239f, 0.0261542182f, -0.0680137426f, -0.170737341f, -0.220425248f, -0.177976355f, -0.0760468841f, 0.0566182658f, 0.153889641f, 0.174607858f, 0.180886075f, 0.172571138f, 0.141104922f, 0.137390479f, 0.0394778252f, -0.0733338743f, -0.180575460f, -0.233668163f, -0.197683543f, -0.0960805193f, 0.0311779007f, 0.125061467f, 0.148540854f, 0.123105220f, 0.0456733853f, -0.0458961688f, -0.0677262694f },
+    { 0.0858686566f, 0.0619456358f, -0.0651332587f, 0.000293916470f, -0.0722555071f, -0.0328708217f, 0.0501643755f, 0.165571094f, 0.223403841f, 0.223862469f, 0.0912356079f, 0.0290130246f, 0.0705901831f, 0.121891186f, 0.0626880303f, -0.0535615012f, -0.0513558351f, -0.0677862689f, -0.0104511334f, 0.203103453f, 0.240947366f, 0.198568299f, 0.201945573f, 0.149551436f, 0.0920290872f, 0.0251330156f, 0.00706362352f, 0.00711690914f, 0.0156080993f, -0.0264902264f, -0.0290804524f, 0.0107449442f, 0.176730096f, 0.169397965f, 0.190932557f, 0.156619847f, 0.119995467f, 0.0260722209f, -0.0325790010f, 0.000454311579f, 0.0636763871f, -0.0425471179f, -0.0761973560f, -0.0851004347f, -0.0184880979f, 0.138227791f, 0.185599402f, 0.152690053f, 0.205544531f, 0.114903465f, 0.0581341609f, 0.0795010179f, -0.0180643164f, -0.0877478868f, -0.0860543326f, -0.133506417f, -0.0890383348f, 0.0209749117f, 0.128136426f, 0.195502505f, 0.195673272f, 0.190806016f, 0.0700207427f, 0.0862835124f, 0.0505737998f, -0.0377176814f, -0.119948000f, -0.0858269930f, -0.0566405170f, -0.0587378256f, -0.0834247246f, 0.0372905657f, 0.128123343f, 0.186053947f, 0.153881863f, 0.0609173775f, -0.0308497883f, -0.0645072833f, 0.0361910835f, 0.104418941f, -0.00821901765f, -0.102415837f, -0.0580295622f, 0.00563004659f, 0.139791787f, 0.0476823747f, -0.0246573556f, 0.0675549060f, 0.0700932965f, 0.105687186f, 0.147789657f, -0.0150232082f, -0.0755898356f, -0.147524804f, -0.179117784f, -0.138314277f, 0.00582956616f, 0.0317045487f, 0.0486506708f, 0.0703519136f, 0.0721951500f, 0.0341329426f, 0.0658030286f, 0.103848033f, 0.00952096749f, -0.100973174f, -0.168820038f, -0.162699267f, -0.110279180f, -0.0676387176f, -0.0568631105f, 0.0748836771f, 0.0958890989f, 0.0522881709f, -0.0316207297f, -0.0379582718f, 0.0161491763f },
+    { 0.128394574f, 0.220326632f, -0.139262959f, -0.0405719802f, -0.239323109f, 0.0180938132f, 0.250286579f, 0.397662669f, 0.500572383f, 0.581523359f, 0.188636363f, 0.0433064252f, 0.204041928f, 0.344020486f, 0.286872149f, -0.0756014213f, -0.0970365554f, -0.251412481f, 0.0417868756f, 0.607872784f, 0.535864115f, 0.470061034f, 0.519620776f, 0.299227178f, 0.148701981f, 0.0716821700f, 0.0417220779f, 0.0427527018f, 0.205952987f, -0.0546310060f, -0.153558388f, -0.0166300628f, 0.407109082f, 0.210116789f, 0.236891702f, 0.237152889f, 0.221106693f, 0.0306723118f, -0.0557301715f, -0.0379746780f, 0.0916314647f, -0.194820791f, -0.295388877f, -0.310168535f, -0.0323254913f, 0.361477256f, 0.366598636f, 0.346582681f, 0.549790144f, 0.346501350f, 0.226749688f, 0.210911915f, -0.0280588157f, -0.0969510749f, -0.138411090f, -0.394132316f, -0.277510077f, 0.146133825f, 0.343219638f, 0.322754562f, 0.380916297f, 0.500061214f, 0.226871535f, 0.308808386f, 0.270896435f, -0.0647163168f, -0.129596651f, -0.154697463f, -0.136385635f, -0.244775727f, -0.137808666f, 0.0440433845f, 0.149646208f, 0.341928869f, 0.267237663f, 0.120199665f, -0.0710796490f, -0.0575302802f, 0.0457316004f, 0.141148865f, -0.125905678f, -0.411232322f, -0.258064449f, -0.00365155353f, 0.446655214f, 0.202360541f, 0.194941625f, 0.405676872f, 0.227029517f, 0.220066369f, 0.314017206f, -0.121189922f, -0.110650733f, -0.274496913f, -0.512282252f, -0.432769388f, 0.132880732f, 0.375112265f, 0.231541947f, 0.304324776f, 0.402084500f, 0.226759672f, 0.294203460f, 0.366212815f, -0.0490679927f, -0.147245079f, -0.351957589f, -0.314955354f, -0.325350791f, -0.0527287461f, -0.0703634322f, 0.208565414f, 0.325365484f, 0.179510489f, 0.0266822949f, -0.0291909557f, 0.0340915136f },
+    { -0.578203619f, -0.553992689f, -0.711667359f, -0.232519031f, -0.402297318f, -0.152365401f, -0.0782835558f, 0.0771337599f, 0.120296121f, 0.238357618f, -0.0277528577f, -0.176681101f, -0.322752118f, -0.311959118f, -0.406682491f, -0.413389862f, -0.220152736f, -0.414179206f, -0.0970224664f, 0.215745553f, 0.0717280284f, -0.00609227037f, 0.0392414629f, -0.0833970979f, -0.176227331f, -0.170103207f, -0.686513543f, -0.506891191f, -0.334193945f, -0.571452379f, -0.692883193f, -0.419735640f, -0.185781837f, -0.418248028f, -0.285812140f, -0.0479965881f, -0.418003410f, -0.750082731f, -0.632474422f, -0.666313231f, -0.816737175f, -0.322095245f, -0.226980731f, -0.339285672f, -0.464981854f, -0.166202858f, -0.150376111f, -0.0190975517f, 0.0995802879f, 0.151504368f, -0.126698166f, -0.200982213f, -0.719446361f, -0.806097984f, -0.411727995f, -0.0138797686f, -0.0817190111f, -0.707732379f, 0.0893044025f, -0.205401003f, -0.0405759104f, 0.0496561229f, 0.135924578f, 0.0145859644f, -0.0624645390f, -0.834470212f, -0.740806818f, -0.238377959f, -0.0127310762f, -0.362034112f, -0.647328138f, -0.348630100f, -0.250194103f, -0.242646024f, -0.376317203f, -0.442163378f, -0.730453014f, -0.772818148f, -0.658681870f, -0.632943094f, -0.466306657f, -0.0330773294f, -0.232902035f, -0.640418589f, -0.0132145891f, -0.286032617f, -0.0487708524f, -0.0408307649f, -0.0687514171f, -0.166700184f, -0.297797471f, -0.652204096f, -0.765446961f, -0.412944049f, 0.212807536f, -0.134461254f, -0.636879444f, -0.220433027f, -0.291666865f, -0.0667509586f, -0.00163895299f, 0.109631211f, -0.0714742690f, -0.0155367544f, -0.777057290f, -0.692818046f, -0.221153334f, -0.182092384f, -0.349298507f, -0.590557814f, -0.225067154f, -0.322658002f, -0.201370701f, -0.449668556f, -0.381043404f, -0.655719280f, -0.850248396f },
+    { -0.0936464071f, 0.000419169664f, 0.170751333f, 0.0489275381f, 0.0993978158f, 0.264292002f, -0.344287395f, -0.215800941f, -0.229704350f, -0.140269667f, -0.228693172f, 0.0438004881f, 0.0193797722f, 0.210964292f, 0.199726462f, 0.356927186f, -0.0569435284f, 0.00193289667f, 0.225433022f, -0.256096363f, -0.394986749f, -0.471768677f, -0.430763423f, -0.395008743f, -0.0963478237f, 0.0148353353f, 0.139853954f, 0.365112782f, 0.554925680f, 0.0225668699f, 0.0489574373f, 0.211277068f, -0.0182126537f, -0.226769745f, -0.0619354397f, 0.176913321f, -0.0105338693f, 0.0861076415f, 0.306747854f, 0.228032470f, 0.168315917f, 0.192373529f, -0.236926049f, -0.128848523f, 0.244010568f, -0.161848113f, -0.202164978f, -0.273338348f, -0.237992764f, -0.124352857f, -0.218942747f, -0.243817866f, 0.356007963f, 0.245317668f, -0.134520814f, -0.319380850f, -0.139724642f, 0.0968338773f, 0.0641732663f, -0.299007058f, -0.454577208f, -0.491174281f, -0.300384104f, -0.132888347f, -0.129226208f, 0.208468869f, 0.209593028f, 0.0941783935f, -0.130723044f, -0.276044488f, 0.383391201f, 0.0782130361f, 0.136344030f, 0.0253071934f, -0.146170139f, -0.000786125660f, 0.258915305f, 0.314516187f, 0.251512885f, 0.355846405f, 0.0569117516f, -0.0442715436f, -0.0276223198f, 0.131846666f, 0.0632729828f, -0.252052903f, -0.240515530f, -0.315493107f, -0.300680310f, -0.287624419f, -0.382446349f, 0.442750484f, 0.260374963f, -0.147251427f, -0.109921522f, -0.202511221f, 0.235132650f, -0.122359365f, -0.283711135f, -0.411701977f, -0.483087361f, -0.289438248f, -0.230635449f, -0.116646647f, 0.261019558f, 0.252835780f, 0.0944656432f, -0.315864414f, -0.294456482f, 0.488001138f, 0.256931424f, 0.128062055f, 0.111599535f, -0.172052026f, 0.0924495608f, 0.347131968f, 0.228671312f },
+    { 0.752175927f, 0.760379195f, 0.425525308f, 0.274867445f, 0.287774175f, 0.619687140f, 0.885721564f, 1.00592136f, 1.13708091f, 1.19512570f, 0.818255007f, 0.687230468f, 0.740531087f, 0.933782637f, 0.827687681f, 0.353860676f, 0.220561951f, 0.258728325f, 0.579973519f, 1.19657147f, 1.09709489f, 1.05162323f, 1.10029542f, 0.869660556f, 0.727788866f, 0.678189993f, 0.619087040f, 0.655019522f, 0.620218217f, 0.360547632f, 0.370533973f, 0.609311342f, 0.987516344f, 0.817387521f, 0.821259499f, 0.910354078f, 0.848074198f, 0.625392020f, 0.480102003f, 0.552498996f, 0.583722770f, 0.325984180f, 0.111508615f, 0.178961188f, 0.585793853f, 1.00178611f, 0.968327105f, 0.950431883f, 1.13066745f, 0.826848567f, 0.783027649f, 0.877943456f, 0.470542133f, 0.459223539f, 0.232250363f, 0.0107675176f, 0.103430867f, 0.663397431f, 1.01982856f, 0.950386047f, 0.985180616f, 1.11895454f, 0.831182241f, 0.814017773f, 0.925948024f, 0.474177480f, 0.426195443f, 0.227705270f, 0.0979088247f, 0.149335027f, 0.449470937f, 0.637611628f, 0.818951011f, 0.974579573f, 0.881891906f, 0.685321629f, 0.492687792f, 0.457628280f, 0.571183443f, 0.625389516f, 0.341763854f, 0.0997961387f, 0.174823970f, 0.602708519f, 1.06482077f, 0.857610285f, 0.859024882f, 1.00826395f, 0.821364462f, 0.816453874f, 0.926416695f, 0.432358563f, 0.437066138f, 0.215767249f, 0.00825919211f, 0.0925375223f, 0.701541424f, 0.976886928f, 0.876819074f, 0.923375905f, 1.03565943f, 0.812231481f, 0.829875708f, 1.02756274f, 0.480244458f, 0.407162845f, 0.177782685f, 0.0776716024f, 0.132201865f, 0.431539118f, 0.560805023f, 0.817656934f, 0.951542377f, 0.788638532f, 0.613164604f, 0.481116235f, 0.518460393f },
+    { 0.872424364f, 1.00176382f, 0.472216278f, 0.354066938f, 0.324348807f, 0.737650931f, 1.06473053f, 1.31151056f, 1.50475228f, 1.69238806f, 0.971902251f, 0.771509826f, 0.996237099f, 1.17289102f, 1.08289564f, 0.506192446f, 0.273566812f, 0.296842813f, 0.762593567f, 1.77495575f, 1.62627733f, 1.47260678f, 1.58154356f, 1.15835202f, 0.920504451f, 0.814082682f, 0.730911911f, 0.700235486f, 0.777984262f, 0.465405166f, 0.436973274f, 0.684782684f, 1.33741224f, 1.00884044f, 1.04163194f, 0.990798593f, 0.997316837f, 0.716351688f, 0.620167255f, 0.639670432f, 0.772529185f, 0.343898803f, 0.143515170f, 0.215339929f, 0.662178755f, 1.23792815f, 1.26731396f, 1.22692597f, 1.64838493f, 1.24382055f, 1.04330170f, 0.995084643f, 0.629450560f, 0.545194268f, 0.305635810f, 0.0137969581f, 0.128993019f, 0.869068325f, 1.16779721f, 1.18553126f, 1.29136419f, 1.51341045f, 1.01846206f, 1.17914152f, 1.07400453f, 0.570008993f, 0.499729067f, 0.324601561f, 0.130168721f, 0.191715285f, 0.530909181f, 0.774878204f, 0.876589000f, 1.18381321f, 1.08817792f, 0.876380026f, 0.598802328f, 0.589946449f, 0.729759872f, 0.812645137f, 0.389734060f, 0.123441070f, 0.234937325f, 0.689090610f, 1.39335513f, 0.987066448f, 0.972696722f, 1.33788562f, 1.03462088f, 1.02810788f, 1.17856526f, 0.534110546f, 0.530807972f, 0.241359174f, 0.0102847349f, 0.0966710970f, 0.815968037f, 1.27516305f, 1.03407562f, 1.15457249f, 1.31649184f, 1.01891148f, 1.15771770f, 1.23349130f, 0.583526731f, 0.487058342f, 0.232588917f, 0.0878182724f, 0.157793969f, 0.601305723f, 0.634117186f, 0.973565280f, 1.14924967f, 0.958649158f, 0.748891473f, 0.638124883f, 0.672711074f },
+    { 0.103338033f, 0.112773851f, -0.0310507864f, -0.0322880037f, -0.0994951203f, 0.0109106833f, 0.155828416f, 0.184488460f, 0.332603753f, 0.430751264f, 0.157616973f, 0.0219570044f, 0.0897020400f, 0.158325866f, 0.0817607194f, -0.0293057263f, -0.0807074681f, -0.0714990571f, 0.0232470725f, 0.360833824f, 0.340675682f, 0.414109439f, 0.466741383f, 0.244657695f, 0.107209377f, 0.0771739706f, 0.0373394229f, 0.0555811226f, 0.0650925487f, -0.0159755666f, -0.0449321531f, 0.0141607570f, 0.122495934f, 0.0703894198f, 0.0757369921f, 0.0868163928f, 0.0564097874f, 0.0148116918f, -0.0150481351f, 0.00722489506f, 0.0258283671f, -0.0490754507f, -0.100029878f, -0.0844430104f, 0.00434741005f, 0.298819244f, 0.300401419f, 0.195931375f, 0.248656943f, 0.181412235f, 0.218427777f, 0.248920172f, 0.00201425795f, -0.0372200124f, -0.0652559251f, -0.337235838f, -0.0974293351f, 0.0206781048f, 0.275324762f, 0.265478760f, 0.315632880f, 0.466675073f, 0.283987910f, 0.236858338f, 0.251427591f, -0.0409380943f, -0.0568172000f, -0.0934224352f, -0.126352519f, -0.107029527f, -0.0305189062f, 0.0672091246f, 0.0837608725f, 0.0852623060f, 0.0720904619f, 0.0248032864f, -0.00720489630f, -0.00570580363f, 0.0261108801f, 0.0269739330f, -0.0336552486f, -0.106183998f, -0.0621158145f, 0.00534228841f, 0.253725529f, 0.196298897f, 0.140328959f, 0.158758387f, 0.126176044f, 0.251037240f, 0.308174491f, -0.0138854971f, -0.0454161018f, -0.0923219919f, -0.381313592f, -0.119201399f, 0.0249420702f, 0.208247751f, 0.176830173f, 0.222192675f, 0.282736778f, 0.223885641f, 0.258762419f, 0.274633706f, -0.0170885101f, -0.0510076880f, -0.158594996f, -0.223436385f, -0.158998176f, -0.0245926883f, 0.0207476541f, 0.0819291025f, 0.0700156391f, 0.0486604460f, 0.0107488558f, -0.00564329140f, 0.00229280046f },
+    { -0.325189233f, -0.254728973f, -0.00624015974f, -0.0367105640f, -0.132244229f, -0.118168451f, 0.130060568f, 0.279117584f, -0.00308774528f, -0.00543521671f, 0.469911158f, 0.381209821f, 0.0296501853f, -0.207769006f, -0.239364266f, 0.0884419903f, 0.157764778f, 0.00641833199f, -0.300420612f, -0.142999381f, -0.000164091602f, -0.0247851778f, 0.177902669f, 0.199636176f, 0.347149760f, 0.170626298f, -0.00143687136f, 0.118336096f, 0.136191666f, 0.279998928f, 0.144735962f, -0.122285865f, -0.193844363f, 0.0476684086f, 0.128490135f, 0.0623251311f, 0.328834444f, 0.175769821f, 0.233794808f, -0.155611232f, 0.00991235580f, 0.0312698632f, -0.118256964f, -0.314243585f, -0.327010065f, 0.146329209f, 0.186411858f, -0.0539720617f, 0.0838955268f, 0.328205734f, 0.161715701f, -0.0595154949f, -0.188549429f, -0.0218219999f, 0.121668436f, 0.0102581419f, -0.170936406f, -0.425658345f, -0.118538730f, 0.0326489992f, -0.133183718f, -0.169499367f, 0.209611267f, 0.260959744f, 0.0888506845f, -0.0417015851f, 0.0864068344f, 0.282027662f, 0.187563553f, 0.0665397197f, -0.366448164f, -0.405489177f, -0.159982592f, 0.0614362508f, 0.103998370f, 0.184450567f, 0.115901507f, 0.172137529f, 0.0678459555f, 0.248532280f, 0.157324836f, 0.106939398f, -0.224629611f, -0.272559583f, 0.248012900f, 0.259195149f, -0.00393351121f, 0.0651405230f, 0.266026884f, 0.173880026f, -0.0704185814f, -0.116078451f, 0.233577982f, 0.420120746f, 0.225070268f, 0.00834543910f, -0.292035669f, -0.0724783838f, 0.0772662982f, -0.134723186f, -0.0957325399f, 0.173047125f, 0.308917016f, 0.0139060225f, 0.0236144438f, 0.0938251689f, 0.336483330f, 0.0820939317f, -0.0281141698f, -0.374189466f, -0.209293857f, -0.200436056f, -0.0682610944f, -0.0241140481f, 0.0508382469f, 0.0537088625f, 0.144088343f },
+    { -0.218698055f, -0.376701355f, -0.560776234f, -0.917957664f, -0.735511601f, -0.717138588f, -0.635047853f, -0.441764861f, -0.640145421f, -0.341997951f, -0.0198971443f, -0.229540840f, -0.625882387f, -0.318566948f, -0.317770749f, -0.695093274f, -0.609190583f, -0.634604573f, -0.241268858f, -0.696358919f, -0.806514859f, -0.803339601f, -0.513004482f, 0.0161635876f, -0.129202127f, -0.604487002f, -0.831597686f, -0.757629037f, -0.561328411f, -0.316717952f, -0.709433556f, -0.466333300f, -0.574035943f, -0.793630838f, -0.694910407f, -0.541199625f, -0.261933982f, -0.232045740f, -0.265700668f, -0.344486058f, -0.806601703f, -0.475919515f, -0.588404477f, -0.247915804f, -0.236805797f, -0.707341611f, -0.545581043f, -0.635257125f, -0.759402573f, -0.332558692f, -0.561057031f, -0.694961429f, -0.435486764f, -0.927303374f, -0.539140642f, -0.736298084f, -0.379068136f, -0.124569803f, -0.721260607f, -0.851573467f, -0.501818597f, -0.661001325f, -0.456202090f, -0.281565547f, -0.754894972f, -0.824721992f, -0.809218824f, -0.333547175f, -0.624872923f, -0.503728390f, -0.0902548060f, -0.179066449f, -0.604890287f, -0.601755619f, -0.698372126f, -0.631098926f, -0.199425876f, -0.403762907f, -0.583646297f, -0.502935529f, -0.173497543f, -0.494955301f, -0.550740838f, -0.300134927f, -0.384890318f, -0.427461445f, -0.679527879f, -0.686218083f, -0.433515579f, -0.547178924f, -0.380178034f, -0.767843187f, -0.532844067f, -0.159758523f, -0.549859524f, -0.498149902f, -0.235633925f, -0.765620708f, -0.768522620f, -0.706696332f, -0.683657765f, -0.445778012f, -0.323210597f, -0.853690743f, -0.418050021f, -0.287372440f, -0.147418573f, -0.273598880f, -0.685860038f, -0.182504207f, -0.377085060f, -0.532828748f, -0.841307700f, -0.696655810f, -0.814585626f, -0.614157975f, -0.632627308f },
+    { -0.409704089f, -0.298490703f, 0.282402486f, 0.119091682f, -0.0124458224f, 0.0500953346f, 0.0791277364f, -0.0717338175f, 0.130789533f, 0.135191023f, -0.334238589f, -0.337101281f, 0.113164090f, -0.165395766f, 0.169571131f, 0.231381163f, 0.196116358f, 0.307536155f, 0.0693615526f, 0.105915196f, 0.125307664f, 0.223999321f, 0.117583886f, -0.249317810f, -0.369735807f, -0.0217465460f, 0.247776017f, 0.294161081f, -0.0553524047f, -0.0764757767f, -0.0592834204f, -0.0992767811f, -0.238458142f, 0.214378297f, -0.00261230022f, 0.00814041495f, 0.0224905685f, -0.161234722f, -0.0984689295f, -0.0765307546f, 0.143585652f, 0.284915209f, 0.242857799f, -0.0708065033f, 0.0494941920f, 0.189833790f, -0.0530726463f, 0.322796702f, 0.0208965987f, -0.226546615f, -0.0556947291f, 0.174469784f, -0.0877051502f, 0.185660109f, -0.0300717652f, 0.316783130f, -0.119691595f, -0.182412952f, 0.0698872060f, 0.183552980f, 0.257652342f, 0.363294423f, -0.197553083f, -0.143054634f, 0.173169628f, 0.203190446f, -0.0182348937f, -0.0689136833f, -0.0168283954f, 0.249761909f, -0.341426909f, -0.238462761f, -0.133895889f, 0.335005820f, 0.407406807f, 0.138355419f, 0.112785473f, -0.0435020328f, 0.309557527f, 0.115202963f, -0.0781681687f, 0.251460105f, 0.157233611f, 0.114404298f, 0.554873288f, 0.105216339f, 0.304022014f, 0.111015469f, -0.233738661f, 0.167376667f, 0.263887703f, 0.322746277f, -0.189523995f, -0.341364145f, 0.0343042761f, 0.236453712f, -0.156422079f, -0.00660885870f, 0.306887031f, -0.0148357302f, 0.248447433f, -0.0681674778f, -0.0260878056f, 0.210893765f, 0.151363239f, 0.0219993815f, -0.299361676f, -0.0175874084f, 0.355377257f, -0.202342436f, -0.224806502f, 0.0610670447f, 0.0672386065f, 0.321225703f, 0.116908617f, 0.0530165061f, 0.100860372f },
+    { 0.0522544123f, 0.150549427f, 0.497259825f, 0.497422427f, 0.375406384f, 0.387087166f, 0.658850014f, 0.885475636f, 0.600072265f, 0.614358306f, 1.07210958f, 0.974599063f, 0.610442817f, 0.188353345f, 0.245739013f, 0.642080963f, 0.735477567f, 0.510642171f, 0.197222993f, 0.371351063f, 0.573282659f, 0.508197665f, 0.780589461f, 0.835131764f, 0.975859106f, 0.760313392f, 0.492965430f, 0.616842210f, 0.736674845f, 0.807433426f, 0.710662901f, 0.268243462f, 0.241658509f, 0.535336196f, 0.674822450f, 0.672379673f, 0.929737389f, 0.750707150f, 0.882313132f, 0.237871051f, 0.487487674f, 0.541700006f, 0.369835526f, 0.159150645f, 0.192432359f, 0.666736901f, 0.793822765f, 0.478357404f, 0.666968822f, 0.882963955f, 0.774607778f, 0.462277919f, 0.237731978f, 0.512693048f, 0.759388149f, 0.483600765f, 0.234011337f, 0.0923317075f, 0.382285982f, 0.555369377f, 0.341530472f, 0.441768676f, 0.782080829f, 0.897983134f, 0.648752332f, 0.538798094f, 0.652691483f, 0.914698780f, 0.760583341f, 0.485671252f, 0.0281094220f, 0.0861594677f, 0.287671149f, 0.547314405f, 0.613604128f, 0.715033054f, 0.657716990f, 0.756324410f, 0.538620472f, 0.818350434f, 0.722488999f, 0.599958658f, 0.320407510f, 0.223782852f, 0.772806883f, 0.848406196f, 0.506359458f, 0.660585880f, 0.862633646f, 0.758416116f, 0.407614499f, 0.457099944f, 0.815563440f, 1.00539005f, 0.806009591f, 0.468864530f, 0.149825349f, 0.407050341f, 0.609411299f, 0.359993339f, 0.407883793f, 0.804150045f, 0.901398003f, 0.525188565f, 0.576416910f, 0.677635193f, 0.876229644f, 0.660477400f, 0.537310898f, 0.104862362f, 0.181885764f, 0.304321140f, 0.443319321f, 0.453562021f, 0.615202188f, 0.654948771f, 0.727584362f },
+    { 0.0618005842f, 0.183822438f, 0.560531199f, 0.590690553f, 0.445357710f, 0.467493445f, 0.862570822f, 1.09634364f, 0.690398276f, 0.709343612f, 1.46901429f, 1.30401766f, 0.731518269f, 0.228024915f, 0.327145368f, 0.762694538f, 0.858346879f, 0.603295147f, 0.250992030f, 0.461017698f, 0.674463272f, 0.639880359f, 0.913960636f, 0.984788299f, 1.22629344f, 0.922005236f, 0.640811682f, 0.776632309f, 0.885122359f, 1.12788272f, 0.885152042f, 0.345451683f, 0.297742158f, 0.663656116f, 0.862915516f, 0.787715197f, 1.18173623f, 0.965708971f, 1.02605093f, 0.292565942f, 0.617160141f, 0.732521534f, 0.488697529f, 0.206612930f, 0.235032439f, 0.845336139f, 0.951174855f, 0.618113339f, 0.785883009f, 1.21054959f, 0.914174974f, 0.530531049f, 0.309086382f, 0.625590205f, 0.856508911f, 0.646121562f, 0.281256050f, 0.102127083f, 0.475357652f, 0.693561912f, 0.461887807f, 0.478502184f, 1.01411700f, 1.07363963f, 0.763263822f, 0.615996778f, 0.792387187f, 1.09801602f, 0.945245087f, 0.603742182f, 0.0364988558f, 0.104964212f, 0.360093594f, 0.650664210f, 0.735016406f, 0.917351067f, 0.867341161f, 0.944943011f, 0.643968463f, 1.02298510f, 0.933772564f, 0.826215744f, 0.386770725f, 0.291666359f, 0.926928937f, 1.04550898f, 0.666980088f, 0.757203162f, 1.09679437f, 0.897355497f, 0.455056846f, 0.535878003f, 1.04107678f, 1.38097739f, 0.995905101f, 0.541315377f, 0.176034927f, 0.497244626f, 0.717258930f, 0.437369853f, 0.526692510f, 0.934544802f, 1.15335763f, 0.672853589f, 0.740522504f, 0.839868426f, 1.23835421f, 0.826914907f, 0.589147806f, 0.124184839f, 0.227236629f, 0.375182480f, 0.538299501f, 0.607877791f, 0.725412786f, 0.763871133f, 0.860662103f },
+    { -0.306515962f, -0.115798622f, -0.00714669051f, -0.0160039309f, -0.0497392155f, -0.0355418101f, 0.0486514904f, 0.191493228f, 0.0525828227f, 0.0141948834f, 0.219816849f, 0.116706789f, 0.0230389610f, -0.0863771439f, -0.0790023133f, 0.0291975141f, 0.0440595932f, -0.00241921446f, -0.145484120f, -0.0334799886f, 0.0199049935f, 0.00295048580f, 0.0709338337f, 0.111303501f, 0.145037770f, 0.0623648837f, -0.00665364508f, 0.0276204441f, 0.0671856552f, 0.146378800f, 0.0244916584f, -0.0272381194f, -0.0914930031f, 0.00755813159f, 0.0389330424f, 0.0615287572f, 0.103550881f, 0.0967638642f, 0.172939837f, -0.0667849407f, -0.00236266083f, -0.00230619055f, -0.0411514454f, -0.192808613f, -0.116996765f, 0.0474625863f, 0.161029220f, 0.00289240316f, 0.0427162386f, 0.196222529f, 0.0461938456f, -0.0227892846f, -0.0449137390f, -0.00358735397f, 0.0722854510f, -0.00190566899f, -0.0673572496f, -0.190354273f, -0.0288409498f, 0.00903517473f, -0.0643418133f, -0.0548456609f, 0.0723194480f, 0.106812492f, 0.0199645199f, 0.00144032796f, 0.0380893610f, 0.197191313f, 0.0862394795f, -0.00300852186f, -0.253205895f, -0.213332415f, -0.0869305730f, -0.000886539929f, 0.0271596424f, 0.0520375632f, 0.0537654497f, 0.111423977f, 0.00202286197f, 0.0504276156f, 0.0650583953f, 0.0157265253f, -0.0446833558f, -0.133355677f, 0.100830376f, 0.163983613f, 0.0169177148f, 0.0361633152f, 0.201766089f, 0.0435733534f, -0.0526088290f, -0.0147494534f, 0.0668233112f, 0.268369883f, 0.0749711022f, 0.00723303435f, -0.193897888f, -0.0222496651f, 0.00921823177f, -0.0686834604f, -0.0288493726f, 0.0740355775f, 0.0956474096f, -0.00100108236f, 0.0391116031f, 0.0612237006f, 0.233051226f, 0.0265346747f, 0.00160534319f, -0.167906478f, -0.162501410f, -0.129249573f, -0.0234254245f, -0.0332280099f, 0.0219588615f, 0.0233799443f, 0.0821533650f },
+    { -0.230761766f, 0.0184757877f, -0.152534977f, -0.108367249f, -0.0958768278f, -0.221957639f, -0.0505504981f, -0.0561011769f, 0.494520307f, 0.399226278f, 0.159215719f, 0.0341488831f, 0.100435510f, -0.122535139f, -0.0545901880f, -0.143644050f, 0.201322019f, 0.0712717175f, -0.186531261f, 0.0528061055f, 0.333800465f, 0.130311772f, 0.0759707466f, 0.0743073672f, 0.192283481f, 0.202840880f, -0.103315465f, 0.398950160f, 0.0744278282f, 0.442907244f, 0.540559590f, -0.00511037931f, -0.366129726f, -0.216074571f, -0.296083659f, 0.0660054311f, -0.101572044f, 0.319218874f, 0.498612165f, 0.165209830f, 0.188745901f, -0.110425107f, 0.509767354f, 0.448827595f, 0.290704221f, 0.157361582f, -0.158813819f, 0.0118275452f, 0.195347130f, -0.0279434919f, 0.185091004f, -0.123217605f, 0.429369986f, 0.0304784719f, -0.473715365f, -0.207067743f, 0.221427470f, 0.318723917f, 0.374064714f, -0.0721634775f, -0.0826301202f, 0.330228984f, 0.339825779f, 0.213573441f, 0.556199074f, 0.463890195f, -0.194807097f, 0.231744349f, 0.461510271f, -0.223875433f, -0.362391353f, -0.286370695f, -0.0747494549f, 0.103522062f, 0.255387634f, -0.0398826413f, 0.0357245021f, 0.219763741f, -0.0402128883f, -0.350106806f, -0.279848993f, 0.137886971f, -0.00755858468f, -0.155455664f, 0.155928269f, 0.101889074f, 0.00313305482f, -0.282382190f, 0.203045577f, -0.238596708f, -0.144524664f, 0.0738485157f, -0.594929755f, -0.465514034f, -0.00801614206f, 0.307980448f, 0.133018553f, 0.548609555f, -0.362542927f, -0.482411206f, -0.130915985f, 0.383238465f, -0.0818608329f, 0.183063120f, -0.0420989543f, -0.187863246f, -0.605936170f, 0.256561339f, -0.219895035f, -0.418783158f, -0.0305225793f, -0.559869707f, -0.0152646033f, 0.00790544413f, 0.178438351f, 0.273905188f, 0.318008453f },
+    { -0.147295520f, -0.155843616f, -0.193044350f, -0.165958837f, -0.469156742f, -0.500732422f, -0.539456248f, -0.544638038f, 0.250934929f, -0.155181825f, -0.426758289f, -0.199714765f, -0.711802959f, -0.754920185f, -0.607804775f, -0.296860784f, -0.326681226f, -0.157034025f, -0.487492085f, -0.629331827f, -0.332399160f, -0.601309717f, 0.114881478f, -0.474397570f, -0.613876164f, -0.580568016f, -0.342085898f, -0.202099711f, -0.301173925f, 0.361401916f, 0.0811191574f, -0.532786727f, -0.0212082565f, 0.354170352f, -0.262615204f, -0.863324404f, 0.0623129569f, -0.264631271f, -0.00276478147f, -0.355987072f, -0.407753795f, -0.220959008f, 0.0756547078f, -0.0536812581f, 0.222099736f, -0.219397873f, -0.453265578f, -0.211255372f, -0.355246127f, -0.259290785f, -0.258748949f, -0.390420616f, 0.207104847f, -0.810869575f, 0.00639280910f, -0.387117445f, -0.490343839f, -0.278797001f, -0.199709490f, -0.463251173f, -0.306394219f, -0.170794636f, 0.0577593669f, -0.0695310459f, 0.112398177f, -0.0722196922f, -0.502141595f, -0.463115692f, 0.202112749f, -0.476765990f, 0.0910976827f, -0.0864463076f, 0.0580807664f, -0.681917965f, -0.0424607545f, -0.168962061f, -0.183830827f, -0.393744856f, -0.840450048f, -0.0667086840f, -0.426867247f, -0.415081501f, -0.311703652f, -0.569058001f, -0.0812222213f, 0.193533331f, -0.231193021f, -0.178693369f, -0.505764484f, -0.125190303f, 0.220580965f, -0.841120899f, 0.226641402f, 0.147035554f, -0.836079717f, -0.0435482152f, -0.688407302f, 0.218142629f, -0.274914145f, 0.208770737f, -0.0890937373f, -0.233523130f, -0.609696329f, -0.222528890f, -0.254341602f, -0.181409642f, 0.213388219f, -0.486877412f, -0.560209930f, -0.0863374993f, -0.833483636f, 0.119739503f, -0.577784300f, -0.721962512f, -0.279216588f, -0.452189654f, 0.0836982429f },
+    { -0.263053775f, 0.159642100f, -0.0731708556f, 0.400462210f, 0.502162635f, -0.135496333f, 0.0815795138f, 0.255941361f, -0.486253917f, -0.0493969619f, -0.0842766017f, 0.286797822f, 0.193219140f, -0.0363842845f, 0.427652955f, 0.596000373f, 0.249020755f, 0.106082581f, 0.474746048f, 0.291853011f, 0.119134292f, -0.0145120844f, 0.0858329162f, 0.276764035f, 0.170715988f, 0.466896325f, 0.339524180f, 0.234318852f, 0.0913010016f, 0.00916673243f, -0.461684674f, 0.188209280f, -0.0559948161f, -0.200352699f, 0.155766010f, 0.248760149f, 0.137277365f, -0.190796137f, 0.304115415f, 0.0168890581f, 0.601122379f, -0.0820470378f, -0.0102472454f, -0.328794777f, -0.201585263f, -0.113252312f, 0.422775835f, 0.219112188f, -0.124320284f, 0.182933629f, 0.472045541f, 0.418789268f, -0.476434976f, 0.284504920f, -0.319003195f, -0.165908545f, 0.302792341f, 0.291433036f, 0.0271093696f, 0.296667457f, 0.355863333f, -0.280499876f, -0.178527221f, -0.273106039f, 0.0799257979f, -0.264275044f, 0.443843752f, 0.181493595f, -0.225966543f, 0.547860622f, -0.488813698f, 0.555344820f, -0.0151552260f, 0.279985189f, -0.321829200f, 0.0502200499f, 0.437780559f, 0.305642247f, 0.234392047f, -0.296223342f, 0.218656793f, 0.237481773f, 0.296524465f, 0.521694481f, -0.167365476f, 0.0619965866f, 0.130874425f, 0.190464422f, 0.305721641f, -0.322368801f, 0.277706414f, 0.263466030f, -0.587990224f, -0.0174986571f, 0.254308105f, -0.336809635f, 0.220668167f, -0.370391548f, 0.328234345f, -0.452855647f, -0.0157073289f, -0.0174551606f, 0.278489023f, -0.115229368f, 0.375216961f, 0.0485760719f, 0.0411775112f, 0.362521946f, 0.343986154f, -0.344800889f, 0.203330591f, -0.470486909f, 0.0963789001f, 0.110177293f, -0.209571898f, -0.0120220259f, -0.365220308f },
+    { 0.0909188762f, 0.287919939f, 0.190379813f, 0.544724405f, 0.411056399f, 0.255896717f, 0.396843731f, 0.548084199f, 1.01389217f, 1.03376079f, 0.744759321f, 0.576000154f, 0.647515774f, 0.373576641f, 0.424834430f, 0.391480297f, 0.846932113f, 0.611398935f, 0.426158965f, 0.544211924f, 0.924673140f, 0.694892585f, 0.614818633f, 0.480123878f, 0.705448031f, 0.704998732f, 0.465282500f, 1.02294993f, 0.626594841f, 1.11765540f, 1.07900119f, 0.444024742f, 0.0898317844f, -0.0955508575f, 0.221839696f, 0.543705702f, 0.194789782f, 0.847971261f, 1.13193774f, 0.701276362f, 0.656415105f, 0.210783690f, 1.12760520f, 1.07463181f, 0.826481402f, 0.769593894f, 0.418534994f, 0.586934626f, 0.833820283f, 0.596695483f, 0.543337464f, 0.339087188f, 0.961291313f, 0.539676607f, 0.00401774887f, 0.205102012f, 0.746759117f, 0.943922102f, 0.988982320f, 0.375827849f, 0.389966369f, 0.880984426f, 0.971199334f, 0.808400869f, 1.14706504f, 1.06183517f, 0.376341105f, 0.780925930f, 1.11444271f, 0.409961790f, -0.102017358f, 0.236898229f, 0.128705531f, 0.631822050f, 0.882875562f, 0.247471198f, 0.435455650f, 0.775012374f, 0.474999100f, 0.0400797054f, 0.277434736f, 0.731482089f, 0.539791644f, 0.398196965f, 0.774609625f, 0.626878977f, 0.315658450f, 0.198336050f, 0.782022953f, 0.0567125827f, 0.199507162f, 0.554293752f, -0.171578690f, 0.0498248376f, 0.561622381f, 0.867715061f, 0.618132234f, 1.15211260f, 0.270512402f, -0.102864675f, 0.188548133f, 0.922599196f, 0.553431034f, 0.746452570f, 0.503929496f, 0.234334528f, 0.0433642119f, 0.764465332f, 0.405571193f, 0.0245596040f, 0.518563747f, -0.0853433162f, 0.401993364f, 0.612211823f, 0.802431047f, 0.843165755f, 0.865689576f },
+    { 0.109398201f, 0.409937739f, 0.235277161f, 0.587950826f, 0.571492016f, 0.293512434f, 0.467686594f, 0.632477701f, 1.51122177f, 1.29417181f, 0.933297575f, 0.748646975f, 0.783615470f, 0.451636940f, 0.583186209f, 0.524855793f, 0.927211642f, 0.810947478f, 0.492282987f, 0.739556491f, 1.17431664f, 0.876511157f, 0.801596284f, 0.611359656f, 0.924873590f, 0.851468205f, 0.587187409f, 1.25705516f, 0.815991640f, 1.32084918f, 1.63117981f, 0.534304142f, 0.124659799f, -0.117949560f, 0.283800453f, 0.712128282f, 0.231347233f, 1.20802915f, 1.44329655f, 0.943119705f, 0.780409575f, 0.255470991f, 1.52834642f, 1.41190672f, 1.12287617f, 0.932776988f, 0.522444248f, 0.726302624f, 0.972198844f, 0.685031414f, 0.698858559f, 0.476142883f, 1.38305902f, 0.668975711f, 0.00492655672f, 0.254803389f, 0.951053143f, 1.08823240f, 1.25601053f, 0.501868486f, 0.456395328f, 1.21936762f, 1.19461560f, 1.01267099f, 1.64089715f, 1.45563912f, 0.447971374f, 0.994114041f, 1.40119421f, 0.436245769f, -0.119083039f, 0.330206424f, 0.169263691f, 0.775906801f, 1.07254791f, 0.327429920f, 0.523963749f, 0.957138240f, 0.602419794f, 0.0468317121f, 0.341128647f, 0.853490412f, 0.701599300f, 0.504792690f, 0.927717030f, 0.825364709f, 0.414588630f, 0.274966598f, 0.899994969f, 0.0699548498f, 0.204359591f, 0.718722045f, -0.179133862f, 0.0665425211f, 0.629985631f, 1.17781746f, 0.829430521f, 1.61468041f, 0.289804280f, -0.138598591f, 0.219906762f, 1.29997182f, 0.588852465f, 0.974061191f, 0.652009130f, 0.260531068f, 0.0514289737f, 0.989043832f, 0.420804441f, 0.0308810752f, 0.591216207f, -0.0924993306f, 0.519599319f, 0.691519856f, 0.961927593f, 1.09433043f, 1.18348467f },
+    { 0.00288132648f, 0.00227498123f, -0.0349089354f, -0.0166590903f, -0.0135350293f, -0.0138271349f, -0.0147640891f, -0.0442191586f, 0.190457031f, 0.122361720f, 0.0349838659f, -0.00489340303f, 0.0132405804f, -0.00748038199f, -0.00435613096f, -0.00174583774f, 0.00171259011f, 0.0112443538f, -0.0293632764f, 0.0113031017f, 0.0177919753f, 0.0190160312f, 0.0410733819f, 0.00784775615f, 0.00624735234f, 0.00580795109f, 0.00884624943f, 0.0503594577f, 0.0250650533f, 0.0912562311f, 0.0753852651f, 0.000603808789f, -0.0814014375f, -0.0400922373f, -0.0297111589f, 0.00237167953f, -0.0502332523f, 0.0310428422f, 0.0628357381f, 0.0116200391f, 0.00664892327f, -0.0162223820f, 0.0220504757f, 0.111961275f, 0.0329340212f, -0.0161474608f, 0.0108246244f, 0.00539416680f, 0.0373862162f, -0.000535688188f, 0.0105734374f, -0.0261209644f, 0.129727438f, 0.000254327053f, -0.0322643444f, -0.0265753083f, 0.0522712208f, 0.0130366422f, 0.0231427439f, -0.0119736893f, -0.0157848783f, 0.0274833012f, 0.0346854031f, -0.0260885023f, 0.119099073f, 0.108947679f, -0.0255862810f, 0.0535705425f, 0.0589786209f, -0.00712984940f, -0.144901305f, -0.0246520750f, -0.0199096836f, 0.00742669636f, 0.0639847144f, -0.00163155224f, -0.00251399050f, 0.0509750694f, -0.00733175920f, -0.119682468f, -0.0417036451f, 0.00226615858f, 0.0131364223f, -0.00914939120f, 0.0218179412f, 0.0268347375f, -0.0114993639f, -0.0338769481f, 0.0385906547f, -0.0308793616f, -0.0183406249f, 0.00362417824f, -0.195147917f, -0.184916839f, 0.00153749436f, 0.0524499640f, 0.0126151536f, 0.0777771622f, -0.0102590602f, -0.236826301f, -0.00654490432f, 0.107759029f, -0.00123967719f, 0.0188406128f, 0.00856784917f, -0.0133626154f, -0.0724939257f, 0.0203394201f, -0.0109539283f, -0.0688212588f, -0.00366977742f, -0.0560178980f, -0.00754303159f, 0.00490266271f, 0.0179484673f, 0.0177671704f, 0.0546516515f },
+    { -0.194225848f, 0.0749091059f, 0.0931577906f, 0.305154264f, -0.0316255689f, -0.0803398862f, 0.198510289f, -0.505405784f, -0.0670453832f, -0.105374344f, -0.0514624193f, -0.332873344f, -0.590717554f, -0.0831998363f, -0.0362010449f, 0.344960898f, -0.348592192f, -0.0895501971f, -0.104537845f, 0.0193124227f, 0.645963967f, 0.161063895f, -0.0270633437f, -0.410965949f, -0.122769617f, -0.0250946488f, 0.0844664425f, -0.0215818249f, -0.473087847f, -0.139800042f, -0.105570599f, -0.199723184f, -0.00450323056f, -0.196147263f, -0.0257724617f, 0.202085793f, 0.292000949f, 0.292584240f, 0.410957128f, -0.0176327713f, 0.356883705f, 0.258846104f, 0.288598090f, 0.0134621011f, 0.175147489f, 0.479336321f, 0.0854906887f, -0.215812594f, 0.389047176f, 0.377614886f, 0.121671155f, -0.498752028f, 0.467808366f, 0.211490437f, -0.286268264f, -0.462013215f, -0.119868383f, -0.0940096751f, 0.135235295f, 0.146950915f, -0.115399197f, -0.145909354f, 0.114388004f, 0.401094615f, -0.364637077f, -0.217604399f, 0.186432153f, -0.305831164f, 0.140283868f, 0.135357678f, 0.0305167623f, -0.219077125f, 0.000481895637f, 0.0610342100f, 0.223799556f, 0.337229192f, 0.170942932f, 0.0982168019f, 0.0592365861f, -0.126206622f, 0.163708135f, -0.273332357f, -0.0721473917f, -0.0186076146f, 0.0294792131f, -0.00847552624f, 0.117471874f, 0.152751625f, 0.232989788f, 0.448406428f, 0.00909387320f, -0.162102088f, -0.605093360f, -0.115268253f, -0.322046489f, 0.558518887f, 0.368881047f, -0.350732446f, 0.331825674f, -0.361460239f, -0.461850107f, 0.0728352591f, 0.00562551664f, 0.0167732500f, -0.0423381142f, 0.206517264f, -0.212903604f, 0.260810077f, 0.295981109f, 0.287680954f, -0.731158018f, -0.108339846f, 0.0339768194f, -0.0402932577f, -0.0269999504f, -0.373658627f, 0.0818904415f },
+    { -0.539089859f, -0.425582737f, -0.605321467f, -0.389691472f, -0.392751366f, -0.383081526f, -0.436593056f, 0.0508074723f, -0.670873344f, -0.561800838f, -0.289680749f, -0.327490956f, 0.181435019f, -0.833600342f, -0.0645373166f, -0.172978967f, -0.302815646f, -0.402771950f, 0.0727285519f, -0.135186315f, 0.291927844f, -0.394824952f, -0.302209020f, -0.116673864f, -0.422205508f, -0.150991037f, -0.618967295f, -0.716928124f, 0.0667652935f, -0.263243586f, -0.347440869f, -0.577616215f, -0.864305615f, -0.607705534f, -0.472324073f, -0.553314149f, -0.314202726f, -0.0683536232f, -0.178085774f, 0.0557082221f, -0.244025603f, -0.430250585f, -0.372832030f, -0.0780217499f, -0.528788686f, 0.217720047f, -0.119940728f, -0.568374872f, -0.206709906f, -0.0217742883f, -0.339153081f, 0.178698421f, 0.167333513f, -0.517550588f, -0.427463531f, 0.0370362699f, -0.205147758f, -0.577387929f, -0.722056448f, -0.187703386f, -0.304520249f, -0.349642307f, -0.383969903f, -0.116052352f, -0.0799255446f, -0.361698031f, -0.331570506f, -0.331842273f, -0.354908556f, -0.468549371f, -0.585066140f, -0.438004971f, -0.522286654f, -0.425177455f, -0.545814395f, -0.325541675f, 0.133943349f, -0.803566456f, -0.612625778f, -0.487150311f, -0.620699942f, -0.453335345f, -0.685058951f, -0.337730616f, -0.535479426f, -0.0167303737f, -0.692060530f, -0.127371877f, 0.0355351791f, 0.0274200328f, -0.485184014f, -0.218367815f, 0.279596627f, -0.408671618f, -0.174406588f, 0.117037773f, -0.262237877f, -0.298535079f, -0.105320677f, -0.0538057424f, -0.0420769565f, -0.236422360f, -0.371584058f, -0.589093029f, -0.698439717f, -0.586965442f, -0.475514650f, -0.478379905f, -0.0284032598f, -0.347383887f, 0.462315828f, -0.218474492f, -0.479467869f, -0.891569495f, -0.451309115f, -0.148771077f, -0.510236084f },
+    { 0.292606890f, 0.265454561f, 0.423754662f, 0.221859634f, 0.152085692f, -0.0256373137f, -0.187835738f, -0.435145825f, 0.0188807696f, 0.361838788f, 0.131439939f, -0.0630746335f, -0.353243470f, 0.0595102757f, 0.327643394f, 0.364414334f, 0.522554517f, 0.172843218f, 0.0187703967f, 0.330622166f, -0.367219001f, -0.149572670f, 0.285040468f, -0.111272871f, 0.214001417f, 0.0779475346f, 0.381436408f, 0.165465921f, 0.315114409f, 0.414086342f, -0.0729448646f, 0.155190051f, 0.150614828f, 0.492776096f, 0.591923058f, 0.489283681f, 0.716590643f, -0.423595399f, 0.293224126f, 0.232801363f, 0.00807352364f, -0.304915071f, -0.0464980826f, 0.150241405f, 0.453401536f, -0.486737728f, 0.398028135f, 0.190565288f, -0.139306396f, -0.198748812f, 0.0498564243f, -0.262336433f, -0.183825940f, -0.163113534f, -0.0369887128f, -0.640078545f, 0.321112573f, 0.370183945f, 0.275193036f, -0.109400198f, 0.0246466845f, 0.150876105f, -0.0635035187f, 0.324623704f, 0.140512347f, 0.553135812f, 0.590244591f, -0.134764418f, -0.129043803f, 0.341639996f, 0.155942053f, 0.174889207f, 0.360694230f, 0.0105608180f, 0.295998871f, -0.0501053631f, -0.0371749103f, 0.127061903f, 0.236068591f, -0.0489374399f, 0.158257574f, 0.523260355f, 0.273503453f, 0.0901107192f, 0.238955095f, 0.244558483f, 0.345271587f, -0.161409289f, -0.0322359949f, -0.420697927f, 0.347741902f, -0.178941399f, -0.178491920f, -0.0764875710f, 0.201333418f, -0.121403418f, 0.421267927f, -0.0812393799f, -0.463302672f, 0.482178390f, 0.359416664f, 0.238135546f, 0.114452153f, 0.147894681f, 0.189474553f, 0.431450367f, 0.260947943f, 0.379548490f, -0.288802207f, 0.417058349f, -0.345033824f, 0.207362503f, 0.399920166f, 0.167512432f, 0.109758258f, -0.246004969f, 0.320115834f },
+    { 0.344984621f, 0.420561016f, 0.608448267f, 0.890467346f, 0.374841392f, 0.271919936f, 0.811539173f, -0.0501967706f, 0.393534958f, 0.505855322f, 0.329966277f, 0.208985418f, -0.0543944612f, 0.428437501f, 0.529304266f, 0.931378484f, 0.315050066f, 0.387377143f, 0.144361958f, 0.578216016f, 1.23108542f, 0.736758292f, 0.530030251f, 0.105404273f, 0.333863884f, 0.257188916f, 0.641537726f, 0.591534913f, 0.137535408f, 0.527088821f, 0.244030371f, 0.350798428f, 0.566811085f, 0.380593657f, 0.421941042f, 0.674222291f, 0.767955720f, 0.871624470f, 0.965688765f, 0.554682970f, 0.977669120f, 0.868555546f, 0.900728703f, 0.274176419f, 0.611669302f, 1.11957109f, 0.426025391f, 0.362726480f, 0.949245811f, 0.884352744f, 0.662822783f, -0.0268896502f, 1.12487841f, 0.777661920f, 0.247995839f, -0.131152824f, 0.366159022f, 0.392291844f, 0.655368984f, 0.752829909f, 0.243219256f, 0.337594450f, 0.734498084f, 1.03715444f, 0.155940920f, 0.307541937f, 0.644090176f, 0.180956423f, 0.795656502f, 0.725743651f, 0.578127444f, 0.317363679f, 0.527016580f, 0.669393420f, 0.741455615f, 0.923134744f, 0.685589015f, 0.633945763f, 0.471322715f, 0.293720126f, 0.741189241f, 0.336129397f, 0.433095723f, 0.335848391f, 0.570386291f, 0.532397866f, 0.529601693f, 0.787677824f, 0.790148854f, 1.07933521f, 0.508993745f, 0.158211097f, -0.0303395092f, 0.272368848f, 0.211764142f, 1.12821662f, 0.874295354f, 0.173876256f, 0.909701467f, 0.226159155f, 0.196047664f, 0.609143853f, 0.633489966f, 0.616751552f, 0.463191330f, 0.659199357f, 0.317698181f, 0.745949984f, 0.840708196f, 0.851498187f, -0.130610242f, 0.339307398f, 0.505995512f, 0.495092809f, 0.356766224f, 0.0757541806f, 0.560790300f },
+    { 0.433241636f, 0.606793165f, 0.743741155f, 1.09115767f, 0.459131330f, 0.367765129f, 0.986770809f, -0.0576707050f, 0.482035249f, 0.569169760f, 0.401369780f, 0.218967006f, -0.0657793209f, 0.523928285f, 0.663201690f, 1.14719725f, 0.332198888f, 0.421842784f, 0.166531324f, 0.727168560f, 1.86282754f, 0.941313684f, 0.675035596f, 0.127224758f, 0.432692826f, 0.340685189f, 0.729094148f, 0.652508914f, 0.175533623f, 0.551651597f, 0.320726246f, 0.404368579f, 0.652403593f, 0.470056772f, 0.623386502f, 0.865705848f, 0.954549015f, 1.14198649f, 1.31371140f, 0.687380850f, 1.22135627f, 1.08532119f, 1.11261094f, 0.357963771f, 0.785131872f, 1.43895936f, 0.518238783f, 0.399044126f, 1.32089078f, 1.31080163f, 0.878339589f, -0.0365137495f, 1.42206275f, 1.01219034f, 0.273170471f, -0.154185146f, 0.384499818f, 0.532599807f, 0.802748740f, 0.919634402f, 0.340303183f, 0.368702114f, 0.866210938f, 1.25157666f, 0.205069959f, 0.423265755f, 0.752748787f, 0.212061584f, 0.891848266f, 0.813940585f, 0.735711813f, 0.365688562f, 0.685133636f, 0.793178678f, 0.946970999f, 1.20592141f, 0.934602022f, 0.781591713f, 0.640358627f, 0.367242575f, 0.872984529f, 0.397223115f, 0.552233398f, 0.425057888f, 0.727601171f, 0.698121667f, 0.755640209f, 0.922499239f, 1.03829706f, 1.40582895f, 0.700248063f, 0.195745185f, -0.0341908410f, 0.333760768f, 0.261912733f, 1.67451668f, 1.19992292f, 0.204745397f, 1.21340287f, 0.278490454f, 0.211244851f, 0.799857855f, 0.722963095f, 0.714427948f, 0.552305341f, 0.885756135f, 0.400029480f, 0.997510850f, 1.15652668f, 1.02441013f, -0.137407497f, 0.360739350f, 0.723484159f, 0.594006360f, 0.471785665f, 0.0971632674f, 0.785465062f },
+    { -0.0732811540f, -0.00302234106f, 0.00311402278f, 0.0602773763f, -0.00655289181f, -0.00667210575f, 0.0204996206f, -0.0376949236f, -0.0137904268f, 0.00388157181f, -0.00299591315f, -0.0422665700f, -0.0860556737f, -0.00466383016f, 0.00966965687f, 0.0240629390f, -0.0415982753f, -0.00193094637f, -0.0155184269f, 0.0108241951f, 0.195651039f, 0.0438420177f, 0.00775558362f, -0.0373720378f, -0.0141744688f, -0.00314354617f, 0.0111250002f, 0.00726506812f, -0.0588848926f, 0.0200399309f, -0.0133716892f, -0.00679935794f, 0.00981201604f, -0.0128144752f, -0.0164390430f, 0.0163591113f, 0.0119215837f, 0.0601640865f, 0.114802025f, -0.00927522220f, 0.0751306489f, 0.0337077193f, 0.00835328177f, -0.0254503116f, 0.00273209857f, 0.0904347748f, 0.0107853319f, -0.0194374584f, 0.0493117161f, 0.0305539146f, 0.00656597968f, -0.0345874764f, 0.0702119470f, 0.0189500488f, -0.0289463997f, -0.144556656f, 0.0501200482f, -0.00691423239f, 0.00894347671f, 0.103050515f, -0.0114331963f, -0.00840508938f, 0.0177855659f, 0.0422205590f, -0.0439094231f, -0.0589672513f, 0.0337313600f, -0.0342909470f, 0.0170333795f, 0.00823170971f, 0.00601563836f, -0.00964364875f, -0.00240957807f, 0.0208875500f, 0.0121615883f, 0.0369989201f, 0.0135435490f, 0.0192144010f, 0.00263139652f, -0.0340031460f, 0.0372848287f, -0.0180539694f, -0.0219484102f, 0.000760768133f, 0.00612459797f, 0.000395656767f, -0.00758566521f, -0.0109021012f, 0.0271719061f, 0.0605311953f, 0.0156161683f, -0.0183491297f, -0.106491484f, -0.0970525742f, -0.0222786386f, 0.106572658f, 0.0171550382f, -0.0206687413f, 0.0226795729f, -0.0222134907f, -0.0221173856f, 0.0132146878f, 0.00179673941f, 0.0116908923f, -0.0122461580f, 0.0177936945f, -0.0232659038f, 0.0284110066f, 0.0315332972f, 0.126285523f, -0.151004717f, -0.00459952187f, -0.00975233596f, -0.00214201701f, -0.0281463973f, -0.0254210066f, 0.0144361891f },
+    { 0.0858686566f, 0.0619456358f, -0.0651332587f, 0.000293916470f, -0.0722555071f, -0.0328708217f, 0.0501643755f, 0.165571094f, 0.223403841f, 0.223862469f, 0.0912356079f, 0.0290130246f, 0.0705901831f, 0.121891186f, 0.0626880303f, -0.0535615012f, -0.0513558351f, -0.0677862689f, -0.0104511334f, 0.203103453f, 0.240947366f, 0.198568299f, 0.201945573f, 0.149551436f, 0.0920290872f, 0.0251330156f, 0.00706362352f, 0.00711690914f, 0.0156080993f, -0.0264902264f, -0.0290804524f, 0.0107449442f, 0.176730096f, 0.169397965f, 0.190932557f, 0.156619847f, 0.119995467f, 0.0260722209f, -0.0325790010f, 0.000454311579f, 0.0636763871f, -0.0425471179f, -0.0761973560f, -0.0851004347f, -0.0184880979f, 0.138227791f, 0.185599402f, 0.152690053f, 0.205544531f, 0.114903465f, 0.0581341609f, 0.0795010179f, -0.0180643164f, -0.0877478868f, -0.0860543326f, -0.133506417f, -0.0890383348f, 0.0209749117f, 0.128136426f, 0.195502505f, 0.195673272f, 0.190806016f, 0.0700207427f, 0.0862835124f, 0.0505737998f, -0.0377176814f, -0.119948000f, -0.0858269930f, -0.0566405170f, -0.0587378256f, -0.0834247246f, 0.0372905657f, 0.128123343f, 0.186053947f, 0.153881863f, 0.0609173775f, -0.0308497883f, -0.0645072833f, 0.0361910835f, 0.104418941f, -0.00821901765f, -0.102415837f, -0.0580295622f, 0.00563004659f, 0.139791787f, 0.0476823747f, -0.0246573556f, 0.0675549060f, 0.0700932965f, 0.105687186f, 0.147789657f, -0.0150232082f, -0.0755898356f, -0.147524804f, -0.179117784f, -0.138314277f, 0.00582956616f, 0.0317045487f, 0.0486506708f, 0.0703519136f, 0.0721951500f, 0.0341329426f, 0.0658030286f, 0.103848033f, 0.00952096749f, -0.100973174f, -0.168820038f, -0.162699267f, -0.110279180f, -0.0676387176f, -0.0568631105f, 0.0748836771f, 0.0958890989f, 0.0522881709f, -0.0316207297f, -0.0379582718f, 0.0161491763f },
+    { -0.827321410f, -0.786473453f, -0.869733453f, -0.698222995f, -0.790047944f, -0.774255276f, -0.682150066f, -0.562080801f, -0.508198261f, -0.519589186f, -0.620595694f, -0.590874851f, -0.765321136f, -0.756217659f, -0.866984546f, -0.738520801f, -0.743222177f, -0.794010580f, -0.721664310f, -0.593793154f, -0.518105328f, -0.558632851f, -0.596108913f, -0.685613155f, -0.644942164f, -0.729268253f, -0.850406051f, -0.825157046f, -0.727278829f, -0.834967852f, -0.892923295f, -0.787126541f, -0.631699920f, -0.632005095f, -0.569272518f, -0.573556006f, -0.699807465f, -0.865328491f, -0.879988730f, -0.776157498f, -0.872647285f, -0.747149646f, -0.818475008f, -0.786528766f, -0.845562994f, -0.666524112f, -0.595666468f, -0.553010702f, -0.588910997f, -0.601054609f, -0.626707673f, -0.704405367f, -0.857453346f, -0.824504256f, -0.716419995f, -0.637813210f, -0.717553973f, -0.950568020f, -0.605604231f, -0.562716126f, -0.572827637f, -0.579733729f, -0.607994258f, -0.630809247f, -0.742822409f, -0.891366601f, -0.760104001f, -0.675861955f, -0.605602145f, -0.787412047f, -0.833150625f, -0.768548369f, -0.611021817f, -0.534910142f, -0.661340356f, -0.795556605f, -0.881827295f, -0.847700715f, -0.810080230f, -0.758007348f, -0.884235442f, -0.745415330f, -0.796133220f, -0.918459356f, -0.686996341f, -0.761615694f, -0.650442898f, -0.730887532f, -0.713847816f, -0.692921638f, -0.685669661f, -0.881368935f, -0.840237081f, -0.704950452f, -0.563669622f, -0.723371506f, -0.805158317f, -0.931933224f, -0.769003451f, -0.768207073f, -0.758499920f, -0.661110759f, -0.739933133f, -0.711373627f, -0.858246565f, -0.798053801f, -0.662359893f, -0.674601614f, -0.740531743f, -0.754226089f, -0.815877795f, -0.787702143f, -0.714769781f, -0.793375432f, -0.839245796f, -0.861989737f, -0.823219001f },
+    { -0.00473915786f, 0.121924467f, 0.165677458f, 0.125551090f, 0.128324777f, 0.265535593f, 0.0309417993f, -0.0673533827f, -0.0427093059f, -0.00251218677f, -0.0460667312f, 0.0706005991f, 0.0913083553f, 0.180468142f, 0.224567741f, 0.145767108f, 0.0293135121f, 0.162088916f, 0.220221043f, -0.0180689394f, -0.167721674f, -0.199342281f, -0.142420173f, -0.145465016f, -0.00611976534f, 0.0816913396f, 0.159614980f, 0.216028333f, 0.175896078f, 0.0753308237f, 0.187140077f, 0.132741272f, 0.0284755006f, -0.148339272f, -0.105847485f, -0.00341385603f, 0.0492387563f, 0.0761145800f, 0.221092761f, 0.134495199f, 0.165589899f, 0.199537665f, -0.00478302687f, 0.149576396f, 0.174362183f, 0.0413762555f, -0.0539829433f, 0.0146864355f, 0.0397753417f, 0.0500980094f, 0.0567594096f, 0.0297773629f, 0.215361491f, 0.106474534f, -0.0363518968f, -0.0418226048f, 0.0730631202f, 0.166339606f, 0.114722893f, -0.101575769f, -0.134308264f, -0.0769952089f, -0.00628888607f, 0.106193095f, 0.105853416f, 0.195720688f, 0.107511848f, -0.0121847913f, 0.0187990367f, 0.0148665980f, 0.244276270f, 0.0603303090f, -0.0306547955f, -0.00555837154f, -0.0325261056f, 0.0425939634f, 0.192360237f, 0.186060250f, 0.102496296f, 0.238473654f, 0.184827536f, 0.209867060f, 0.213523358f, 0.150485352f, 0.188102677f, 0.0355955511f, 0.171232551f, 0.0760880709f, -0.00642488897f, -0.0731634423f, -0.129587770f, 0.183908224f, 0.138750315f, 0.0601343289f, 0.0932092667f, 0.0283865184f, 0.155570298f, 0.0755761266f, 0.0337799937f, -0.00690985471f, -0.0103659034f, 0.0975663960f, 0.0866028517f, 0.120806284f, 0.178938195f, 0.167656928f, 0.0803866014f, -0.0372752547f, -0.0271156803f, 0.163252026f, 0.235258788f, 0.0739063770f, 0.0953216404f, 0.0725001991f, 0.184360445f, 0.162592292f, 0.155279696f },
+    { 0.646041691f, 0.591368794f, 0.478444368f, 0.454540521f, 0.451431066f, 0.506776333f, 0.634064972f, 0.759484828f, 0.836792290f, 0.819858551f, 0.693456471f, 0.629844368f, 0.611046314f, 0.660074294f, 0.561708450f, 0.427233666f, 0.424750179f, 0.456073821f, 0.537636161f, 0.777826250f, 0.826701760f, 0.787338018f, 0.790347636f, 0.744873405f, 0.668303907f, 0.593634367f, 0.551989377f, 0.532307923f, 0.492157966f, 0.463393062f, 0.491427541f, 0.575107336f, 0.745608330f, 0.766914368f, 0.776332498f, 0.766795456f, 0.701764107f, 0.583102107f, 0.497160822f, 0.565595746f, 0.574083805f, 0.488145351f, 0.417371690f, 0.432782352f, 0.540846586f, 0.726794958f, 0.781892717f, 0.750230253f, 0.781678557f, 0.660264194f, 0.618942142f, 0.676235795f, 0.507861137f, 0.443485409f, 0.375233918f, 0.336012214f, 0.406404108f, 0.539703488f, 0.727009118f, 0.805297852f, 0.792245388f, 0.795237839f, 0.669268131f, 0.623448670f, 0.633796453f, 0.512577891f, 0.416523457f, 0.362849951f, 0.375086427f, 0.418479323f, 0.471842945f, 0.596895993f, 0.739443839f, 0.802769601f, 0.740326464f, 0.622959793f, 0.509849727f, 0.463020921f, 0.595369637f, 0.627425313f, 0.525076866f, 0.435514241f, 0.452713251f, 0.551867366f, 0.686487257f, 0.637553692f, 0.570994675f, 0.626646817f, 0.653900921f, 0.688098192f, 0.736683428f, 0.522781193f, 0.455594987f, 0.377291858f, 0.325329393f, 0.387361169f, 0.506308794f, 0.570849061f, 0.628652692f, 0.650836170f, 0.655653358f, 0.599017560f, 0.608459294f, 0.679376960f, 0.564192653f, 0.436441839f, 0.349297434f, 0.340400577f, 0.374213189f, 0.427408487f, 0.505187809f, 0.625914514f, 0.664735436f, 0.606687427f, 0.515328765f, 0.473315537f, 0.504443884f },
+    { 0.787259161f, 0.749607265f, 0.567365110f, 0.575005054f, 0.536008120f, 0.628916979f, 0.759893179f, 0.927255154f, 1.00261557f, 1.00168252f, 0.821984351f, 0.738581479f, 0.766441584f, 0.802065551f, 0.712956488f, 0.549368858f, 0.515789747f, 0.549023211f, 0.664330840f, 0.970704913f, 1.05040407f, 0.987245679f, 0.983714461f, 0.901515424f, 0.819021344f, 0.721292853f, 0.671922266f, 0.629028440f, 0.606899321f, 0.573882222f, 0.611273408f, 0.689001441f, 0.921593606f, 0.934031308f, 0.965927482f, 0.898690760f, 0.831877053f, 0.702041745f, 0.619157195f, 0.680556715f, 0.727462471f, 0.562736630f, 0.508741260f, 0.533129215f, 0.643211007f, 0.858733773f, 0.946697593f, 0.897353947f, 0.962552309f, 0.849888682f, 0.775462210f, 0.785531998f, 0.638850629f, 0.527298450f, 0.467262685f, 0.412340015f, 0.493801713f, 0.666143775f, 0.838810563f, 0.966981292f, 0.974241078f, 0.957448721f, 0.793919921f, 0.803394496f, 0.736251295f, 0.614293814f, 0.488678992f, 0.465270042f, 0.471325010f, 0.520717442f, 0.561147869f, 0.733107209f, 0.862568021f, 0.940907538f, 0.894371331f, 0.756540596f, 0.624866068f, 0.570886493f, 0.716626287f, 0.772056580f, 0.622368455f, 0.523055971f, 0.573025107f, 0.657277644f, 0.834159434f, 0.742753685f, 0.663068891f, 0.767969668f, 0.783423424f, 0.838341773f, 0.898415983f, 0.640942633f, 0.548471272f, 0.446728498f, 0.404058784f, 0.446984917f, 0.610889614f, 0.698153794f, 0.745250046f, 0.776141882f, 0.779565513f, 0.737441003f, 0.766597331f, 0.797067583f, 0.664792657f, 0.525929391f, 0.429657459f, 0.404504925f, 0.459390730f, 0.545888841f, 0.601179421f, 0.768994749f, 0.795911431f, 0.743057728f, 0.632426918f, 0.592614233f, 0.628236949f },
+    { 0.0801094025f, 0.0432670861f, -0.0525735468f, -0.00443192385f, -0.0644670725f, -0.0323090479f, 0.0556509644f, 0.136048257f, 0.201828137f, 0.195480213f, 0.0899458975f, 0.0334901176f, 0.0551433153f, 0.0985576585f, 0.0363244824f, -0.0498031564f, -0.0533505194f, -0.0558893941f, 0.00407728413f, 0.142802134f, 0.228878275f, 0.194817945f, 0.195464328f, 0.144121990f, 0.0874633789f, 0.0231670309f, 0.00939279050f, 0.0118641444f, -0.000816399872f, -0.0189550743f, -0.0259201210f, 0.0178667679f, 0.132386506f, 0.151407212f, 0.176295787f, 0.145946756f, 0.0930465236f, 0.0208412353f, -0.0281263124f, 0.00760115823f, 0.0433106646f, -0.0421568342f, -0.0682512149f, -0.0765764117f, -0.00272026984f, 0.110481836f, 0.160987452f, 0.123245366f, 0.159279406f, 0.0992354527f, 0.0599385500f, 0.0836128220f, -0.0105125504f, -0.0655198246f, -0.0814928412f, -0.129259542f, -0.0727113187f, 0.0112684490f, 0.0839548334f, 0.173566505f, 0.180381432f, 0.176929370f, 0.0805859193f, 0.0709658265f, 0.0541691780f, -0.0251449943f, -0.0960743651f, -0.0984671712f, -0.0630964190f, -0.0463913195f, -0.0618431717f, 0.0394465290f, 0.111881599f, 0.170886815f, 0.125438571f, 0.0468903147f, -0.0200495534f, -0.0502520241f, 0.0364596099f, 0.0658066794f, -0.00133047288f, -0.0627242848f, -0.0518377572f, 0.00457850378f, 0.102421448f, 0.0513438210f, 0.00653649028f, 0.0651039407f, 0.0677664950f, 0.104938783f, 0.136575699f, -0.00173638784f, -0.0551553592f, -0.110948406f, -0.161038220f, -0.111395612f, -0.000652518182f, 0.0236033406f, 0.0459160432f, 0.0617154986f, 0.0699137971f, 0.0354383290f, 0.0528310128f, 0.0773449466f, 0.0160844903f, -0.0644072741f, -0.143348679f, -0.138541043f, -0.104015239f, -0.0649467036f, -0.0351344012f, 0.0573705956f, 0.0671518147f, 0.0417237580f, -0.0261043813f, -0.0338346809f, 0.00121545722f },
+    { -0.478433132f, 0.332946062f, 0.0784230679f, 0.729553163f, 0.748098433f, -0.538951457f, -0.407942146f, -0.464599192f, 0.399422735f, -0.811469257f, -0.0505158082f, -0.588115513f, -0.311406910f, 0.257401407f, 0.292825252f, 0.615663707f, 0.413832188f, 0.309404314f, -0.899203122f, -0.0323139913f, 0.319302708f, 0.295592636f, 0.127627894f, -0.000324755907f, 0.0424924716f, -0.744408727f, 0.324437559f, -0.386034369f, 0.0336526185f, -0.0288076885f, -0.129798815f, -0.620621622f, -0.511990190f, -0.0155066699f, 0.466433764f, 0.0670081079f, -0.643349171f, 0.0169534627f, 0.0152408453f, 0.675468922f, 0.547212362f, -0.513082147f, 0.687143803f, 0.822214186f, -0.763277709f, -0.117626823f, -0.142344683f, 0.736300170f, -0.612632811f, 0.545015156f, 0.720919371f, 0.896348178f, 0.499356508f, 0.00541429967f, -0.488571882f, 0.792262316f, -0.0975686014f, -0.692000210f, -0.412300676f, 0.125931621f, 0.516502440f, 0.0974071175f, 0.819799542f, 0.382370561f, -0.0319904089f, 0.402734846f, -0.705997229f, 0.0310404319f, 0.456567258f, -0.292853564f, -0.492889792f, -0.625160336f, -0.203700364f, 0.605966210f, 0.283056527f, 0.412082344f, 0.574805140f, 0.417949826f, -0.309787601f, 0.0556772687f, -0.445455551f, 0.0487525873f, 0.190929532f, 0.0147145605f, 0.720185816f, 0.581049263f, 0.401494592f, -0.569281936f, 0.197104469f, 0.463622421f, 0.611478746f, -0.0483623147f, -0.00606345152f, -0.345836461f, 0.327492386f, -0.119720243f, -0.0784514919f, -0.0117844343f, 0.751313806f, 0.429806501f, -0.309547722f, 0.246810839f, 0.521391034f, 0.0410366505f, 0.188904554f, 0.0115735084f, -0.473831087f, 0.350769013f, -0.301205784f, -0.0768345743f, -0.442555875f, 0.380474031f, 0.553890109f, 0.620624900f, -0.209053993f, 0.211858287f, 0.0607741326f },
+    { -0.213971779f, -0.315229952f, -0.0271574631f, 0.893532038f, -0.463587195f, -0.907512307f, -0.344366193f, -0.103267893f, -0.0343002714f, 0.279915363f, 0.239489660f, -0.231008232f, -0.686500192f, -0.683572531f, -0.491114199f, 0.519033194f, 0.153132424f, 0.519099474f, -0.188125148f, -0.319885045f, -0.572832882f, 0.294421017f, 0.259680420f, -0.319060475f, 0.253704906f, 0.104257643f, -0.395591021f, 0.0477301627f, 0.175180957f, 0.345774204f, -0.126276195f, 0.322286874f, -0.00106365606f, -0.184444815f, 0.259156793f, 0.144178122f, 0.340031296f, 0.649666727f, 0.437163740f, -0.0873373374f, -0.393276662f, -0.317731500f, 0.248835087f, 0.149599105f, -0.812262654f, -0.417008847f, -0.0739924908f, -0.209915936f, -0.269093066f, 0.0393039659f, 0.377650410f, 0.769324481f, -0.584932387f, 0.143069983f, -0.562418044f, 0.645216942f, 0.152812287f, -0.185185850f, -0.327185780f, -0.213781610f, -0.612551451f, 0.410739869f, 0.232750311f, 0.369220346f, 0.228782535f, -0.105403930f, 0.296802998f, -0.273455054f, 0.383510798f, -0.214354232f, 0.205700785f, 0.0191513523f, -0.170118034f, -0.640448511f, 0.788609028f, 0.210532635f, -0.101356938f, -0.641986549f, 0.345856518f, 0.336485565f, -0.531662285f, 0.400166720f, 0.220927179f, 0.256125003f, 0.545704007f, 0.0396517217f, -0.0298222750f, 0.592573225f, 0.231175676f, -0.455607146f, 0.722879171f, 0.221916407f, 0.323426992f, -0.584425151f, -0.166499883f, -0.488727629f, -0.0931821689f, -0.0888208300f, 0.190388590f, -0.566281319f, 0.772296667f, -0.910940707f, 0.432822049f, 0.433389097f, 0.196106896f, -0.188175991f, -0.852070808f, 0.627671063f, 0.489385426f, -0.277903378f, 0.404043287f, 0.183653623f, -0.332747549f, 0.783027709f, 0.337937295f, -0.594251513f, 0.00557874748f },
+    { -0.732600451f, -0.733322561f, -0.733981550f, -0.734641373f, -0.735288918f, -0.735941589f, -0.736534894f, -0.737119555f, -0.737697244f, -0.738287151f, -0.738820434f, -0.739351034f, -0.739880323f, -0.722096860f, -0.722934663f, -0.723709047f, -0.724481225f, -0.725253522f, -0.725949764f, -0.726696014f, -0.727400303f, -0.728078902f, -0.728716552f, -0.729397535f, -0.730023682f, -0.730645418f, -0.711412430f, -0.712367177f, -0.713272512f, -0.714158535f, -0.715040505f, -0.715906739f, -0.716713607f, -0.717506945f, -0.718303323f, -0.719089508f, -0.719819844f, -0.720542014f, -0.721274734f, -0.733422995f, -0.734113872f, -0.734742999f, -0.735357881f, -0.735976934f, -0.736602545f, -0.737153232f, -0.737712741f, -0.738283932f, -0.738832831f, -0.739326119f, -0.739834845f, -0.740342617f, -0.722896159f, -0.723703325f, -0.724448264f, -0.725192308f, -0.725921512f, -0.726591170f, -0.727312386f, -0.727975845f, -0.728630722f, -0.729246080f, -0.729904830f, -0.730492413f, -0.731093526f, -0.712200880f, -0.713126421f, -0.713988841f, -0.714847088f, -0.715687871f, -0.716528535f, -0.717310429f, -0.718079507f, -0.718837500f, -0.719601631f, -0.720310628f, -0.721011758f, -0.721707821f, -0.734057069f, -0.734721065f, -0.735307693f, -0.735897422f, -0.736492276f, -0.737078130f, -0.737606406f, -0.738144398f, -0.738676846f, -0.739206076f, -0.739679933f, -0.740169644f, -0.740641892f, -0.723508418f, -0.724229574f, -0.724993408f, -0.725712895f, -0.726403177f, -0.727049530f, -0.727748573f, -0.728391051f, -0.729025722f, -0.729604542f, -0.730227888f, -0.730813861f, -0.731380343f, -0.712776959f, -0.713676512f, -0.714514196f, -0.715333641f, -0.716150939f, -0.716969490f, -0.717714548f, -0.718462706f, -0.719216347f, -0.719945490f, -0.720619559f, -0.721303105f, -0.721981883f },
+    { -0.739796638f, -0.740014255f, -0.735252857f, -0.724236727f, -0.711861372f, -0.704009414f, -0.702742994f, -0.705601156f, -0.718294263f, -0.739211023f, -0.759031892f, -0.769806266f, -0.771556318f, -0.728296518f, -0.728620946f, -0.724067450f, -0.713304758f, -0.701225936f, -0.693642259f, -0.692488670f, -0.695480943f, -0.708500266f, -0.730019927f, -0.750435472f, -0.761594474f, -0.763464212f, -0.720415175f, -0.720889211f, -0.716825187f, -0.707017779f, -0.696068466f, -0.689213037f, -0.688295186f, -0.691033185f, -0.702198088f, -0.720517516f, -0.737967134f, -0.747648239f, -0.749458373f, -0.737468004f, -0.737685204f, -0.732964098f, -0.721833348f, -0.709064245f, -0.700868607f, -0.699476838f, -0.702681482f, -0.717461467f, -0.741692722f, -0.764272034f, -0.776265144f, -0.778148353f, -0.725898981f, -0.726224482f, -0.721743226f, -0.710822165f, -0.698341072f, -0.690319479f, -0.689104199f, -0.692455173f, -0.707635105f, -0.732524991f, -0.755785704f, -0.768242776f, -0.770251274f, -0.719307423f, -0.719769061f, -0.715702057f, -0.705738604f, -0.694343746f, -0.687134266f, -0.686130583f, -0.689133942f, -0.701957703f, -0.722881675f, -0.742573142f, -0.753221691f, -0.755074620f, -0.737454653f, -0.737698436f, -0.733155429f, -0.722435713f, -0.710021138f, -0.701989472f, -0.700647235f, -0.703810513f, -0.718434691f, -0.742364824f, -0.764617562f, -0.776428580f, -0.778202415f, -0.725879133f, -0.726229846f, -0.721911132f, -0.711411953f, -0.699254394f, -0.691462338f, -0.690214753f, -0.693565965f, -0.708581686f, -0.733230948f, -0.756154895f, -0.768410981f, -0.770354569f, -0.719458580f, -0.719940662f, -0.716026962f, -0.706413388f, -0.695360899f, -0.688323200f, -0.687323213f, -0.690283239f, -0.702930391f, -0.723598242f, -0.742933273f, -0.753382981f, -0.755152225f },
+    { -0.742760718f, -0.743020892f, -0.739901125f, -0.723528206f, -0.732011557f, -0.720006704f, -0.717997670f, -0.718011081f, -0.720620155f, -0.735788167f, -0.755374432f, -0.759968162f, -0.769208372f, -0.730221510f, -0.732488275f, -0.719835579f, -0.710128009f, -0.719343066f, -0.710574627f, -0.711329162f, -0.711516321f, -0.721552968f, -0.722308457f, -0.739656031f, -0.747018576f, -0.752074599f, -0.718265831f, -0.719238698f, -0.713815093f, -0.705120385f, -0.711319923f, -0.703572631f, -0.707226396f, -0.705545604f, -0.718603551f, -0.718494058f, -0.717776000f, -0.726911902f, -0.729416490f, -0.745927095f, -0.742999971f, -0.741700768f, -0.738634706f, -0.723559976f, -0.719100177f, -0.716729105f, -0.717330337f, -0.722053885f, -0.736743331f, -0.758527160f, -0.767889261f, -0.776932299f, -0.737537205f, -0.735510767f, -0.735394597f, -0.721928000f, -0.718411148f, -0.711346984f, -0.711898685f, -0.713202178f, -0.723684192f, -0.717753410f, -0.740741074f, -0.754458845f, -0.765123487f, -0.733571410f, -0.733317971f, -0.730538070f, -0.704856396f, -0.710351050f, -0.705467165f, -0.708479881f, -0.709163249f, -0.721159816f, -0.712626398f, -0.713757515f, -0.730618477f, -0.730931520f, -0.740639210f, -0.734891713f, -0.739433050f, -0.740946293f, -0.722346187f, -0.724100113f, -0.722186327f, -0.723794997f, -0.720710754f, -0.734240651f, -0.754884422f, -0.759890079f, -0.770471156f, -0.734848559f, -0.731067896f, -0.730679989f, -0.721735954f, -0.712136269f, -0.716531754f, -0.714942157f, -0.719496250f, -0.719554543f, -0.713049710f, -0.741876125f, -0.755517960f, -0.758962750f, -0.730511546f, -0.725505412f, -0.725859821f, -0.711331964f, -0.706260979f, -0.710312843f, -0.707748771f, -0.709612429f, -0.715962231f, -0.710682631f, -0.723372102f, -0.732782602f, -0.735024989f },
+    { -0.736579299f, -0.0819200799f, -0.638748467f, -0.327252865f, 0.545099497f, -0.847559094f, 0.0437736772f, 0.571201026f, 0.0286973808f, -0.168748006f, 0.701159060f, 0.372686684f, 0.141837329f, -0.526248455f, -0.612512708f, 0.289748669f, -0.630751193f, 0.106814802f, 0.442173868f, 0.156871095f, 0.382528514f, 0.880378127f, -0.749618351f, 0.825109839f, -0.319899023f, 0.167887062f, 0.181564897f, 0.336018056f, 0.656066060f, -0.0569414198f, -0.294771165f, 0.483826220f, 0.386577487f, 0.176265508f, -0.260228008f, 0.247680426f, -0.581318259f, 0.326434195f, 0.712589324f, -0.380246341f, -0.0508142784f, -0.494444460f, 0.127297491f, -0.0411477052f, 0.00469244970f, -0.0105135813f, 0.706981659f, -0.203044251f, -0.455967069f, 0.0767560005f, 0.251114666f, -0.00740932859f, 0.145431772f, 0.263922691f, -0.611209810f, -0.714605093f, -0.518830180f, 0.885032952f, 0.361614466f, 0.625268161f, 0.340038002f, -0.172118530f, 0.592663229f, -0.405464321f, 0.368985087f, 0.314115822f, -0.0895282701f, 0.00457989099f, -0.470431596f, -0.501775503f, 0.203028411f, -0.309958249f, 0.0836163014f, 0.199836895f, 0.496759742f, -0.328766823f, -0.352394283f, -0.272341371f, -0.0844199508f, 0.122930720f, -0.848445177f, -0.226068705f, -0.492171824f, -0.689257801f, -0.331187665f, 0.710546732f, 0.00183291733f, -0.752286375f, 0.332621545f, -0.339313149f, 0.164711013f, -0.431921035f, -0.168095797f, -0.235169291f, -0.523763061f, -0.628628492f, -0.713143826f, -0.502443373f, 0.130671352f, -0.429248989f, -0.273757458f, -0.0100778192f, 0.790271401f, 0.158031568f, -0.0788877532f, 0.638257980f, 0.103125341f, 0.571756244f, 0.725082815f, 0.306735367f, 0.288726449f, 0.357466251f, 0.130577862f, -0.420956612f, 0.395298719f, 0.727819026f, -0.282142669f },
+    { -0.177787498f, -0.476735473f, -0.561897159f, -0.198719263f, 0.274616897f, -0.0241820067f, -0.375437140f, -0.164039627f, 0.508048296f, -0.0626627281f, 0.684426785f, 0.513638556f, 0.265780360f, -0.0636363477f, -0.788307428f, -0.434729457f, -0.391954511f, 0.193256572f, 0.0733768940f, 0.765049040f, 0.804679871f, 0.552410007f, 0.145986632f, 0.150507778f, 0.0620208271f, 0.134583801f, -0.0513619632f, 0.334184498f, 0.536063373f, 0.180409312f, -0.00228628516f, 0.310848534f, -0.102804549f, 0.294262320f, 0.743922293f, 0.0892973319f, 0.426398963f, 0.649534822f, 0.272776067f, -0.836921513f, 0.181799367f, -0.330916941f, -0.127879441f, -0.612749636f, 0.0191374775f, 0.291778386f, 0.514364481f, 0.719871879f, -0.572079897f, 0.770059526f, 0.350721031f, -0.405102342f, -0.161649972f, -0.258837998f, -0.290082127f, -0.266265661f, -0.0601931140f, 0.522095203f, 0.198803470f, 0.611253440f, 0.515022516f, -0.128001884f, 0.0934718922f, 0.490292996f, 0.381969720f, 0.399606556f, -0.0313626342f, -0.230876729f, 0.0502337515f, 0.0453858376f, 0.0639846995f, -0.124021873f, -0.291856349f, -0.115888670f, 0.561789572f, 0.288244963f, 0.334595084f, 0.267748505f, -0.291949898f, -0.255116224f, -0.0494661666f, -0.928089023f, -0.925100505f, -0.563177466f, -0.493902266f, 0.423613906f, 0.138435289f, -0.478568166f, 0.785630524f, -0.435419023f, 0.0609966069f, -0.477827758f, -0.678340912f, -0.506488502f, -0.199956879f, -0.172220051f, 0.309364080f, -0.0637518167f, 0.385033339f, 0.144792646f, 0.123554200f, 0.842294991f, 0.348202258f, 0.169302478f, -0.123581462f, -0.386878490f, -0.625230610f, -0.325483352f, -0.233174860f, -0.601450980f, -0.379750967f, 0.629042208f, 0.166111946f, -0.0277875215f, 0.102968708f, -0.0524806045f, -0.259486735f },
+    { -0.0315130763f, -0.397224069f, -0.407226294f, -0.311215460f, -0.0540976822f, -0.132229894f, 0.0348000415f, 0.0531960018f, -0.633175015f, -0.123622641f, 0.315668195f, 0.528532565f, 0.222733736f, -0.519155383f, -0.188055500f, -0.00304751843f, 0.265476882f, 0.454374611f, -0.428119719f, 0.134946644f, -0.399529636f, 0.521265864f, 0.755487859f, -0.168621644f, 0.371759236f, 0.486011714f, -0.175351083f, 0.301989913f, -0.143761516f, 0.551676989f, 0.223138213f, 0.342785448f, -0.108957820f, -0.0974541083f, 0.443747371f, 0.152478233f, -0.626212776f, 0.255525351f, 0.119677693f, -0.151868686f, -0.170018822f, -0.752927899f, -0.595340312f, -0.453528911f, 0.165821061f, -0.457303107f, 0.200259998f, 0.798378408f, 0.251073837f, 0.104265884f, -0.104646623f, 0.00810310245f, -0.493509978f, -0.208339825f, -0.217179596f, 0.758835196f, -0.532686830f, 0.121321589f, -0.177609265f, 0.228726014f, -0.547006905f, 0.385537356f, 0.576662660f, -0.0956449062f, 0.136391044f, 0.427965671f, -0.330337405f, -0.361705333f, 0.718083024f, 0.212079048f, 0.105863810f, -0.372458637f, 0.0486475229f, -0.606356084f, -0.161234185f, -0.0970382541f, 0.0412982628f, -0.591063082f, -0.123820834f, -0.747082055f, -0.720853686f, 0.157288194f, 0.133757576f, -0.0132747144f, -0.669595003f, -0.0866279155f, 0.0300007761f, -0.237648636f, 0.0913573653f, -0.664185643f, -0.186754882f, 0.229459465f, -0.0532065183f, 0.651626945f, 0.563069940f, 0.210303128f, 0.261469066f, -0.320853502f, -0.0864711404f, 0.0332702473f, -0.805371940f, 0.557332575f, -0.168407708f, 0.0615855083f, 0.226409137f, 0.340299606f, 0.790439963f, -0.184321523f, 0.380237937f, -0.495130479f, 0.00338565931f, 0.302180678f, 0.427088588f, 0.849323034f, 0.439262688f, 0.739853919f, 0.590513706f },
+    { -0.184047893f, -0.384730071f, -0.454139739f, 0.285348117f, 0.582491934f, -0.687377989f, -0.0177331995f, 0.404876530f, -0.00221616030f, -0.320668042f, 0.167912513f, 0.366360366f, 0.516869485f, -0.670367002f, 0.392891735f, 0.164383456f, 0.325126112f, 0.0665444136f, -0.862726271f, 0.0717201829f, -0.297296971f, 0.727549195f, 0.779667735f, -0.177811310f, 0.589710772f, 0.0369994044f, 0.217001170f, -0.228589624f, 0.542508543f, 0.349460691f, 0.961957216f, 0.657350957f, -0.210120663f, 0.0482864678f, 0.0546638891f, -0.136837721f, -0.360707164f, 0.175386846f, 0.730351806f, -0.383545160f, -0.0772688389f, -0.795132756f, 0.783649504f, -0.388341308f, 0.452985793f, 0.690764725f, 0.868685484f, 0.447853863f, 0.187052563f, 0.267331481f, -0.414278716f, 0.201090619f, 0.736296296f, -0.0639271811f, -0.350063354f, 0.361606091f, 0.340628028f, 0.774735928f, 0.544408143f, 0.273676932f, -0.499527931f, 0.623566031f, 0.764496863f, 0.161366388f, 0.460700810f, 0.500208318f, -0.0332920924f, 0.692781031f, -0.272864193f, 0.0612053163f, -0.488854855f, -0.495178461f, -0.450865507f, -0.509496450f, 0.242054611f, -0.430474281f, 0.724585474f, -0.00610350631f, -0.0944988728f, -0.811398983f, -0.517587364f, 0.219202086f, 0.145210460f, 0.175640315f, 0.161882788f, 0.136202186f, -0.0589661933f, -0.724386156f, 0.0107298875f, -0.299581379f, -0.0867406726f, 0.0152407382f, -0.389239460f, -0.612853527f, -0.536664009f, 0.505962372f, 0.253508270f, -0.271880865f, -0.213809118f, -0.758699834f, -0.741016150f, 0.246376455f, -0.134793192f, 0.131885260f, 0.383972079f, -0.245609045f, -0.00547148101f, -0.191780254f, 0.171857059f, -0.203705087f, 0.0668569505f, -0.00589323044f, 0.219943732f, -0.0243154652f, 0.382553756f, 0.169092149f, 0.185187757f },
+    { 0.265483320f, -0.0188315567f, -0.296258122f, -0.296258122f, -0.296258122f, 0.523059011f, 0.523059011f, 0.936802745f, 0.745312214f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.296258122f, 0.523059011f, 0.523059011f, 0.936802745f, 0.936802745f, 0.936802745f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, -0.0580559820f, -0.0580559820f, -0.0580559820f, -0.0580559820f, 0.439182997f, 0.439182997f, 0.936802745f, 0.936802745f, 0.936802745f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.523059011f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.936802745f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, -0.508625209f, 0.523059011f, 0.936802745f, 0.811972678f, 0.811972678f, -0.129867017f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.523059011f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, 0.463251352f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, 0.523059011f, 0.523059011f, 0.523059011f, 0.811972678f, 0.811972678f, 0.811972678f, 0.684951782f, 0.684951782f, -0.137378246f, -0.0188315567f, -0.716832280f, -0.716832280f, -0.716832280f, -0.508625209f, -0.508625209f, -0.0892724618f, 0.811972678f, 0.811972678f, -0.129867017f, -0.919258714f, 0.684951782f },
+    { 0.317630410f, 0.266189158f, 0.143253446f, 0.0432141572f, 0.188175648f, 0.112102769f, 0.187738165f, 0.178418756f, 0.138908207f, 0.0228107218f, 0.151713714f, 0.113725491f, 0.197366104f, 0.538601220f, 0.256964445f, 0.220327765f, 0.227982581f, 0.370253772f, 0.200889155f, 0.262453198f, 0.0726288110f, 0.127802283f, 0.0400815085f, 0.168984503f, 0.0376106836f, 0.121251300f, 0.312446624f, 0.135018021f, 0.202588946f, 0.515157700f, 0.477729678f, 0.463314295f, 0.401663303f, 0.211838901f, 0.267012388f, 0.0851844102f, 0.143109500f, 0.206495926f, 0.290136546f, 0.374087989f, 0.0924511999f, 0.0558145232f, 0.264175713f, 0.176816911f, 0.00745228305f, 0.0830876827f, 0.403721452f, 0.269349307f, 0.153251827f, 0.276063502f, 0.114703149f, 0.198343754f, 0.364863276f, 0.0832265019f, 0.0465898290f, 0.254951030f, 0.265603274f, 0.0962386727f, 0.171874076f, 0.370559990f, 0.253199816f, 0.0661236644f, 0.124048762f, 0.0385883413f, 0.122228958f, 0.600638688f, 0.319001973f, 0.282365292f, 0.247474909f, 0.261066735f, 0.327786744f, 0.505660653f, 0.509770095f, 0.225943625f, 0.0388674811f, 0.0845913291f, 0.207473576f, 0.291114211f, 0.445349902f, 0.163713112f, 0.127076432f, 0.335437626f, 0.317166299f, 0.147801667f, 0.223437071f, 0.544070840f, 0.644790292f, 0.528692782f, 0.522041023f, 0.360680670f, 0.420739174f, 0.436125189f, 0.154488415f, 0.117851742f, 0.104914702f, 0.118506536f, 0.236588061f, 0.312223464f, 0.632857263f, 0.451882750f, 0.264806598f, 0.322731704f, 0.272269040f, 0.254600883f, 0.640609086f, 0.390263885f, 0.276644200f, 0.0452367216f, 0.0588285550f, 0.208961144f, 0.469177663f, 0.400341481f, 0.424626559f, 0.237550423f, 0.246358007f, 0.179498032f, 0.296191037f },
+    { 0.547825933f, 0.312519342f, 0.229552463f, 0.437913656f, 0.281467378f, 0.578134775f, 0.368243158f, 0.500003576f, 0.233592242f, 0.384696692f, 0.275085837f, 0.525619984f, 0.425118983f, 0.617587388f, 0.440158814f, 0.328021854f, 0.428688973f, 0.372944087f, 0.697281480f, 0.276524544f, 0.517274380f, 0.156178996f, 0.112440594f, 0.170365691f, 0.473293304f, 0.392121851f, 0.707210183f, 0.492739916f, 0.456103235f, 0.657751322f, 0.676397741f, 0.534675717f, 0.437863559f, 0.305745304f, 0.272260547f, 0.163953841f, 0.167824507f, 0.416697085f, 0.604124844f, 0.481280863f, 0.476169825f, 0.395341694f, 0.295302391f, 0.440263897f, 0.830222964f, 0.666174293f, 0.476349920f, 0.525455892f, 0.338379771f, 0.282154799f, 0.656061113f, 0.438553900f, 0.760421574f, 0.735239506f, 0.538560390f, 0.307152897f, 0.320744723f, 0.579335690f, 0.560384393f, 0.492507845f, 0.286620080f, 0.170522615f, 0.199948698f, 0.426976383f, 0.704542935f, 0.607527316f, 0.430098712f, 0.478882402f, 0.490726501f, 0.312572241f, 0.430025220f, 0.543936014f, 0.517634869f, 0.321851820f, 0.0807206631f, 0.0967925787f, 0.333463877f, 0.528355896f, 0.889931202f, 0.884820163f, 0.641000032f, 0.409592539f, 0.423184365f, 0.634994388f, 0.667160034f, 0.738341928f, 0.676146924f, 0.537062705f, 0.594987810f, 0.475678861f, 0.444321275f, 1.00909758f, 0.812727511f, 0.336322188f, 0.326212943f, 0.405952692f, 0.377097458f, 0.816403031f, 0.741692901f, 0.662061095f, 0.519708097f, 0.445926219f, 0.284565866f, 0.368206501f, 0.671900630f, 0.518496335f, 0.353627205f, 0.423533887f, 0.193746656f, 0.317419469f, 0.475051582f, 0.856699824f, 0.483618498f, 0.242487341f, 0.274462879f, 0.313859195f, 0.329533428f },
+    { 0.865456343f, 0.578708529f, 0.372805893f, 0.481127799f, 0.469643027f, 0.690237522f, 0.555981338f, 0.678422332f, 0.372500449f, 0.407507420f, 0.426799536f, 0.639345467f, 0.622485101f, 1.15618861f, 0.697123289f, 0.548349619f, 0.656671524f, 0.743197858f, 0.898170650f, 0.538977742f, 0.589903176f, 0.283981264f, 0.152522102f, 0.339350194f, 0.510904014f, 0.513373137f, 1.01965678f, 0.627757907f, 0.658692181f, 1.17290902f, 1.15412736f, 0.997990012f, 0.839526892f, 0.517584205f, 0.539272904f, 0.249138251f, 0.310934007f, 0.623193026f, 0.894261360f, 0.855368853f, 0.568621039f, 0.451156229f, 0.559478104f, 0.617080808f, 0.837675273f, 0.749261975f, 0.880071402f, 0.794805169f, 0.491631597f, 0.558218300f, 0.770764232f, 0.636897683f, 1.12528491f, 0.818466008f, 0.585150242f, 0.562103927f, 0.586347997f, 0.675574362f, 0.732258439f, 0.863067865f, 0.539819896f, 0.236646280f, 0.323997468f, 0.465564728f, 0.826771915f, 1.20816600f, 0.749100685f, 0.761247694f, 0.738201380f, 0.573638976f, 0.757811964f, 1.04959667f, 1.02740502f, 0.547795415f, 0.119588144f, 0.181383908f, 0.540937424f, 0.819470108f, 1.33528113f, 1.04853332f, 0.768076479f, 0.745030165f, 0.740350664f, 0.782796025f, 0.890597105f, 1.28241277f, 1.32093716f, 1.06575549f, 1.11702883f, 0.836359501f, 0.865060449f, 1.44522274f, 0.967215896f, 0.454173923f, 0.431127638f, 0.524459243f, 0.613685489f, 1.12862647f, 1.37455010f, 1.11394382f, 0.784514666f, 0.768657923f, 0.556834936f, 0.622807384f, 1.31250978f, 0.908760190f, 0.630271435f, 0.468770623f, 0.252575219f, 0.526380599f, 0.944229245f, 1.25704134f, 0.908245087f, 0.480037749f, 0.520820856f, 0.493357241f, 0.625724435f },
+    { 0.230195522f, 0.0463301837f, 0.0862990171f, 0.394699514f, 0.0932917297f, 0.466031998f, 0.180504993f, 0.321584821f, 0.0946840346f, 0.361885965f, 0.123372123f, 0.411894500f, 0.227752879f, 0.0789861679f, 0.183194369f, 0.107694089f, 0.200706393f, 0.00269031525f, 0.496392310f, 0.0140713453f, 0.444645584f, 0.0283767134f, 0.0723590851f, 0.00138118863f, 0.435682625f, 0.270870566f, 0.394763559f, 0.357721895f, 0.253514290f, 0.142593622f, 0.198668063f, 0.0713614225f, 0.0362002552f, 0.0939064026f, 0.00524815917f, 0.0787694305f, 0.0247150064f, 0.210201159f, 0.313988298f, 0.107192874f, 0.383718610f, 0.339527160f, 0.0311266780f, 0.263446987f, 0.822770655f, 0.583086610f, 0.0726284683f, 0.256106585f, 0.185127944f, 0.00609129667f, 0.541357994f, 0.240210146f, 0.395558298f, 0.652013004f, 0.491970569f, 0.0522018671f, 0.0551414490f, 0.483097017f, 0.388510317f, 0.121947855f, 0.0334202647f, 0.104398951f, 0.0758999363f, 0.388388038f, 0.582313955f, 0.00688862801f, 0.111096740f, 0.196517110f, 0.243251592f, 0.0515055060f, 0.102238476f, 0.0382753611f, 0.00786477327f, 0.0959081948f, 0.0418531820f, 0.0122012496f, 0.125990301f, 0.237241685f, 0.444581300f, 0.721107066f, 0.513923585f, 0.0741549134f, 0.106018066f, 0.487192720f, 0.443722963f, 0.194271088f, 0.0313566327f, 0.00836992264f, 0.0729467869f, 0.114998192f, 0.0235821009f, 0.572972417f, 0.658239126f, 0.218470454f, 0.221298248f, 0.287446141f, 0.140509397f, 0.504179597f, 0.108835638f, 0.210178345f, 0.254901499f, 0.123194516f, 0.0122968256f, 0.113605618f, 0.0312915444f, 0.128232449f, 0.0769830048f, 0.378297150f, 0.134918094f, 0.108458325f, 0.00587391853f, 0.456358343f, 0.0589919388f, 0.00493691862f, 0.0281048715f, 0.134361163f, 0.0333423913f },
+    { 0.174006179f, 0.0831892639f, 0.0328841805f, 0.0189240705f, 0.0529653057f, 0.0648105070f, 0.0691332966f, 0.0892100185f, 0.0324478783f, 0.00877520908f, 0.0417342931f, 0.0597763918f, 0.0839040801f, 0.332633317f, 0.113105163f, 0.0722723231f, 0.0977336168f, 0.138083950f, 0.140076295f, 0.0725747496f, 0.0375690237f, 0.0199600328f, 0.00450678868f, 0.0287891608f, 0.0178008843f, 0.0475452840f, 0.220965430f, 0.0665287673f, 0.0924014747f, 0.338845670f, 0.323135287f, 0.247722909f, 0.175873727f, 0.0647687465f, 0.0726969391f, 0.0139663108f, 0.0240172818f, 0.0860462487f, 0.175278693f, 0.180041388f, 0.0440224707f, 0.0220658090f, 0.0780117214f, 0.0778461024f, 0.00618705666f, 0.0553508773f, 0.192312688f, 0.141531184f, 0.0518573187f, 0.0778926387f, 0.0752522722f, 0.0869844258f, 0.277449906f, 0.0611914136f, 0.0250914358f, 0.0783089474f, 0.0851908475f, 0.0557544976f, 0.0963155478f, 0.182503700f, 0.0725721493f, 0.0112755802f, 0.0248033889f, 0.0164763108f, 0.0861155465f, 0.364904404f, 0.137202337f, 0.135219768f, 0.121442497f, 0.0816022158f, 0.140956566f, 0.275047034f, 0.263874769f, 0.0727203637f, 0.00313740876f, 0.00818781275f, 0.0691849440f, 0.153811917f, 0.396330774f, 0.144856662f, 0.0814559981f, 0.137392744f, 0.134219825f, 0.0938532278f, 0.149068281f, 0.401710302f, 0.435972959f, 0.283941180f, 0.310608059f, 0.171568170f, 0.186943367f, 0.440092862f, 0.125556991f, 0.0396361575f, 0.0342245325f, 0.0481080487f, 0.0892167538f, 0.254900187f, 0.469385743f, 0.299173981f, 0.137622133f, 0.143914536f, 0.0774784759f, 0.0937457010f, 0.430425644f, 0.202350393f, 0.0978289172f, 0.0191592854f, 0.0113978358f, 0.0663283318f, 0.222883597f, 0.342972487f, 0.205357254f, 0.0576029718f, 0.0676161274f, 0.0563371070f, 0.0976048484f },
+    { 0.579801679f, 0.851752579f, 0.624055386f, 0.0986819118f, 0.668552220f, 0.193904221f, 0.509821177f, 0.356834948f, 0.594661057f, 0.0592953414f, 0.551514089f, 0.216364473f, 0.464260846f, 0.872105300f, 0.583799362f, 0.671686232f, 0.531813502f, 0.992786288f, 0.288103372f, 0.949113548f, 0.140406743f, 0.818306446f, 0.356468320f, 0.991892815f, 0.0794659108f, 0.309218436f, 0.441801637f, 0.274014771f, 0.444173455f, 0.783210456f, 0.706285119f, 0.866533279f, 0.917325258f, 0.692860663f, 0.980723739f, 0.519563377f, 0.852733016f, 0.495554030f, 0.480259240f, 0.777275860f, 0.194155946f, 0.141180456f, 0.894593894f, 0.401615739f, 0.00897624344f, 0.124723643f, 0.847531259f, 0.512601197f, 0.452898890f, 0.978411496f, 0.174836069f, 0.452267677f, 0.479817092f, 0.113196447f, 0.0865080878f, 0.830045998f, 0.828083038f, 0.166119009f, 0.306707472f, 0.752394080f, 0.883398712f, 0.387770653f, 0.620402932f, 0.0903758183f, 0.173486888f, 0.988661230f, 0.741694808f, 0.589633882f, 0.504303098f, 0.835220456f, 0.762250066f, 0.929632604f, 0.984806359f, 0.702011347f, 0.481505960f, 0.873944342f, 0.622177064f, 0.550981283f, 0.500431836f, 0.185024172f, 0.198247150f, 0.818954408f, 0.749475479f, 0.232760593f, 0.334907770f, 0.736881971f, 0.953624547f, 0.984415352f, 0.877397835f, 0.758244038f, 0.946925581f, 0.432193279f, 0.190086365f, 0.350413233f, 0.321614176f, 0.291922033f, 0.627392352f, 0.382437915f, 0.853260517f, 0.682539344f, 0.509529471f, 0.723733425f, 0.956787407f, 0.691462219f, 0.953428328f, 0.752683997f, 0.782304645f, 0.106807798f, 0.303636491f, 0.658312321f, 0.987635195f, 0.467306584f, 0.878019691f, 0.979640484f, 0.897600472f, 0.571906269f, 0.898819387f },
+    { -0.0572129861f, 0.289181262f, -0.0989582241f, -0.0989582241f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.243345723f, -0.407986462f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.243345723f, -0.243345723f, -0.243345723f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.370319843f, 0.370319843f, 0.370319843f, 0.370319843f, 0.707301438f, 0.707301438f, -0.243345723f, -0.243345723f, -0.243345723f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.331575334f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.243345723f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, 0.121696725f, -0.331575334f, -0.243345723f, -0.159302473f, -0.159302473f, -0.0174477100f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.331575334f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.0696947575f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, -0.331575334f, -0.331575334f, -0.331575334f, -0.159302473f, -0.159302473f, -0.159302473f, 0.114692032f, 0.114692032f, 0.303391665f, 0.289181262f, 0.0506955087f, 0.0506955087f, 0.0506955087f, 0.121696725f, 0.121696725f, -0.344950259f, -0.159302473f, -0.159302473f, -0.0174477100f, 0.201291546f, 0.114692032f },
+    { 0.579801679f, 0.528070807f, 0.353497386f, 0.0986819118f, 0.127717659f, 0.193904221f, 0.435535848f, 0.356834948f, 0.594661057f, 0.0592953414f, 0.283839881f, 0.216364473f, 0.464260846f, 0.627313673f, 0.548897445f, 0.671686232f, 0.531813502f, 0.578181386f, 0.288103372f, 0.467923522f, 0.140406743f, 0.160747081f, 0.283613920f, 0.715449572f, 0.0794659108f, 0.309218436f, 0.441801637f, 0.257906705f, 0.347113729f, 0.668582618f, 0.706285119f, 0.309152156f, 0.223660246f, 0.692860663f, 0.103771597f, 0.138438523f, 0.852733016f, 0.299909323f, 0.480259240f, 0.452292532f, 0.194155946f, 0.0853105485f, 0.494545788f, 0.164608523f, 0.00897624344f, 0.124723643f, 0.704532266f, 0.512601197f, 0.452898890f, 0.792940319f, 0.174836069f, 0.452267677f, 0.479817092f, 0.113196447f, 0.0865080878f, 0.787206531f, 0.584795892f, 0.166119009f, 0.306707472f, 0.752394080f, 0.616863370f, 0.387770653f, 0.255579561f, 0.0324789733f, 0.173486888f, 0.804973423f, 0.741694808f, 0.589633882f, 0.504303098f, 0.521440983f, 0.175860271f, 0.0600224324f, 0.547350526f, 0.522861660f, 0.481505960f, 0.323088974f, 0.0800453275f, 0.442116767f, 0.500431836f, 0.185024172f, 0.198247150f, 0.125512302f, 0.749475479f, 0.232760593f, 0.334907770f, 0.443452597f, 0.774668157f, 0.944875300f, 0.675324142f, 0.722285450f, 0.886377811f, 0.432193279f, 0.190086365f, 0.350413233f, 0.321614176f, 0.0822806880f, 0.430389196f, 0.382437915f, 0.216820896f, 0.427602202f, 0.509529471f, 0.394533515f, 0.305584699f, 0.691462219f, 0.497939885f, 0.496180087f, 0.782304645f, 0.106807798f, 0.0664093867f, 0.658312321f, 0.600226998f, 0.455725223f, 0.447475642f, 0.908598125f, 0.506485939f, 0.380127609f, 0.612948477f },
+    { 0.265483320f, 0.265483320f, -0.296258122f, -0.296258122f, -0.296258122f, 0.523059011f, 0.523059011f, 0.936802745f, 0.745312214f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, 0.265483320f, -0.0188315567f, -0.0188315567f, -0.296258122f, -0.296258122f, 0.523059011f, 0.936802745f, 0.936802745f, 0.936802745f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, -0.0580559820f, -0.0580559820f, -0.0580559820f, -0.296258122f, -0.716832280f, 0.0149993896f, -0.0173425786f, -0.0173425786f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.296258122f, 0.523059011f, 0.523059011f, 0.523059011f, 0.523059011f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.936802745f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, 0.523059011f, 0.523059011f, -0.0173425786f, 0.811972678f, 0.811972678f, -0.129867017f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, 0.523059011f, 0.523059011f, 0.523059011f, -0.546337843f, -0.393945932f, 0.745312214f, 0.592550278f, 0.592550278f, 0.463251352f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, 0.523059011f, 0.523059011f, 0.936802745f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.684951782f, -0.137378246f, -0.137378246f, -0.716832280f, -0.716832280f, -0.716832280f, -0.508625209f, -0.508625209f, -0.0892724618f, 0.811972678f, 0.811972678f, -0.129867017f, -0.919258714f, 0.684951782f },
+    { 0.771126509f, 0.756523609f, 0.591994286f, 0.306166530f, 0.656168818f, 0.439614177f, 0.655713916f, 0.672924280f, 0.502525508f, 0.170820609f, 0.520819068f, 0.512850881f, 0.751825094f, 1.12112641f, 0.812356472f, 0.707679749f, 0.656166434f, 1.00616872f, 0.693289638f, 0.720665693f, 0.370667189f, 0.528306365f, 0.220165715f, 0.570164204f, 0.295379907f, 0.534354091f, 0.935928464f, 0.585928082f, 0.778988719f, 1.00616658f, 1.09807551f, 1.03110182f, 1.02925897f, 0.679260492f, 0.819480717f, 0.469478428f, 0.634979427f, 0.645380080f, 0.884354293f, 0.838713288f, 0.488712877f, 0.384036213f, 0.656166494f, 0.490611196f, 0.140612721f, 0.356712461f, 0.706710935f, 0.852525473f, 0.520820558f, 0.865646482f, 0.515644193f, 0.754618406f, 0.812357008f, 0.462356567f, 0.357679904f, 0.707678378f, 0.744286656f, 0.394288182f, 0.610387921f, 0.720667124f, 0.765021384f, 0.415019095f, 0.580520093f, 0.298173219f, 0.537147403f, 1.16235709f, 0.812356710f, 0.707680106f, 0.709241986f, 0.748075485f, 0.744288325f, 0.960388064f, 1.02926040f, 0.687146604f, 0.337144315f, 0.457653552f, 0.648173392f, 0.887147605f, 1.04231882f, 0.692318380f, 0.587641716f, 0.879750371f, 0.840611100f, 0.490612626f, 0.706712365f, 0.942804933f, 0.932639539f, 0.870820463f, 1.21564627f, 0.865644038f, 1.02225614f, 1.01596248f, 0.665962100f, 0.561285436f, 0.529750466f, 0.568584085f, 0.744288087f, 0.960387826f, 1.07066703f, 1.11502123f, 0.765019000f, 0.930519998f, 0.648173153f, 0.733119130f, 1.26255798f, 0.913664818f, 0.709240496f, 0.359242052f, 0.398075610f, 0.614571810f, 0.964574099f, 0.926748037f, 1.03714657f, 0.687144220f, 0.807653427f, 0.555877924f, 0.851948142f },
+    { 1.18871319f, 0.838712811f, 0.734036088f, 1.08403456f, 0.789612651f, 1.00616729f, 1.02292275f, 0.852523983f, 0.830563426f, 0.897353113f, 0.862853169f, 0.870821416f, 0.968160152f, 1.15174055f, 0.935928226f, 0.941994190f, 1.05767822f, 1.04328811f, 1.07066798f, 0.909389377f, 0.901869059f, 0.551870644f, 0.547353208f, 0.645382166f, 0.920166492f, 0.992217004f, 1.16483557f, 1.16235662f, 1.05768001f, 1.05924189f, 1.13234758f, 1.04328978f, 1.07066584f, 0.720667362f, 0.878306508f, 0.570165873f, 0.695462704f, 0.984981716f, 1.33498025f, 1.12112641f, 1.10652351f, 0.941994250f, 0.734034657f, 1.00616884f, 1.06110990f, 1.37292266f, 1.02292418f, 1.05670941f, 0.765019000f, 0.870818973f, 1.22082138f, 1.07315540f, 1.16224384f, 1.28592813f, 1.22974885f, 0.879750371f, 0.918583989f, 1.25528467f, 1.07066560f, 0.960386395f, 0.878306270f, 0.570165634f, 0.648175478f, 0.930522382f, 1.08311903f, 1.23136020f, 0.935927987f, 1.05924034f, 1.05767858f, 0.910603404f, 0.905284524f, 1.04285705f, 1.03714514f, 0.796596766f, 0.446594447f, 0.502645314f, 0.807655811f, 1.15765429f, 1.47112632f, 1.16651905f, 1.22974885f, 0.937640190f, 0.918583989f, 1.15387881f, 1.29280341f, 1.05671084f, 1.20252538f, 1.11501884f, 1.22081888f, 1.13359976f, 1.08311903f, 1.34992886f, 1.22974741f, 0.879748940f, 0.911283910f, 0.921101809f, 0.918582559f, 1.26858485f, 1.27674818f, 1.22830617f, 0.920165598f, 0.998175442f, 0.783599854f, 0.887147367f, 1.28780913f, 1.01596224f, 0.911285639f, 0.921103954f, 0.571101665f, 0.748074114f, 1.09807634f, 1.31457257f, 1.14659667f, 0.796594381f, 0.827204227f, 0.902428746f, 0.905876398f },
+    { 1.95983970f, 1.59523642f, 1.32603037f, 1.39020109f, 1.44578147f, 1.44578147f, 1.67863667f, 1.52544832f, 1.33308887f, 1.06817377f, 1.38367224f, 1.38367224f, 1.71998525f, 2.27286696f, 1.74828470f, 1.64967394f, 1.71384466f, 2.04945683f, 1.76395762f, 1.63005507f, 1.27253628f, 1.08017707f, 0.767518938f, 1.21554637f, 1.21554637f, 1.52657104f, 2.10076404f, 1.74828470f, 1.83666873f, 2.06540847f, 2.23042297f, 2.07439160f, 2.09992480f, 1.39992785f, 1.69778728f, 1.03964424f, 1.33044219f, 1.63036180f, 2.21933460f, 1.95983970f, 1.59523642f, 1.32603049f, 1.39020109f, 1.49678004f, 1.20172262f, 1.72963512f, 1.72963512f, 1.90923488f, 1.28583956f, 1.73646545f, 1.73646557f, 1.82777381f, 1.97460079f, 1.74828470f, 1.58742881f, 1.58742881f, 1.66287065f, 1.64957285f, 1.68105352f, 1.68105352f, 1.64332771f, 0.985184729f, 1.22869563f, 1.22869563f, 1.62026644f, 2.39371729f, 1.74828470f, 1.76692045f, 1.76692057f, 1.65867889f, 1.64957285f, 2.00324512f, 2.06640553f, 1.48374343f, 0.783738732f, 0.960298896f, 1.45582914f, 2.04480195f, 2.51344514f, 1.85883737f, 1.81739056f, 1.81739056f, 1.75919509f, 1.64449143f, 1.99951577f, 1.99951577f, 2.13516498f, 1.98583937f, 2.43646526f, 1.99924374f, 2.10537529f, 2.36589146f, 1.89570951f, 1.44103432f, 1.44103432f, 1.48968589f, 1.66287065f, 2.22897267f, 2.34741521f, 2.34332752f, 1.68518460f, 1.92869544f, 1.43177295f, 1.62026644f, 2.55036712f, 1.92962706f, 1.62052608f, 1.28034604f, 0.969177246f, 1.36264586f, 2.06265044f, 2.24132061f, 2.18374324f, 1.48373866f, 1.63485765f, 1.45830667f, 1.75782454f },
+    { 0.417586684f, 0.0821892023f, 0.142041802f, 0.777868032f, 0.133443832f, 0.566553116f, 0.367208838f, 0.179599702f, 0.328037918f, 0.726532519f, 0.342034101f, 0.357970536f, 0.216335058f, 0.0306141376f, 0.123571754f, 0.234314442f, 0.401511788f, 0.0371193886f, 0.377378345f, 0.188723683f, 0.531201839f, 0.0235642791f, 0.327187479f, 0.0752179623f, 0.624786615f, 0.457862914f, 0.228907108f, 0.576428533f, 0.278691292f, 0.0530753136f, 0.0342720747f, 0.0121879578f, 0.0414068699f, 0.0414068699f, 0.0588257909f, 0.100687444f, 0.0604832768f, 0.339601636f, 0.450625956f, 0.282413125f, 0.617810607f, 0.557958007f, 0.0778681636f, 0.515557647f, 0.920497179f, 1.01621020f, 0.316213250f, 0.204183936f, 0.244198442f, 0.00517249107f, 0.705177188f, 0.318536997f, 0.349886835f, 0.823571563f, 0.872068942f, 0.172071993f, 0.174297333f, 0.860996485f, 0.460277677f, 0.239719272f, 0.113284886f, 0.155146539f, 0.0676553845f, 0.632349133f, 0.545971632f, 0.0690031052f, 0.123571277f, 0.351560235f, 0.348436594f, 0.162527919f, 0.160996199f, 0.0824689865f, 0.00788474083f, 0.109450161f, 0.109450132f, 0.0449917614f, 0.159482419f, 0.270506680f, 0.428807497f, 0.474200666f, 0.642107129f, 0.0578898191f, 0.0779728889f, 0.663266182f, 0.586091042f, 0.113905907f, 0.269885838f, 0.244198382f, 0.00517261028f, 0.267955720f, 0.0608628988f, 0.333966374f, 0.563785315f, 0.318463504f, 0.381533444f, 0.352517724f, 0.174294472f, 0.308197021f, 0.206081152f, 0.113284945f, 0.155146599f, 0.0676554441f, 0.135426700f, 0.154028237f, 0.0252511501f, 0.102297425f, 0.202045143f, 0.561861873f, 0.173026055f, 0.133502305f, 0.133502245f, 0.387824535f, 0.109450102f, 0.109450161f, 0.0195508003f, 0.346550822f, 0.0539282560f },
+    { 0.916648269f, 0.634506047f, 0.434545159f, 0.331895113f, 0.518119216f, 0.442325413f, 0.670744658f, 0.573684096f, 0.417379320f, 0.153286412f, 0.449390382f, 0.446601540f, 0.727887094f, 1.29124677f, 0.760307372f, 0.666630208f, 0.694012940f, 1.04972386f, 0.742283046f, 0.655365705f, 0.334293276f, 0.291556776f, 0.120508410f, 0.367973804f, 0.271798700f, 0.530195236f, 1.09020281f, 0.681057394f, 0.823920786f, 1.06577384f, 1.24340320f, 1.07573795f, 1.10199237f, 0.489520878f, 0.719755232f, 0.267680585f, 0.441604495f, 0.635687590f, 1.18059552f, 0.940303624f, 0.540772319f, 0.361759901f, 0.481648952f, 0.493637711f, 0.149205551f, 0.489738613f, 0.722911716f, 0.900871694f, 0.398437619f, 0.753821373f, 0.629509449f, 0.809822798f, 0.944156945f, 0.594557345f, 0.439856440f, 0.622580290f, 0.683689833f, 0.494943917f, 0.653521359f, 0.692118883f, 0.671923101f, 0.236629620f, 0.376278877f, 0.277456850f, 0.581794560f, 1.43128026f, 0.760307372f, 0.749603331f, 0.750150084f, 0.681200087f, 0.673792720f, 1.00154746f, 1.06749237f, 0.547378778f, 0.150566772f, 0.230037406f, 0.523500979f, 1.02701020f, 1.53338265f, 0.807602584f, 0.722651720f, 0.824889302f, 0.772171915f, 0.566107512f, 0.913640141f, 0.996272206f, 1.12152267f, 0.970981240f, 1.48408389f, 0.981293857f, 1.10722506f, 1.37147713f, 0.818965197f, 0.493790269f, 0.482753068f, 0.523723841f, 0.683690071f, 1.21833348f, 1.36697221f, 1.36958742f, 0.703944147f, 0.928822219f, 0.507908404f, 0.650384724f, 1.62593365f, 0.928248942f, 0.646320701f, 0.330899268f, 0.227341637f, 0.459745258f, 1.05917597f, 1.21827757f, 1.18918884f, 0.547375202f, 0.668094337f, 0.501640201f, 0.771759689f },
+    { 0.648706973f, 0.902005553f, 0.806492090f, 0.282432437f, 0.831000865f, 0.436919570f, 0.641020000f, 0.789331794f, 0.605041683f, 0.190360531f, 0.603601038f, 0.588927746f, 0.776550353f, 0.973419249f, 0.867968798f, 0.751257002f, 0.620383799f, 0.964420795f, 0.647530019f, 0.792472064f, 0.410998911f, 0.957301080f, 0.402236998f, 0.883452058f, 0.321007013f, 0.538545609f, 0.803485453f, 0.504086316f, 0.736506999f, 0.949893117f, 0.969733596f, 0.988317788f, 0.961326063f, 0.942543685f, 0.933023632f, 0.823406756f, 0.913031578f, 0.655220389f, 0.662447453f, 0.748098791f, 0.441665143f, 0.407684237f, 0.893917620f, 0.487603247f, 0.132514760f, 0.259819776f, 0.690873206f, 0.806773782f, 0.680794299f, 0.994060218f, 0.422374815f, 0.703177214f, 0.698955715f, 0.359550864f, 0.290856063f, 0.804408133f, 0.810254335f, 0.314102590f, 0.570101380f, 0.750392914f, 0.871018946f, 0.727892160f, 0.895621836f, 0.320436388f, 0.495926470f, 0.943961859f, 0.867969275f, 0.668101549f, 0.670564771f, 0.821516216f, 0.822159588f, 0.920920134f, 0.992397666f, 0.862602830f, 0.754922748f, 0.910490036f, 0.802536666f, 0.766332090f, 0.708517551f, 0.593490839f, 0.477855057f, 0.938260078f, 0.915116191f, 0.425185591f, 0.546651065f, 0.892207146f, 0.775567472f, 0.780991673f, 0.995763004f, 0.763624072f, 0.943807721f, 0.752604485f, 0.541543782f, 0.638006389f, 0.581323206f, 0.617286921f, 0.810257137f, 0.757054448f, 0.838589013f, 0.907771409f, 0.831392765f, 0.932220876f, 0.827173650f, 0.826378047f, 0.980392158f, 0.899309814f, 0.778285623f, 0.390012503f, 0.697031081f, 0.821538687f, 0.878421724f, 0.704980493f, 0.904543519f, 0.862602413f, 0.976365209f, 0.615979850f, 0.940468431f },
+    { -0.0572129861f, -0.0572129861f, -0.0989582241f, -0.0989582241f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.243345723f, -0.407986462f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, -0.0572129861f, 0.289181262f, 0.289181262f, -0.0989582241f, -0.0989582241f, -0.331575334f, -0.243345723f, -0.243345723f, -0.243345723f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.370319843f, 0.370319843f, 0.370319843f, -0.0989582241f, 0.0506955087f, 0.373529851f, 0.314009458f, 0.314009458f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.331575334f, -0.331575334f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.243345723f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, -0.331575334f, -0.331575334f, 0.314009458f, -0.159302473f, -0.159302473f, -0.0174477100f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, -0.331575334f, -0.331575334f, -0.331575334f, -0.495846808f, -0.419946909f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.0696947575f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, -0.331575334f, -0.331575334f, -0.243345723f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, 0.114692032f, 0.303391665f, 0.303391665f, 0.0506955087f, 0.0506955087f, 0.0506955087f, 0.121696725f, 0.121696725f, -0.344950259f, -0.159302473f, -0.159302473f, -0.0174477100f, 0.201291546f, 0.114692032f },
+    { 0.648706973f, 0.740679443f, 0.555456161f, 0.282432437f, 0.536725283f, 0.436919570f, 0.641020000f, 0.761462629f, 0.605041683f, 0.190360531f, 0.502142847f, 0.588927746f, 0.681158602f, 0.789758146f, 0.705612421f, 0.751257002f, 0.620383799f, 0.919049740f, 0.647530019f, 0.760193110f, 0.410998911f, 0.412082136f, 0.402236998f, 0.878042996f, 0.321007013f, 0.406723171f, 0.803485453f, 0.504086316f, 0.685133040f, 0.832323194f, 0.898613572f, 0.556619525f, 0.512161732f, 0.889241755f, 0.389022559f, 0.414431095f, 0.913031578f, 0.571195483f, 0.662447453f, 0.560329258f, 0.402228832f, 0.281550050f, 0.893917620f, 0.487603247f, 0.132514760f, 0.259819776f, 0.690873206f, 0.790037751f, 0.680794299f, 0.941970468f, 0.422374815f, 0.703177214f, 0.683133960f, 0.359550864f, 0.290856063f, 0.804408133f, 0.745950639f, 0.314102590f, 0.570101380f, 0.750392914f, 0.795911074f, 0.727892160f, 0.415224463f, 0.183898285f, 0.495926470f, 0.943961859f, 0.867969275f, 0.656822920f, 0.670564771f, 0.821516216f, 0.370696157f, 0.237852156f, 0.691408753f, 0.862602830f, 0.754922748f, 0.581572950f, 0.250679404f, 0.568495452f, 0.708517551f, 0.593490839f, 0.477855057f, 0.321706563f, 0.915116191f, 0.425185591f, 0.546651065f, 0.685508192f, 0.775567472f, 0.780991673f, 0.957710564f, 0.763624072f, 0.931905389f, 0.752604485f, 0.541543782f, 0.638006389f, 0.581323206f, 0.249701768f, 0.558227539f, 0.692139983f, 0.512839794f, 0.648187578f, 0.831392765f, 0.617609203f, 0.494167447f, 0.826378047f, 0.906916916f, 0.637370050f, 0.778285623f, 0.390012503f, 0.222748682f, 0.821538687f, 0.683489144f, 0.704980493f, 0.830340445f, 0.862602413f, 0.861731172f, 0.615979850f, 0.881424606f },
+    { 0.265483320f, 0.265483320f, -0.296258122f, -0.296258122f, -0.296258122f, 0.523059011f, 0.523059011f, 0.936802745f, 0.745312214f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.296258122f, -0.296258122f, 0.523059011f, 0.936802745f, 0.936802745f, 0.936802745f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, -0.0580559820f, -0.0580559820f, -0.0580559820f, -0.0580559820f, 0.439182997f, 0.439182997f, -0.0173425786f, 0.936802745f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.296258122f, 0.523059011f, 0.523059011f, 0.523059011f, 0.523059011f, 0.745312214f, 0.745312214f, 0.592550278f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.936802745f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, 0.523059011f, 0.523059011f, -0.0173425786f, 0.811972678f, 0.811972678f, -0.129867017f, 0.592550278f, 0.592550278f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.0188315567f, 0.523059011f, 0.523059011f, 0.523059011f, 0.523059011f, -0.393945932f, 0.745312214f, 0.592550278f, 0.592550278f, 0.463251352f, -0.0188315567f, -0.0188315567f, -0.0188315567f, -0.716832280f, -0.716832280f, 0.523059011f, 0.523059011f, 0.523059011f, 0.811972678f, 0.811972678f, 0.811972678f, 0.592550278f, 0.684951782f, -0.137378246f, -0.0188315567f, -0.716832280f, -0.716832280f, -0.716832280f, -0.508625209f, -0.508625209f, -0.0892724618f, 0.811972678f, 0.811972678f, -0.129867017f, -0.919258714f, 0.684951782f },
+    { 0.244933233f, 0.223256260f, 0.0848052204f, 0.0132307289f, 0.123474993f, 0.0492819659f, 0.123102531f, 0.120062314f, 0.0698049143f, 0.00389654143f, 0.0790153965f, 0.0583242178f, 0.148384795f, 0.626046836f, 0.208746731f, 0.155921504f, 0.149594516f, 0.375244677f, 0.139274374f, 0.189141020f, 0.0269211177f, 0.0675187558f, 0.00882457383f, 0.0963489115f, 0.0111094406f, 0.0647911280f, 0.292427689f, 0.0791108534f, 0.157814503f, 0.581606448f, 0.540956020f, 0.505550265f, 0.430047184f, 0.152665377f, 0.223112270f, 0.0399922431f, 0.0908715874f, 0.133268356f, 0.256583512f, 0.313752562f, 0.0451820903f, 0.0214347988f, 0.193767533f, 0.0867483541f, 0.00104788574f, 0.0296384115f, 0.285314351f, 0.229627147f, 0.0798166990f, 0.238973394f, 0.0591460131f, 0.149673849f, 0.296399236f, 0.0384803191f, 0.0166642461f, 0.180423334f, 0.197684973f, 0.0379457697f, 0.104909860f, 0.267050415f, 0.193703279f, 0.0274425838f, 0.0720127970f, 0.0115060098f, 0.0656549707f, 0.698156655f, 0.259143382f, 0.199824303f, 0.175519601f, 0.195297629f, 0.312732667f, 0.485630453f, 0.532781065f, 0.155256391f, 0.0131039498f, 0.0387135223f, 0.134478852f, 0.258261263f, 0.464196593f, 0.113341600f, 0.0746754110f, 0.314519793f, 0.266613513f, 0.0725133643f, 0.157905743f, 0.574925542f, 0.630601346f, 0.460396498f, 0.634617209f, 0.312221080f, 0.430103213f, 0.443086833f, 0.102883428f, 0.0661484674f, 0.0555786118f, 0.0673809275f, 0.176089674f, 0.299855620f, 0.829287469f, 0.503858864f, 0.202582076f, 0.300308317f, 0.184447959f, 0.186652780f, 0.808806121f, 0.396493375f, 0.196207270f, 0.0162509326f, 0.0234182123f, 0.128421634f, 0.452556610f, 0.371015668f, 0.440399975f, 0.163231403f, 0.198971882f, 0.0997789949f, 0.252339393f },
+    { 0.651207924f, 0.236428261f, 0.168499798f, 0.474713534f, 0.222250208f, 0.581700325f, 0.376684308f, 0.426265031f, 0.194013178f, 0.345208764f, 0.237358689f, 0.457721144f, 0.461889416f, 0.794173300f, 0.411957055f, 0.308994681f, 0.453414977f, 0.386281371f, 0.746556938f, 0.251468480f, 0.466513753f, 0.0861906037f, 0.0615447201f, 0.121445902f, 0.499549925f, 0.389069974f, 0.823783576f, 0.572739482f, 0.482411265f, 0.661807418f, 0.777772248f, 0.556610763f, 0.450674981f, 0.207680702f, 0.234518722f, 0.112210609f, 0.116715685f, 0.435642213f, 0.810866773f, 0.539576709f, 0.526893079f, 0.372409612f, 0.193914130f, 0.442979813f, 0.922340631f, 0.914605796f, 0.487269849f, 0.585894465f, 0.258866966f, 0.245705754f, 0.800933421f, 0.470636487f, 0.883795321f, 0.945465147f, 0.662294030f, 0.270217866f, 0.294630975f, 0.734935105f, 0.599984288f, 0.472997844f, 0.258494198f, 0.0972261354f, 0.129601836f, 0.397311091f, 0.763103843f, 0.781236589f, 0.402541429f, 0.507251561f, 0.519030929f, 0.284629345f, 0.320062757f, 0.567247510f, 0.545794129f, 0.256386131f, 0.0360493995f, 0.0486523360f, 0.269324034f, 0.663549662f, 1.30920124f, 1.06575298f, 0.788269043f, 0.360339195f, 0.388730377f, 0.787657678f, 0.888869345f, 0.696112394f, 0.775376678f, 0.598835051f, 0.761893749f, 0.539229453f, 0.490805417f, 1.52600145f, 0.999449551f, 0.295879096f, 0.297272593f, 0.444228590f, 0.346395135f, 1.11723387f, 0.946955085f, 0.828814745f, 0.502376914f, 0.445112616f, 0.213349983f, 0.326653421f, 0.917791247f, 0.473731846f, 0.322255403f, 0.390118748f, 0.110649034f, 0.237453282f, 0.541656852f, 1.18836689f, 0.554515362f, 0.193164051f, 0.227036849f, 0.283235550f, 0.298516542f },
+    { 0.896141171f, 0.459684521f, 0.253305018f, 0.487944275f, 0.345725209f, 0.630982280f, 0.499786854f, 0.546327353f, 0.263818085f, 0.349105299f, 0.316374093f, 0.516045332f, 0.610274196f, 1.42022014f, 0.620703816f, 0.464916170f, 0.603009462f, 0.761526048f, 0.885831296f, 0.440609515f, 0.493434876f, 0.153709352f, 0.0703692958f, 0.217794806f, 0.510659337f, 0.453861117f, 1.11621130f, 0.651850343f, 0.640225768f, 1.24341393f, 1.31872821f, 1.06216097f, 0.880722165f, 0.360346079f, 0.457630992f, 0.152202845f, 0.207587272f, 0.568910599f, 1.06745028f, 0.853329301f, 0.572075188f, 0.393844426f, 0.387681663f, 0.529728174f, 0.923388541f, 0.944244206f, 0.772584200f, 0.815521598f, 0.338683665f, 0.484679163f, 0.860079408f, 0.620310307f, 1.18019462f, 0.983945489f, 0.678958297f, 0.450641215f, 0.492315948f, 0.772880852f, 0.704894125f, 0.740048289f, 0.452197492f, 0.124668717f, 0.201614633f, 0.408817112f, 0.828758836f, 1.47939324f, 0.661684811f, 0.707075834f, 0.694550514f, 0.479926974f, 0.632795453f, 1.05287790f, 1.07857513f, 0.411642522f, 0.0491533503f, 0.0873658583f, 0.403802872f, 0.921810925f, 1.77339780f, 1.17909455f, 0.862944484f, 0.674858987f, 0.655343890f, 0.860171020f, 1.04677510f, 1.27103794f, 1.40597796f, 1.05923152f, 1.39651096f, 0.851450562f, 0.920908630f, 1.96908832f, 1.10233295f, 0.362027556f, 0.352851212f, 0.511609495f, 0.522484779f, 1.41708946f, 1.77624249f, 1.33267355f, 0.704958975f, 0.745420933f, 0.397797942f, 0.513306201f, 1.72659731f, 0.870225191f, 0.518462658f, 0.406369686f, 0.134067252f, 0.365874916f, 0.994213462f, 1.55938256f, 0.994915366f, 0.356395453f, 0.426008731f, 0.383014560f, 0.550855935f },
+    { 0.406274676f, 0.0131720006f, 0.0836945772f, 0.461482793f, 0.0987752154f, 0.532418370f, 0.253581762f, 0.306202710f, 0.124208264f, 0.341312230f, 0.158343285f, 0.399396926f, 0.313504636f, 0.168126464f, 0.203210324f, 0.153073177f, 0.303820461f, 0.0110366940f, 0.607282579f, 0.0623274595f, 0.439592630f, 0.0186718479f, 0.0527201444f, 0.0250969902f, 0.488440484f, 0.324278831f, 0.531355858f, 0.493628621f, 0.324596763f, 0.0802009702f, 0.236816227f, 0.0510604978f, 0.0206277966f, 0.0550153255f, 0.0114064515f, 0.0722183660f, 0.0258440971f, 0.302373856f, 0.554283261f, 0.225824147f, 0.481711000f, 0.350974798f, 0.000146597624f, 0.356231451f, 0.921292722f, 0.884967387f, 0.201955497f, 0.356267333f, 0.179050267f, 0.00673235953f, 0.741787434f, 0.320962638f, 0.587396085f, 0.906984806f, 0.645629764f, 0.0897945315f, 0.0969460011f, 0.696989357f, 0.495074421f, 0.205947429f, 0.0647909194f, 0.0697835535f, 0.0575890392f, 0.385805070f, 0.697448850f, 0.0830799341f, 0.143398046f, 0.307427257f, 0.343511343f, 0.0893317163f, 0.00733008981f, 0.0816170573f, 0.0130130649f, 0.101129740f, 0.0229454488f, 0.00993881375f, 0.134845182f, 0.405288398f, 0.845004678f, 0.952411413f, 0.713593602f, 0.0458194017f, 0.122116864f, 0.715144336f, 0.730963588f, 0.121186852f, 0.144775331f, 0.138438553f, 0.127276540f, 0.227008373f, 0.0607022047f, 1.08291459f, 0.896566153f, 0.229730636f, 0.241693974f, 0.376847655f, 0.170305461f, 0.817378283f, 0.117667615f, 0.324955881f, 0.299794853f, 0.144804299f, 0.0289020240f, 0.140000641f, 0.108985126f, 0.0772384703f, 0.126048133f, 0.373867810f, 0.0872308239f, 0.109031647f, 0.0891002417f, 0.817351222f, 0.114115387f, 0.0299326479f, 0.0280649662f, 0.183456555f, 0.0461771488f },
+    { 0.159502462f, 0.0527840890f, 0.0142896622f, 0.00628080592f, 0.0274423435f, 0.0286673363f, 0.0463707931f, 0.0511783659f, 0.0135430731f, 0.00134512025f, 0.0187549908f, 0.0266962275f, 0.0685373694f, 0.497189671f, 0.0859946907f, 0.0481789149f, 0.0678283945f, 0.144950032f, 0.103976250f, 0.0475630052f, 0.0125590712f, 0.00581948226f, 0.000543105940f, 0.0117011806f, 0.00554972002f, 0.0252082832f, 0.240897134f, 0.0453099087f, 0.0761314929f, 0.384911448f, 0.420740575f, 0.281394720f, 0.193811506f, 0.0317056514f, 0.0523240045f, 0.00448755408f, 0.0106061399f, 0.0580573231f, 0.208055049f, 0.169293568f, 0.0238061305f, 0.00798252504f, 0.0375742614f, 0.0384277701f, 0.000966507592f, 0.0271074623f, 0.139025077f, 0.134537280f, 0.0206619073f, 0.0587171391f, 0.0473720171f, 0.0704419762f, 0.261956245f, 0.0363817997f, 0.0110366307f, 0.0487536080f, 0.0582441166f, 0.0278876778f, 0.0629442707f, 0.126314268f, 0.0500711724f, 0.00266813627f, 0.00933299027f, 0.00457146531f, 0.0501015596f, 0.545425534f, 0.104315944f, 0.101361193f, 0.0911001042f, 0.0555874370f, 0.100094080f, 0.275472671f, 0.290788770f, 0.0398055837f, 0.000472389511f, 0.00188350328f, 0.0362183861f, 0.171369180f, 0.607726753f, 0.120794147f, 0.0588643141f, 0.113333806f, 0.103640772f, 0.0571157075f, 0.140357569f, 0.400212795f, 0.488953590f, 0.275701553f, 0.483510882f, 0.168358803f, 0.211096987f, 0.676151156f, 0.102826796f, 0.0195719488f, 0.0165219977f, 0.0299325343f, 0.0609966069f, 0.335008860f, 0.785297990f, 0.417605668f, 0.101772562f, 0.133671016f, 0.0393519700f, 0.0609707683f, 0.742315173f, 0.187831536f, 0.0632288530f, 0.00633979356f, 0.00259120250f, 0.0304941386f, 0.245130390f, 0.440902740f, 0.244208544f, 0.0315304399f, 0.0451739505f, 0.0282609593f, 0.0753274858f },
+    { 0.376121402f, 0.944287539f, 0.503295660f, 0.0278709754f, 0.555567503f, 0.0847205371f, 0.326805562f, 0.281661183f, 0.359794706f, 0.0112874927f, 0.332894474f, 0.127423033f, 0.321256101f, 0.788300037f, 0.506719649f, 0.504609048f, 0.329928488f, 0.971428335f, 0.186555594f, 0.752146065f, 0.0577070192f, 0.783365607f, 0.143384740f, 0.793348372f, 0.0222388990f, 0.166528210f, 0.354981214f, 0.138127118f, 0.327136844f, 0.878815234f, 0.695519805f, 0.908265352f, 0.954229116f, 0.735096574f, 0.951362312f, 0.356403410f, 0.778572202f, 0.305912405f, 0.316431165f, 0.581479073f, 0.0857519135f, 0.0575570501f, 0.999244034f, 0.195829138f, 0.00113611575f, 0.0324056670f, 0.585536659f, 0.391925782f, 0.308330953f, 0.972599924f, 0.0738463551f, 0.318024307f, 0.335370898f, 0.0406998806f, 0.0251614023f, 0.667695820f, 0.670957863f, 0.0516314581f, 0.174854338f, 0.564591169f, 0.749352515f, 0.282255203f, 0.555646420f, 0.0289596990f, 0.0860367417f, 0.893655837f, 0.643768251f, 0.393935323f, 0.338167906f, 0.686147213f, 0.977097988f, 0.856117368f, 0.976157546f, 0.605556905f, 0.363499820f, 0.795717657f, 0.499319911f, 0.389211655f, 0.354564726f, 0.106348842f, 0.0947334021f, 0.872843683f, 0.685857177f, 0.0920620263f, 0.177647859f, 0.825909078f, 0.813283861f, 0.768820226f, 0.832947135f, 0.579013407f, 0.876321256f, 0.290358067f, 0.102940090f, 0.223565876f, 0.186961770f, 0.151680753f, 0.508349180f, 0.268391103f, 0.875741065f, 0.607927024f, 0.403247178f, 0.674679399f, 0.864532351f, 0.571409225f, 0.881252825f, 0.836957395f, 0.608856440f, 0.0416563749f, 0.211644068f, 0.540829062f, 0.835504293f, 0.312206328f, 0.794206977f, 0.845040262f, 0.876385868f, 0.352282733f, 0.845311284f },
+    { -0.0572129861f, -0.0572129861f, -0.0989582241f, -0.0989582241f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.243345723f, -0.407986462f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, -0.0989582241f, -0.0989582241f, -0.331575334f, -0.243345723f, -0.243345723f, -0.243345723f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.370319843f, 0.370319843f, 0.370319843f, 0.370319843f, 0.707301438f, 0.707301438f, 0.314009458f, -0.243345723f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, -0.0989582241f, -0.331575334f, -0.331575334f, -0.331575334f, -0.331575334f, -0.407986462f, -0.407986462f, -0.0862608626f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.243345723f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, -0.331575334f, -0.331575334f, 0.314009458f, -0.159302473f, -0.159302473f, -0.0174477100f, -0.0862608626f, -0.0862608626f, 0.289181262f, 0.289181262f, 0.289181262f, 0.289181262f, -0.331575334f, -0.331575334f, -0.331575334f, -0.331575334f, -0.419946909f, -0.407986462f, -0.0862608626f, -0.0862608626f, 0.0696947575f, 0.289181262f, 0.289181262f, 0.289181262f, 0.0506955087f, 0.0506955087f, -0.331575334f, -0.331575334f, -0.331575334f, -0.159302473f, -0.159302473f, -0.159302473f, -0.0862608626f, 0.114692032f, 0.303391665f, 0.289181262f, 0.0506955087f, 0.0506955087f, 0.0506955087f, 0.121696725f, 0.121696725f, -0.344950259f, -0.159302473f, -0.159302473f, -0.0174477100f, 0.201291546f, 0.114692032f },
+    { 0.376121402f, 0.391131192f, 0.196352303f, 0.0278709754f, 0.0666429326f, 0.0847205371f, 0.326805562f, 0.281661183f, 0.359794706f, 0.0112874927f, 0.142528176f, 0.127423033f, 0.321256101f, 0.495426089f, 0.387308836f, 0.504609048f, 0.329928488f, 0.531377494f, 0.186555594f, 0.349817216f, 0.0577070192f, 0.0662410036f, 0.143384740f, 0.626112044f, 0.0222388990f, 0.139636889f, 0.354981214f, 0.131320342f, 0.237819105f, 0.529484570f, 0.695519805f, 0.172080114f, 0.114550233f, 0.708262146f, 0.0393126756f, 0.0573732294f, 0.778572202f, 0.171306849f, 0.316431165f, 0.253432721f, 0.0857519135f, 0.0240191873f, 0.387721598f, 0.0759099126f, 0.00113611575f, 0.0324056670f, 0.499697924f, 0.391925782f, 0.308330953f, 0.746926308f, 0.0738463551f, 0.318024307f, 0.335370898f, 0.0406998806f, 0.0251614023f, 0.649841964f, 0.436228871f, 0.0516314581f, 0.174854338f, 0.564591169f, 0.490968376f, 0.282255203f, 0.105866164f, 0.00597282732f, 0.0860367417f, 0.787609994f, 0.643768251f, 0.393935323f, 0.338167906f, 0.440513015f, 0.0651907250f, 0.0142764645f, 0.337608814f, 0.426606447f, 0.363499820f, 0.167470649f, 0.0168986991f, 0.251341373f, 0.354564726f, 0.106348842f, 0.0947334021f, 0.0403781310f, 0.685857177f, 0.0920620263f, 0.177647859f, 0.303990394f, 0.604135811f, 0.768820226f, 0.567700505f, 0.575945616f, 0.826020300f, 0.290358067f, 0.102940090f, 0.223565876f, 0.186961770f, 0.0205456316f, 0.240255088f, 0.268391103f, 0.111194387f, 0.277166426f, 0.403247178f, 0.243667513f, 0.142386153f, 0.571409225f, 0.448039502f, 0.316250354f, 0.608856440f, 0.0416563749f, 0.0147926034f, 0.540829062f, 0.410248637f, 0.312206328f, 0.350953072f, 0.845040262f, 0.436454743f, 0.304444641f, 0.492714554f },
+};
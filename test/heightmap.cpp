@@ -0,0 +1,153 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_heightmap.h"
+
+TEST_CASE("packed normals round trip on the whole sphere", "[FastNoiseSIMD]")
+{
+    for (int i = 0; i < 500; i++)
+    {
+        // Fibonacci sphere points, both hemispheres and the poles
+        float z = 1.0f - 2.0f * (i + 0.5f) / 500.0f;
+        float r = std::sqrt(1.0f - z * z);
+        float angle = i * 2.39996323f;
+        float x = r * std::cos(angle);
+        float y = r * std::sin(angle);
+
+        float dx, dy, dz;
+        FastNoiseHeightmapBaker::DecodeNormal(FastNoiseHeightmapBaker::EncodeNormal(x, y, z), &dx, &dy, &dz);
+
+        REQUIRE(dx == Approx(x).margin(2e-4));
+        REQUIRE(dy == Approx(y).margin(2e-4));
+        REQUIRE(dz == Approx(z).margin(2e-4));
+    }
+}
+
+TEST_CASE("heightmap derivatives of a bowl", "[FastNoiseSIMD]")
+{
+    // 7 texels per row leave a partial vector
+    const int xSize = 5, ySize = 7;
+    const float texelSize = 0.5f;
+
+    // h = 0.1 * ((x - 2)^2 + (y - 3)^2) in world units, texel (x, y) sits at world (x, y) * texelSize
+    std::vector<float> apron;
+    for (int x = -1; x <= xSize; x++)
+    {
+        for (int y = -1; y <= ySize; y++)
+        {
+            float wx = x * texelSize - 2.0f, wy = y * texelSize - 3.0f;
+            apron.push_back(0.1f * (wx * wx + wy * wy));
+        }
+    }
+
+    FastNoiseHeightmapBaker baker;
+    baker.heightScale = 2.0f;
+    baker.texelSize = texelSize;
+
+    const int size = xSize * ySize;
+    std::vector<float> heights(size), slopes(size), curvatures(size);
+    std::vector<FastNoisePackedNormal> normals(size);
+    baker.Derive(apron.data(), xSize, ySize, heights.data(), normals.data(), slopes.data(), curvatures.data());
+
+    for (int x = 0; x < xSize; x++)
+    {
+        for (int y = 0; y < ySize; y++)
+        {
+            int i = x * ySize + y;
+            float wx = x * texelSize - 2.0f, wy = y * texelSize - 3.0f;
+
+            // Central differences are exact for a quadratic
+            float gx = 2.0f * 0.2f * wx, gy = 2.0f * 0.2f * wy;
+            float length = std::sqrt(gx * gx + gy * gy + 1.0f);
+
+            INFO("texel " << x << ", " << y);
+            REQUIRE(heights[i] == Approx(apron[(x + 1) * (ySize + 2) + y + 1] * 2.0f));
+            REQUIRE(slopes[i] == Approx(std::sqrt(gx * gx + gy * gy)).margin(1e-4));
+            REQUIRE(curvatures[i] == Approx(2.0f * 0.4f).margin(1e-3));
+
+            float nx, ny, nz;
+            FastNoiseHeightmapBaker::DecodeNormal(normals[i], &nx, &ny, &nz);
+            REQUIRE(nx == Approx(-gx / length).margin(2e-4));
+            REQUIRE(ny == Approx(-gy / length).margin(2e-4));
+            REQUIRE(nz == Approx(1.0f / length).margin(2e-4));
+        }
+    }
+}
+
+TEST_CASE("heightmap bake matches deriving a filled set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    const int xSize = 9, ySize = 13, size = xSize * ySize;
+    float* apron = noise->GetNoiseSet(-4, 6, 20, xSize + 2, ySize + 2, 1);
+
+    FastNoiseHeightmapBaker baker;
+    baker.heightScale = 40.0f;
+    std::vector<float> expectedSlopes(size), slopes(size);
+    std::vector<FastNoisePackedNormal> expectedNormals(size), normals(size);
+    baker.Derive(apron, xSize, ySize, nullptr, expectedNormals.data(), expectedSlopes.data());
+    baker.Bake(noise, noise->GetConfig(), -3, 7, 20, xSize, ySize, 1.0f, nullptr, normals.data(), slopes.data());
+
+    REQUIRE(std::memcmp(normals.data(), expectedNormals.data(), size * sizeof(FastNoisePackedNormal)) == 0);
+    REQUIRE(slopes == expectedSlopes);
+
+    FastNoiseSIMD::FreeNoiseSet(apron);
+    delete noise;
+}
+
+TEST_CASE("heightmap rows derive the same at every SIMD level", "[FastNoiseSIMD]")
+{
+    const int detectedLevel = FastNoiseSIMD::GetSIMDLevel();
+
+    FastNoiseHeightmapBaker baker;
+    baker.heightScale = 3.0f;
+    baker.texelSize = 0.5f;
+    const float gradientScale = baker.heightScale / (2.0f * baker.texelSize);
+    const float curvatureScale = baker.heightScale / (baker.texelSize * baker.texelSize);
+
+    for (int level = FN_NO_SIMD_FALLBACK; level <= detectedLevel; level++)
+    {
+        FastNoiseSIMD::SetSIMDLevel(level);
+
+        // Rows up to past two 16 float vectors end part way through a vector at every level
+        for (int count = 1; count <= 40; count++)
+        {
+            std::vector<float> apron((count + 2) * 3);
+            for (size_t i = 0; i < apron.size(); i++)
+                apron[i] = float((i * 37 + i / 3) % 17) * 0.125f - 1.0f;
+
+            const float* low = &apron[0];
+            const float* row = low + count + 2;
+            const float* high = row + count + 2;
+
+            std::vector<float> heights(count), slopes(count), curvatures(count);
+            std::vector<FastNoisePackedNormal> normals(count + 1);
+            normals[count].u = normals[count].v = 12345;
+            baker.Derive(apron.data(), 1, count, heights.data(), normals.data(), slopes.data(), curvatures.data());
+
+            INFO("SIMD level " << level << ", count " << count);
+            for (int y = 0; y < count; y++)
+            {
+                float h = row[y + 1];
+                float gx = (high[y + 1] - low[y + 1]) * gradientScale;
+                float gy = (row[y + 2] - row[y]) * gradientScale;
+                float inv = 1.0f / (std::fabs(gx) + std::fabs(gy) + 1.0f);
+
+                REQUIRE(heights[y] == Approx(h * baker.heightScale));
+                REQUIRE(slopes[y] == Approx(std::sqrt(gx * gx + gy * gy)).margin(1e-5));
+                REQUIRE(curvatures[y] == Approx((low[y + 1] + high[y + 1] + row[y] + row[y + 2] - h * 4.0f) * curvatureScale).margin(1e-5));
+                REQUIRE(std::abs(normals[y].u - std::lrint(-gx * inv * 32767.0f)) <= 1);
+                REQUIRE(std::abs(normals[y].v - std::lrint(-gy * inv * 32767.0f)) <= 1);
+            }
+
+            // The partial vector stops at the end of the row
+            REQUIRE(normals[count].u == 12345);
+            REQUIRE(normals[count].v == 12345);
+        }
+    }
+
+    FastNoiseSIMD::SetSIMDLevel(detectedLevel);
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_incremental.h"
+
+static void RequireMatchesFill(FastNoiseSIMD* noise, const float* set, float scaleModifier = 1.0f)
+{
+    float* expected = noise->GetNoiseSet(-5, 3, 17, 8, 8, 13, scaleModifier);
+
+    for (int i = 0; i < 8 * 8 * 13; i++)
+        REQUIRE(set[i] == Approx(expected[i]).margin(1e-5));
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+}
+
+TEST_CASE("incremental sets only evaluate changed octaves", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::SimplexFractal);
+    noise->SetFractalOctaves(4);
+    noise->SetFractalRotation(true);
+
+    FastNoiseIncrementalSet incremental(-5, 3, 17, 8, 8, 13);
+    float* set = FastNoiseSIMD::GetEmptySet(8 * 8 * 13);
+
+    const FastNoiseSIMD::FractalType types[] = { FastNoiseSIMD::FBM, FastNoiseSIMD::Billow, FastNoiseSIMD::RigidMulti };
+
+    for (FastNoiseSIMD::FractalType type : types)
+    {
+        noise->SetFractalType(type);
+        noise->SetFractalOctaves(4);
+        noise->SetFractalGain(0.5f);
+        REQUIRE(incremental.FillNoiseSet(noise, set) == 4);
+        RequireMatchesFill(noise, set);
+
+        noise->SetFractalGain(0.7f);
+        REQUIRE(incremental.FillNoiseSet(noise, set) == 0);
+        RequireMatchesFill(noise, set);
+
+        noise->SetFractalOctaves(6);
+        REQUIRE(incremental.FillNoiseSet(noise, set) == 2);
+        RequireMatchesFill(noise, set);
+
+        noise->SetFractalOctaves(3);
+        REQUIRE(incremental.FillNoiseSet(noise, set) == 0);
+        RequireMatchesFill(noise, set);
+        REQUIRE(incremental.GetKeptOctaveCount() == 6);
+    }
+
+    noise->SetFrequency(0.03f);
+    REQUIRE(incremental.FillNoiseSet(noise, set) == 3);
+    RequireMatchesFill(noise, set);
+    REQUIRE(incremental.GetKeptOctaveCount() == 3);
+
+    // The Nyquist limit at scaleModifier 7 is 2.25 octaves, the third octave is faded
+    noise->SetFractalType(FastNoiseSIMD::FBM);
+    noise->SetFractalAntiAliasing(true);
+    FastNoiseIncrementalSet coarse(-5, 3, 17, 8, 8, 13, 7.0f);
+    REQUIRE(coarse.FillNoiseSet(noise, set) == 3);
+    RequireMatchesFill(noise, set, 7.0f);
+    noise->SetFractalAntiAliasing(false);
+
+    // Not split into octaves, filled in full each time
+    noise->SetFractalType(FastNoiseSIMD::HybridMulti);
+    REQUIRE(incremental.FillNoiseSet(noise, set) == 3);
+    REQUIRE(incremental.FillNoiseSet(noise, set) == 3);
+    RequireMatchesFill(noise, set);
+
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
+
+TEST_CASE("incremental sets keep weighted octaves below a changed weight", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    noise->SetFractalAntiAliasing(true);
+    noise->SetFrequency(0.2f);
+
+    float amplitudes[] = { 0.6f, -0.3f, 0.2f, 0.4f, 0.1f };
+    float frequencies[] = { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f };
+    const int seedOffsets[] = { 7, -2, 0, 19, 3 };
+    noise->SetFractalOctaveWeights(5, amplitudes, frequencies, seedOffsets);
+
+    // Anti-aliasing keeps the first 3 octaves at scaleModifier 1.5
+    FastNoiseIncrementalSet incremental(-5, 3, 17, 8, 8, 13, 1.5f);
+    float* set = FastNoiseSIMD::GetEmptySet(8 * 8 * 13);
+
+    REQUIRE(incremental.FillNoiseSet(noise, set) == noise->GetNyquistOctaves(1.5f));
+    RequireMatchesFill(noise, set, 1.5f);
+
+    amplitudes[0] = -0.2f;
+    noise->SetFractalOctaveWeights(5, amplitudes, frequencies, seedOffsets);
+    REQUIRE(incremental.FillNoiseSet(noise, set) == 0);
+    RequireMatchesFill(noise, set, 1.5f);
+
+    frequencies[1] = 1.2f;
+    noise->SetFractalOctaveWeights(5, amplitudes, frequencies, seedOffsets);
+    REQUIRE(incremental.FillNoiseSet(noise, set) == incremental.GetKeptOctaveCount() - 1);
+    RequireMatchesFill(noise, set, 1.5f);
+
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
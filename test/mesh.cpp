@@ -0,0 +1,204 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_mesh.h"
+
+// Density of a ball, positive inside, with the apron of an n^3 chunk
+static std::vector<float> GetBallDensity(int n, const float* center, float radius)
+{
+    std::vector<float> density;
+    for (int x = -1; x <= n; x++)
+    {
+        for (int y = -1; y <= n; y++)
+        {
+            for (int z = -1; z <= n; z++)
+                density.push_back(radius - std::sqrt((x - center[0]) * (x - center[0]) + (y - center[1]) * (y - center[1]) + (z - center[2]) * (z - center[2])));
+        }
+    }
+    return density;
+}
+
+static std::vector<std::array<float, 3>> GetSortedPositions(const FastNoiseMesh& mesh)
+{
+    std::vector<std::array<float, 3>> positions(mesh.GetVertexCount());
+    for (size_t v = 0; v < positions.size(); v++)
+        positions[v] = { mesh.positions[v * 3], mesh.positions[v * 3 + 1], mesh.positions[v * 3 + 2] };
+
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+TEST_CASE("surface nets mesh of a ball is closed and faces out", "[FastNoiseSIMD]")
+{
+    const int n = 20;
+    const float center[] = { 9.3f, 10.1f, 8.7f };
+    const float radius = 6.2f;
+    std::vector<float> density = GetBallDensity(n, center, radius);
+
+    FastNoiseMesher mesher;
+    mesher.brickSize = 4;
+    FastNoiseMesh mesh;
+    mesher.Extract(mesh, density.data(), n, n, n);
+
+    REQUIRE(mesh.GetTriangleCount() > 100);
+    REQUIRE(mesh.normals.size() == mesh.positions.size());
+
+    for (size_t v = 0; v < mesh.GetVertexCount(); v++)
+    {
+        const float* p = &mesh.positions[v * 3];
+        const float* normal = &mesh.normals[v * 3];
+        float offset[3] = { p[0] - center[0], p[1] - center[1], p[2] - center[2] };
+        float distance = std::sqrt(offset[0] * offset[0] + offset[1] * offset[1] + offset[2] * offset[2]);
+
+        REQUIRE(distance == Approx(radius).margin(0.25));
+        REQUIRE((normal[0] * offset[0] + normal[1] * offset[1] + normal[2] * offset[2]) / distance > 0.9f);
+    }
+
+    // Every directed edge has its reverse in the neighbouring triangle
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (size_t t = 0; t < mesh.GetTriangleCount(); t++)
+    {
+        const uint32_t* triangle = &mesh.indices[t * 3];
+        for (int e = 0; e < 3; e++)
+            edges[std::make_pair(triangle[e], triangle[(e + 1) % 3])]++;
+
+        const float* a = &mesh.positions[triangle[0] * 3];
+        const float* b = &mesh.positions[triangle[1] * 3];
+        const float* c = &mesh.positions[triangle[2] * 3];
+        float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+        float face[3] = { ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0] };
+        REQUIRE(face[0] * (a[0] - center[0]) + face[1] * (a[1] - center[1]) + face[2] * (a[2] - center[2]) > 0.0f);
+    }
+
+    for (const auto& edge : edges)
+    {
+        REQUIRE(edge.second == 1);
+        REQUIRE(edges.count(std::make_pair(edge.first.second, edge.first.first)) == 1);
+    }
+}
+
+TEST_CASE("surface nets bricks don't change the mesh", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetFrequency(0.08f);
+    float* density = noise->GetNoiseSet(-1, 3, -5, 19, 14, 23);
+
+    FastNoiseMesher mesher;
+    FastNoiseMesh expected;
+    mesher.brickSize = 1000;
+    mesher.Extract(expected, density, 17, 12, 21);
+    REQUIRE(expected.GetTriangleCount() > 0);
+
+    for (int brickSize : { 1, 3, 8 })
+    {
+        FastNoiseMesh mesh;
+        mesher.brickSize = brickSize;
+        mesher.Extract(mesh, density, 17, 12, 21);
+
+        INFO("brick size " << brickSize);
+        REQUIRE(mesh.GetTriangleCount() == expected.GetTriangleCount());
+        REQUIRE(GetSortedPositions(mesh) == GetSortedPositions(expected));
+    }
+
+    // Generate() fills the same apron
+    FastNoiseMesh generated;
+    mesher.Generate(generated, noise, noise->GetConfig(), 0, 4, -4, 17, 12, 21);
+    REQUIRE(GetSortedPositions(generated) == GetSortedPositions(expected));
+
+    FastNoiseSIMD::FreeNoiseSet(density);
+    delete noise;
+}
+
+TEST_CASE("surface nets chunks share their boundary vertices", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetFrequency(0.1f);
+    const int n = 12;
+
+    FastNoiseMesher mesher;
+    FastNoiseMesh low, high;
+    mesher.Generate(low, noise, noise->GetConfig(), 0, 0, 0, n, n, n);
+    mesher.Generate(high, noise, noise->GetConfig(), n, 0, 0, n, n, n);
+
+    // Cell n - 1 of the low chunk is the apron cell -1 of the high chunk
+    std::vector<std::array<float, 3>> lowEdge, highEdge;
+    for (const std::array<float, 3>& p : GetSortedPositions(low))
+    {
+        if (p[0] > n - 1 && p[1] < n - 1 && p[2] < n - 1 && p[1] > -1 && p[2] > -1)
+            lowEdge.push_back(p);
+    }
+    for (const std::array<float, 3>& p : GetSortedPositions(high))
+    {
+        if (p[0] < 0 && p[1] < n - 1 && p[2] < n - 1 && p[1] > -1 && p[2] > -1)
+            highEdge.push_back({ p[0] + n, p[1], p[2] });
+    }
+
+    REQUIRE(!lowEdge.empty());
+    REQUIRE(lowEdge.size() == highEdge.size());
+    for (size_t i = 0; i < lowEdge.size(); i++)
+    {
+        for (int a = 0; a < 3; a++)
+            REQUIRE(lowEdge[i][a] == Approx(highEdge[i][a]).margin(1e-4));
+    }
+
+    delete noise;
+}
+
+TEST_CASE("surface nets rows mesh the same at every SIMD level", "[FastNoiseSIMD]")
+{
+    const int detectedLevel = FastNoiseSIMD::GetSIMDLevel();
+
+    FastNoiseMesher mesher;
+    mesher.isoLevel = 0.5f;
+    mesher.brickSize = 256;
+
+    // Rows up to past two 64 byte vectors end part way through a vector at every level
+    for (int zSize = 1; zSize <= 140; zSize++)
+    {
+        const int zSamples = zSize + 2;
+        std::vector<float> density(3 * 3 * zSamples);
+        for (size_t i = 0; i < density.size(); i++)
+            density[i] = float((i * 37 + i / 5) % 11) - 5.5f;
+
+        // One vertex per cell with corners on both sides
+        size_t crossedCells = 0;
+        for (int x = 0; x < 2; x++)
+        {
+            for (int y = 0; y < 2; y++)
+            {
+                for (int z = 0; z <= zSize; z++)
+                {
+                    int inside = 0;
+                    for (int c = 0; c < 8; c++)
+                        inside += density[((x + (c >> 2)) * 3 + y + ((c >> 1) & 1)) * zSamples + z + (c & 1)] > 0.5f;
+                    crossedCells += inside != 0 && inside != 8;
+                }
+            }
+        }
+
+        FastNoiseMesh expected;
+        for (int level = FN_NO_SIMD_FALLBACK; level <= detectedLevel; level++)
+        {
+            FastNoiseSIMD::SetSIMDLevel(level);
+            FastNoiseMesh mesh;
+            mesher.Extract(mesh, density.data(), 1, 1, zSize);
+
+            INFO("SIMD level " << level << ", z size " << zSize);
+            REQUIRE(mesh.GetVertexCount() == crossedCells);
+
+            if (level == FN_NO_SIMD_FALLBACK)
+                expected = mesh;
+            REQUIRE(mesh.positions == expected.positions);
+            REQUIRE(mesh.indices == expected.indices);
+        }
+    }
+
+    FastNoiseSIMD::SetSIMDLevel(detectedLevel);
+}
@@ -0,0 +1,70 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+TEST_CASE("geometric octave weights match the fractal settings", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::SimplexFractal);
+    noise->SetFractalOctaves(4);
+    noise->SetFractalLacunarity(2.0f);
+    noise->SetFractalGain(0.5f);
+
+    const float amplitudes[] = { 1.0f, 0.5f, 0.25f, 0.125f };
+    const float frequencies[] = { 1.0f, 2.0f, 4.0f, 8.0f };
+    const int seedOffsets[] = { 0, 1, 2, 3 };
+
+    const FastNoiseSIMD::FractalType types[] = { FastNoiseSIMD::FBM, FastNoiseSIMD::Billow, FastNoiseSIMD::RigidMulti,
+        FastNoiseSIMD::HybridMulti, FastNoiseSIMD::HeteroTerrain, FastNoiseSIMD::ErodedFBM };
+    const int size = 8 * 8 * 13;
+
+    for (FastNoiseSIMD::FractalType type : types)
+    {
+        noise->SetFractalType(type);
+        noise->ClearFractalOctaveWeights();
+        float* expected = noise->GetNoiseSet(-3, 5, 9, 8, 8, 13);
+
+        noise->SetFractalOctaveWeights(4, amplitudes, frequencies, seedOffsets);
+        float* weighted = noise->GetNoiseSet(-3, 5, 9, 8, 8, 13);
+
+        for (int i = 0; i < size; i++)
+            REQUIRE(weighted[i] == Approx(expected[i]).margin(1e-5));
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(weighted);
+    }
+
+    delete noise;
+}
+
+TEST_CASE("octave weights bands add up to the fractal set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    noise->SetFractalRotation(true);
+
+    const float amplitudes[] = { 0.6f, -0.3f, 0.0f, 0.4f, 0.1f };
+    const float frequencies[] = { 0.5f, 1.7f, 2.0f, 5.3f, 11.0f };
+    const int seedOffsets[] = { 7, -2, 0, 19, 3 };
+    noise->SetFractalOctaveWeights(5, amplitudes, frequencies, seedOffsets);
+
+    const int size = 8 * 8 * 13;
+    float* expected = noise->GetNoiseSet(-3, 5, 9, 8, 8, 13);
+    float* low = FastNoiseSIMD::GetEmptySet(size);
+    float* high = FastNoiseSIMD::GetEmptySet(size);
+    noise->FillFractalBandSet(low, -3, 5, 9, 8, 8, 13, 0, 3);
+    noise->FillFractalBandSet(high, -3, 5, 9, 8, 8, 13, 3, 5);
+
+    for (int i = 0; i < size; i++)
+    {
+        REQUIRE(low[i] + high[i] == Approx(expected[i]).margin(1e-5));
+        REQUIRE(std::abs(expected[i]) <= 1.0f);
+    }
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(low);
+    FastNoiseSIMD::FreeNoiseSet(high);
+    delete noise;
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+#include "simd_levels.h"
+
+static std::vector<FastNoiseOutputTransform> GetTransforms()
+{
+    std::vector<FastNoiseOutputTransform> transforms;
+    FastNoiseOutputTransform transform;
+
+    transform.scale = 0.5f;
+    transform.bias = 0.5f;
+    transform.clamp = true;
+    transform.clampMin = 0.1f;
+    transform.clampMax = 0.8f;
+    transforms.push_back(transform);
+
+    transform = FastNoiseOutputTransform();
+    transform.abs = true;
+    transform.exponent = 1.7f;
+    transforms.push_back(transform);
+
+    transform = FastNoiseOutputTransform();
+    transform.exponent = 0.5f;
+    transform.terraceSteps = 6.0f;
+    transform.terraceSmoothness = 0.3f;
+    transforms.push_back(transform);
+
+    const float x[] = { -0.6f, -0.1f, 0.0f, 0.4f, 0.7f };
+    const float y[] = { -1.0f, 0.2f, 0.25f, 0.9f, 0.3f };
+    for (bool cubic : { false, true })
+    {
+        transform = FastNoiseOutputTransform();
+        transform.scale = 1.2f;
+        transform.SetSpline(5, x, y, cubic);
+        transforms.push_back(transform);
+    }
+
+    return transforms;
+}
+
+TEST_CASE("output transform matches transforming the set afterwards", "[FastNoiseSIMD]")
+{
+    const std::vector<FastNoiseOutputTransform> transforms = GetTransforms();
+
+    ForEachSIMDLevel({ FastNoiseSIMD::PerlinFractal, FastNoiseSIMD::WhiteNoise }, [&](FastNoiseSIMD& noise, int zSize)
+    {
+        const int size = 6 * 5 * zSize;
+        float* plain = noise.GetNoiseSet(3, -8, 17, 6, 5, zSize);
+        float* set = FastNoiseSIMD::GetEmptySet(size);
+
+        for (size_t t = 0; t < transforms.size(); t++)
+        {
+            noise.FillNoiseSet(set, 3, -8, 17, 6, 5, zSize, 1.0f, transforms[t]);
+
+            INFO("transform " << t);
+            for (int i = 0; i < size; i++)
+                REQUIRE(set[i] == Approx(transforms[t].Apply(plain[i])).margin(1e-5));
+        }
+
+        FastNoiseSIMD::FreeNoiseSet(plain);
+        FastNoiseSIMD::FreeNoiseSet(set);
+    });
+}
+
+TEST_CASE("output transform splines pass through their points", "[FastNoiseSIMD]")
+{
+    const float x[] = { -1.0f, -0.2f, 0.3f, 1.0f };
+    const float y[] = { 0.0f, 0.1f, 0.8f, 1.0f };
+
+    for (bool cubic : { false, true })
+    {
+        FastNoiseOutputTransform transform;
+        transform.SetSpline(4, x, y, cubic);
+
+        for (int i = 0; i < 4; i++)
+            REQUIRE(transform.Apply(x[i]) == Approx(y[i]).margin(1e-6));
+
+        REQUIRE(transform.Apply(-5.0f) == y[0]);
+        REQUIRE(transform.Apply(5.0f) == Approx(y[3]).margin(1e-6));
+
+        // Ascending points give an ascending curve without overshoot
+        float previous = transform.Apply(-1.0f);
+        for (int i = 1; i <= 200; i++)
+        {
+            float value = transform.Apply(-1.0f + i * 0.01f);
+            REQUIRE(value >= previous - 1e-6f);
+            REQUIRE(value <= 1.0f + 1e-6f);
+            previous = value;
+        }
+    }
+}
+
+TEST_CASE("reduction of vector set fills sees the transformed values", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::Cellular);
+
+    FastNoiseVectorSet vectorSet;
+    FastNoiseSIMD::FillVectorSet(&vectorSet, 4, 3, 7);
+
+    FastNoiseOutputTransform transform;
+    transform.scale = -2.0f;
+    transform.clamp = true;
+    transform.clampMin = -1.0f;
+    transform.clampMax = -0.5f;
+
+    float* plain = FastNoiseSIMD::GetEmptySet(vectorSet.size);
+    float* set = FastNoiseSIMD::GetEmptySet(vectorSet.size);
+    noise->FillNoiseSet(plain, &vectorSet);
+
+    FastNoiseReduction reduction;
+    noise->FillNoiseSet(set, &vectorSet, transform, &reduction);
+
+    float min = transform.Apply(plain[0]);
+    float max = min;
+    for (int i = 0; i < vectorSet.size; i++)
+    {
+        REQUIRE(set[i] == Approx(transform.Apply(plain[i])).margin(1e-5));
+        min = std::min(min, set[i]);
+        max = std::max(max, set[i]);
+    }
+
+    REQUIRE(reduction.count == uint64_t(vectorSet.size));
+    REQUIRE(reduction.min == min);
+    REQUIRE(reduction.max == max);
+    REQUIRE(reduction.min >= -1.0f);
+    REQUIRE(reduction.max <= -0.5f);
+
+    FastNoiseSIMD::FreeNoiseSet(plain);
+    FastNoiseSIMD::FreeNoiseSet(set);
+    delete noise;
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+TEST_CASE("fractal bands add up to the fractal set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    noise->SetFractalOctaves(5);
+
+    const FastNoiseSIMD::FractalType types[] = { FastNoiseSIMD::FBM, FastNoiseSIMD::Billow, FastNoiseSIMD::RigidMulti,
+        FastNoiseSIMD::HybridMulti, FastNoiseSIMD::HeteroTerrain, FastNoiseSIMD::ErodedFBM };
+    const int size = 8 * 8 * 13;
+
+    for (FastNoiseSIMD::FractalType type : types)
+    {
+        noise->SetFractalType(type);
+
+        float* expected = noise->GetNoiseSet(-3, 5, 9, 8, 8, 13);
+        float* low = FastNoiseSIMD::GetEmptySet(size);
+        float* high = FastNoiseSIMD::GetEmptySet(size);
+        noise->FillFractalBandSet(low, -3, 5, 9, 8, 8, 13, 0, 2);
+        noise->FillFractalBandSet(high, -3, 5, 9, 8, 8, 13, 2, 5);
+
+        for (int i = 0; i < size; i++)
+            REQUIRE(low[i] + high[i] == Approx(expected[i]).margin(1e-5));
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(low);
+        FastNoiseSIMD::FreeNoiseSet(high);
+    }
+
+    delete noise;
+}
+
+TEST_CASE("noise set pyramid levels", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetFrequency(0.05f);
+    noise->SetFractalOctaves(6);
+
+    const int levelCount = 4;
+    const int xStart = 16, yStart = -8, zStart = 4;
+    const int xSize = 16, ySize = 16, zSize = 16;
+
+    const FastNoiseSIMD::NoiseType types[] = { FastNoiseSIMD::SimplexFractal, FastNoiseSIMD::Cellular };
+
+    for (FastNoiseSIMD::NoiseType type : types)
+    {
+        noise->SetNoiseType(type);
+
+        float* levels[levelCount];
+        for (int level = 0; level < levelCount; level++)
+            levels[level] = FastNoiseSIMD::GetEmptySet(FastNoiseSIMD::GetPyramidLevelSize(xSize, level),
+                FastNoiseSIMD::GetPyramidLevelSize(ySize, level), FastNoiseSIMD::GetPyramidLevelSize(zSize, level));
+
+        noise->FillNoiseSetPyramid(levels, levelCount, xStart, yStart, zStart, xSize, ySize, zSize);
+
+        // zStart = 4 makes level 3 a separate evaluation instead of a copy of level 0
+        for (int level = 0; level < levelCount; level++)
+        {
+            float scale = float(1 << level);
+            int xLevel = FastNoiseSIMD::GetPyramidLevelSize(xSize, level);
+            int yLevel = FastNoiseSIMD::GetPyramidLevelSize(ySize, level);
+            int zLevel = FastNoiseSIMD::GetPyramidLevelSize(zSize, level);
+            float* expected = FastNoiseSIMD::GetEmptySet(xLevel, yLevel, zLevel);
+            noise->FillFractalBandSet(expected, xStart >> level, yStart >> level, zStart >> level,
+                xLevel, yLevel, zLevel, 0, noise->GetNyquistOctaves(scale), scale);
+
+            for (int i = 0; i < xLevel * yLevel * zLevel; i++)
+                REQUIRE(levels[level][i] == Approx(expected[i]).margin(1e-5));
+
+            FastNoiseSIMD::FreeNoiseSet(expected);
+        }
+
+        for (int level = 0; level < levelCount; level++)
+            FastNoiseSIMD::FreeNoiseSet(levels[level]);
+    }
+
+    REQUIRE(noise->GetNyquistOctaves(1.0f) > noise->GetNyquistOctaves(8.0f));
+
+    delete noise;
+}
+
+TEST_CASE("anti-aliased fractal fades the last octave", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::ValueFractal);
+    noise->SetFractalOctaves(8);
+    noise->SetFractalAntiAliasing(true);
+
+    // Spacing of 0.5 / 2^1.5 noise units leaves 2.5 octaves below the Nyquist limit
+    const float scaleModifier = 0.5f / std::pow(2.0f, 1.5f) / 0.01f;
+    const int size = 4 * 4 * 8;
+
+    float* actual = noise->GetNoiseSet(1, 2, 3, 4, 4, 8, scaleModifier);
+    float* low = FastNoiseSIMD::GetEmptySet(size);
+    float* faded = FastNoiseSIMD::GetEmptySet(size);
+    noise->FillFractalBandSet(low, 1, 2, 3, 4, 4, 8, 0, 2, scaleModifier);
+    noise->FillFractalBandSet(faded, 1, 2, 3, 4, 4, 8, 2, 3, scaleModifier);
+
+    for (int i = 0; i < size; i++)
+        REQUIRE(actual[i] == Approx(low[i] + 0.5f * faded[i]).margin(1e-4));
+
+    FastNoiseSIMD::FreeNoiseSet(actual);
+    FastNoiseSIMD::FreeNoiseSet(low);
+    FastNoiseSIMD::FreeNoiseSet(faded);
+    delete noise;
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+#include "simd_levels.h"
+
+// Second pass over a filled set, what the reduction replaces
+static void ReduceSet(FastNoiseReduction& reduction, const float* set, int size)
+{
+    float scale = float(reduction.histogramBins) / (reduction.histogramMax - reduction.histogramMin);
+
+    for (int i = 0; i < size; i++)
+    {
+        reduction.min = std::min(reduction.min, set[i]);
+        reduction.max = std::max(reduction.max, set[i]);
+        reduction.sum += set[i];
+        float bin = std::min(std::max((set[i] - reduction.histogramMin) * scale, 0.0f), float(reduction.histogramBins - 1));
+        reduction.histogram[int(bin)]++;
+    }
+    reduction.count += uint64_t(size);
+}
+
+static void RequireReductionsMatch(const FastNoiseReduction& actual, const FastNoiseReduction& expected)
+{
+    REQUIRE(actual.count == expected.count);
+    REQUIRE(actual.min == expected.min);
+    REQUIRE(actual.max == expected.max);
+    REQUIRE(actual.sum == Approx(expected.sum).margin(1e-3));
+    REQUIRE(actual.GetMean() == Approx(expected.GetMean()).margin(1e-5));
+
+    for (int bin = 0; bin < FN_MAX_HISTOGRAM_BINS; bin++)
+        REQUIRE(actual.histogram[bin] == expected.histogram[bin]);
+}
+
+TEST_CASE("reduction matches a second pass over the set", "[FastNoiseSIMD]")
+{
+    ForEachSIMDLevel({ FastNoiseSIMD::SimplexFractal, FastNoiseSIMD::WhiteNoise, FastNoiseSIMD::Cellular }, [](FastNoiseSIMD& noise, int zSize)
+    {
+        const int size = 9 * 7 * zSize;
+        float* set = FastNoiseSIMD::GetEmptySet(size);
+        float* plain = noise.GetNoiseSet(-4, 2, 30, 9, 7, zSize);
+
+        // Narrower than the noise range so both outer bins collect clamped values
+        FastNoiseReduction reduction;
+        reduction.histogramBins = 37;
+        reduction.histogramMin = -0.8f;
+        reduction.histogramMax = 0.6f;
+        noise.FillNoiseSet(set, -4, 2, 30, 9, 7, zSize, 1.0f, reduction);
+        REQUIRE(std::memcmp(set, plain, size * sizeof(float)) == 0);
+
+        FastNoiseReduction expected = reduction;
+        expected.Reset();
+        ReduceSet(expected, set, size);
+        RequireReductionsMatch(reduction, expected);
+
+        // A second fill adds to the results
+        noise.FillNoiseSet(set, 5, 2, 30, 9, 7, zSize, 1.0f, reduction);
+        ReduceSet(expected, set, size);
+        RequireReductionsMatch(reduction, expected);
+
+        FastNoiseSIMD::FreeNoiseSet(set);
+        FastNoiseSIMD::FreeNoiseSet(plain);
+    });
+}
+
+TEST_CASE("reduction of vector set fills", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+
+    const int zSizes[] = { 16, 5 };
+
+    for (int zSize : zSizes)
+    {
+        FastNoiseVectorSet vectorSet;
+        FastNoiseSIMD::FillVectorSet(&vectorSet, 3, 7, zSize);
+
+        float* set = FastNoiseSIMD::GetEmptySet(vectorSet.size);
+        FastNoiseReduction reduction;
+        reduction.histogramBins = FN_MAX_HISTOGRAM_BINS;
+        noise->FillNoiseSet(set, &vectorSet, reduction, 1.0f, 2.0f, 3.0f);
+
+        FastNoiseReduction expected = reduction;
+        expected.Reset();
+        ReduceSet(expected, set, vectorSet.size);
+
+        INFO("zSize " << zSize);
+        RequireReductionsMatch(reduction, expected);
+
+        FastNoiseSIMD::FreeNoiseSet(set);
+    }
+
+    delete noise;
+}
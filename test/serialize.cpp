@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include <cstring>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+static FastNoiseConfig GetSerializeConfig()
+{
+    const float transform[12] = { 0.8f, -0.6f, 0, 3.5f, 0.6f, 0.8f, 0, -1.25f, 0, 0, 1, 0.1f };
+    const float amplitudes[] = { 0.6f, -0.3f, 0.1f };
+    const float frequencies[] = { 0.5f, 1.7f, 5.3f };
+    const int seedOffsets[] = { 7, -2, 19 };
+
+    FastNoiseConfig config(-4242);
+    config.SetNoiseType(FastNoiseSIMD::Cellular);
+    config.SetFrequency(0.0123f);
+    config.SetAxisScales(1.0f, 0.5f, 2.0f);
+    config.SetTransform(transform);
+    config.SetFractalType(FastNoiseSIMD::HybridMulti);
+    config.SetFractalOctaveWeights(3, amplitudes, frequencies, seedOffsets);
+    config.SetFractalRotation(true);
+    config.SetCellularReturnType(FastNoiseSIMD::NoiseLookup);
+    config.SetCellularNoiseLookupType(FastNoiseSIMD::OpenSimplex2Fractal);
+    config.SetCellularDistance2Indicies(1, 3);
+    config.SetCellularJitter(0.3f);
+    config.SetPerturbType(FastNoiseSIMD::SimplexGradientFractal);
+    config.SetPerturbAmp(1.7f);
+    config.SetPerturbFractalGain(0.45f);
+    return config;
+}
+
+static void RequireSameNoise(const FastNoiseConfig& a, const FastNoiseConfig& b)
+{
+    const FastNoiseSIMD* engine = FastNoiseSIMD::NewFastNoiseSIMD();
+    float* setA = engine->GetNoiseSet(a, -5, 2, 7, 4, 4, 13);
+    float* setB = engine->GetNoiseSet(b, -5, 2, 7, 4, 4, 13);
+
+    REQUIRE(std::memcmp(setA, setB, 4 * 4 * 13 * sizeof(float)) == 0);
+
+    FastNoiseSIMD::FreeNoiseSet(setA);
+    FastNoiseSIMD::FreeNoiseSet(setB);
+    delete engine;
+}
+
+TEST_CASE("configs round trip through the binary and text forms", "[FastNoiseSIMD]")
+{
+    const FastNoiseConfig config = GetSerializeConfig();
+    const std::vector<uint8_t> binary = config.SaveBinary();
+
+    FastNoiseConfig fromBinary;
+    REQUIRE(fromBinary.LoadBinary(binary.data(), binary.size()));
+    REQUIRE(fromBinary.SaveBinary() == binary);
+    REQUIRE(fromBinary.GetHash() == config.GetHash());
+    RequireSameNoise(config, fromBinary);
+
+    FastNoiseConfig fromText;
+    REQUIRE(fromText.LoadText(config.SaveText()));
+    REQUIRE(fromText.SaveBinary() == binary);
+    RequireSameNoise(config, fromText);
+
+    // The hash follows every setting
+    FastNoiseConfig changed = config;
+    changed.SetCellularJitter(0.31f);
+    REQUIRE(changed.GetHash() != config.GetHash());
+}
+
+TEST_CASE("config hash is stable", "[FastNoiseSIMD]")
+{
+    // Changing these values breaks caches keyed by the hash, bump FN_CONFIG_VERSION with any layout change
+    REQUIRE(FastNoiseConfig().GetHash() == 0xacfe68032d187fabULL);
+    REQUIRE(GetSerializeConfig().GetHash() == 0x301a200289b95600ULL);
+}
+
+TEST_CASE("invalid configs are rejected", "[FastNoiseSIMD]")
+{
+    const FastNoiseConfig config = GetSerializeConfig();
+    std::vector<uint8_t> binary = config.SaveBinary();
+
+    FastNoiseConfig loaded;
+    const uint64_t defaultHash = loaded.GetHash();
+
+    REQUIRE_FALSE(loaded.LoadBinary(binary.data(), binary.size() - 1));
+    binary.push_back(0);
+    REQUIRE_FALSE(loaded.LoadBinary(binary.data(), binary.size()));
+    binary.pop_back();
+    binary[3] = 99;
+    REQUIRE_FALSE(loaded.LoadBinary(binary.data(), binary.size()));
+
+    // Octave counts outside 1 to FN_MAX_OCTAVES, without a transform the fractal octaves follow the 28 byte prefix
+    // and the perturb octaves are the fourth value from the end
+    const std::vector<uint8_t> defaults = FastNoiseConfig().SaveBinary();
+    const size_t octaveOffsets[] = { 32, defaults.size() - 16 };
+    for (size_t offset : octaveOffsets)
+    {
+        for (int32_t octaves : { 0, -1, FN_MAX_OCTAVES + 1, FN_MAX_OCTAVES })
+        {
+            std::vector<uint8_t> corrupt = defaults;
+            for (int i = 0; i < 4; i++)
+                corrupt[offset + i] = uint8_t(uint32_t(octaves) >> (i * 8));
+
+            INFO("offset " << offset << ", octaves " << octaves);
+            REQUIRE(loaded.LoadBinary(corrupt.data(), corrupt.size()) == (octaves == FN_MAX_OCTAVES));
+        }
+    }
+    loaded = FastNoiseConfig();
+
+    REQUIRE_FALSE(loaded.LoadText("Seed 5\n"));
+    REQUIRE_FALSE(loaded.LoadText("FastNoiseConfig 1\nNoiseType Simplexx\n"));
+    REQUIRE_FALSE(loaded.LoadText("FastNoiseConfig 1\nFrequency 0.1 0.2\n"));
+    REQUIRE_FALSE(loaded.LoadText("FastNoiseConfig 1\nFractalOctaveWeights 2 1 1 0\n"));
+    REQUIRE_FALSE(loaded.LoadText("FastNoiseConfig 1\nFractalOctaves 0\n"));
+    REQUIRE_FALSE(loaded.LoadText("FastNoiseConfig 1\nPerturbFractalOctaves 2000000000\n"));
+    REQUIRE(loaded.GetHash() == defaultHash);
+
+    REQUIRE(loaded.LoadText("# Preset\nFastNoiseConfig 1\n\nSeed 5\nFractalType RigidMulti\n"));
+    REQUIRE(loaded.GetSeed() == 5);
+}
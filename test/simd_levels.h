@@ -0,0 +1,36 @@
+#ifndef FASTNOISE_SIMD_TEST_LEVELS_H
+#define FASTNOISE_SIMD_TEST_LEVELS_H
+
+#include <catch2/catch.hpp>
+
+#include <initializer_list>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+// Calls check(noise, zSize) with an object of every SIMD level up to the detected one, set to each noise type
+// zSize 16 fills whole vectors at every level, 13 leaves a partial vector
+template <typename Check>
+static void ForEachSIMDLevel(std::initializer_list<FastNoiseSIMD::NoiseType> noiseTypes, Check check)
+{
+    const int zSizes[] = { 16, 13 };
+
+    for (int level = FN_NO_SIMD_FALLBACK; level <= FastNoiseSIMD::GetSIMDLevel(); level++)
+    {
+        FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMDAtLevel(level, 1337);
+
+        for (FastNoiseSIMD::NoiseType noiseType : noiseTypes)
+        {
+            noise->SetNoiseType(noiseType);
+
+            for (int zSize : zSizes)
+            {
+                INFO("SIMD level " << level << ", noise type " << noiseType << ", zSize " << zSize);
+                check(*noise, zSize);
+            }
+        }
+
+        delete noise;
+    }
+}
+
+#endif
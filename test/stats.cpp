@@ -0,0 +1,35 @@
+#include <catch2/catch.hpp>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+TEST_CASE("fill stats", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::SimplexFractal);
+    noise->SetFractalOctaves(3);
+    noise->ResetStats();
+
+    float* aligned = noise->GetNoiseSet(0, 0, 0, 4, 4, 16);
+    float* unaligned = noise->GetNoiseSet(0, 0, 0, 4, 4, 13);
+    FastNoiseStats stats = noise->GetStats();
+
+#ifdef FN_ENABLE_STATS
+    REQUIRE(stats.fills == 2);
+    REQUIRE(stats.points == 4 * 4 * 16 + 4 * 4 * 13);
+    REQUIRE(stats.octaves == stats.points * 3);
+    REQUIRE(stats.allocations == 2);
+    REQUIRE(stats.alignedVectors > 0);
+    REQUIRE(stats.resetVectors > 0);
+    REQUIRE(stats.noiseCycles > 0);
+
+    noise->ResetStats();
+    stats = noise->GetStats();
+#endif
+    REQUIRE(stats.fills == 0);
+    REQUIRE(stats.points == 0);
+    REQUIRE(stats.allocations == 0);
+
+    FastNoiseSIMD::FreeNoiseSet(aligned);
+    FastNoiseSIMD::FreeNoiseSet(unaligned);
+    delete noise;
+}
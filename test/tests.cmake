@@ -1,5 +1,22 @@
 add_executable(FastNoiseSIMD_tests
+    test/async.cpp
+    test/cache.cpp
+    test/config.cpp
+    test/determinism.cpp
+    test/golden.cpp
+    test/heightmap.cpp
+    test/incremental.cpp
+    test/mesh.cpp
+    test/octave_weights.cpp
+    test/output_transform.cpp
+    test/pyramid.cpp
+    test/reduction.cpp
+    test/serialize.cpp
     test/simplex_noise.cpp
+    test/stats.cpp
+    test/transform.cpp
+    test/vector_set.cpp
+    test/volume.cpp
     test/main.cpp
 )
 
@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+TEST_CASE("transform translation matches offset region", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    noise->SetAxisScales(1.0f, 2.0f, 0.5f);
+
+    float* expected = noise->GetNoiseSet(10, -4, 7, 4, 4, 13);
+
+    const float translate[12] = {
+        1, 0, 0, 10,
+        0, 1, 0, -4,
+        0, 0, 1, 7 };
+    noise->SetTransform(translate);
+    float* actual = noise->GetNoiseSet(0, 0, 0, 4, 4, 13);
+
+    for (int i = 0; i < 4 * 4 * 13; i++)
+        REQUIRE(actual[i] == Approx(expected[i]).margin(1e-4));
+
+    noise->ClearTransform();
+    float* cleared = noise->GetNoiseSet(10, -4, 7, 4, 4, 13);
+
+    for (int i = 0; i < 4 * 4 * 13; i++)
+        REQUIRE(cleared[i] == expected[i]);
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(actual);
+    FastNoiseSIMD::FreeNoiseSet(cleared);
+    delete noise;
+}
+
+TEST_CASE("transform rotation matches rotated vector set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::ValueFractal);
+    noise->SetFractalRotation(true);
+
+    // 90 degrees around z: (x, y, z) -> (-y, x, z)
+    const float rotate[12] = {
+        0, -1, 0, 0,
+        1, 0, 0, 0,
+        0, 0, 1, 0 };
+
+    FastNoiseVectorSet rotated;
+    FastNoiseSIMD::FillGridVectorSet(&rotated, 5, 6, 8, rotate);
+    float* expected = FastNoiseSIMD::GetEmptySet(rotated.size);
+    noise->FillNoiseSet(expected, &rotated);
+
+    noise->SetTransform(rotate);
+    float* actual = noise->GetNoiseSet(0, 0, 0, 5, 6, 8);
+
+    for (int i = 0; i < rotated.size; i++)
+        REQUIRE(actual[i] == Approx(expected[i]).margin(1e-4));
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(actual);
+    delete noise;
+}
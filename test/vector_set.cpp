@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <cmath>
+
+#include "FastNoiseSIMD/FastNoiseSIMD.h"
+
+TEST_CASE("implicit grid matches stored vector set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::SimplexFractal);
+
+    // Both the aligned and the axis reset path of the grid counters
+    const int z_sizes[] = { 16, 5 };
+
+    for (int z_size : z_sizes)
+    {
+        FastNoiseVectorSet stored;
+        FastNoiseVectorSet implicit;
+        FastNoiseSIMD::FillVectorSet(&stored, 3, 7, z_size);
+        FastNoiseSIMD::FillGridVectorSet(&implicit, 3, 7, z_size);
+
+        REQUIRE(implicit.size == stored.size);
+        REQUIRE(implicit.xSet == nullptr);
+
+        float* expected = FastNoiseSIMD::GetEmptySet(stored.size);
+        float* actual = FastNoiseSIMD::GetEmptySet(implicit.size);
+        noise->FillNoiseSet(expected, &stored, 1.0f, 2.0f, 3.0f);
+        noise->FillNoiseSet(actual, &implicit, 1.0f, 2.0f, 3.0f);
+
+        for (int i = 0; i < stored.size; i++)
+            REQUIRE(actual[i] == expected[i]);
+
+        FastNoiseSIMD::FreeNoiseSet(expected);
+        FastNoiseSIMD::FreeNoiseSet(actual);
+    }
+
+    delete noise;
+}
+
+TEST_CASE("implicit grid is filled without sampling", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+
+    FastNoiseVectorSet vectorSet;
+    FastNoiseSIMD::FillGridVectorSet(&vectorSet, 4, 6, 9);
+    float* expected = FastNoiseSIMD::GetEmptySet(vectorSet.size);
+    noise->FillNoiseSet(expected, &vectorSet);
+
+    // A sample scale set on an implicit grid has no sample lattice to read
+    vectorSet.sampleScale = 2;
+    float* actual = FastNoiseSIMD::GetEmptySet(vectorSet.size);
+    noise->FillSampledNoiseSet(actual, &vectorSet);
+
+    for (int i = 0; i < vectorSet.size; i++)
+        REQUIRE(actual[i] == expected[i]);
+
+    // Refilled as a sampling set, the positions are read again
+    FastNoiseVectorSet sampling;
+    FastNoiseSIMD::FillSamplingVectorSet(&sampling, 2, 4, 6, 9);
+    FastNoiseSIMD::FillSamplingVectorSet(&vectorSet, 2, 4, 6, 9);
+    REQUIRE(vectorSet.kind == FastNoiseVectorSet::Stored);
+
+    noise->FillSampledNoiseSet(expected, &sampling);
+    noise->FillSampledNoiseSet(actual, &vectorSet);
+
+    for (int i = 0; i < 4 * 6 * 9; i++)
+        REQUIRE(actual[i] == expected[i]);
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(actual);
+    delete noise;
+}
+
+TEST_CASE("implicit sphere vector set", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::Simplex);
+
+    // Patch of the +x cube face: direction = (1, v - 0.5, u - 0.5)
+    const int size = 9;
+    const float step = 1.0f / (size - 1);
+    const float transform[12] = {
+        0, 0, 0, 1,
+        0, step, 0, -0.5f,
+        0, 0, step, -0.5f };
+    const float radius = 500.0f;
+
+    FastNoiseVectorSet implicit;
+    FastNoiseSIMD::FillSphereVectorSet(&implicit, 1, size, size, transform, radius);
+
+    FastNoiseVectorSet stored(size * size);
+    for (int iy = 0; iy < size; iy++)
+    {
+        for (int iz = 0; iz < size; iz++)
+        {
+            float x = 1.0f, y = iy * step - 0.5f, z = iz * step - 0.5f;
+            float scale = radius / std::sqrt(x * x + y * y + z * z);
+            int index = iy * size + iz;
+            stored.xSet[index] = x * scale;
+            stored.ySet[index] = y * scale;
+            stored.zSet[index] = z * scale;
+        }
+    }
+
+    float* expected = FastNoiseSIMD::GetEmptySet(stored.size);
+    float* actual = FastNoiseSIMD::GetEmptySet(implicit.size);
+    noise->FillNoiseSet(expected, &stored);
+    noise->FillNoiseSet(actual, &implicit);
+
+    for (int i = 0; i < stored.size; i++)
+        REQUIRE(actual[i] == Approx(expected[i]).margin(1e-3));
+
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    FastNoiseSIMD::FreeNoiseSet(actual);
+    delete noise;
+}
+
+TEST_CASE("cube sphere faces meet at the edges", "[FastNoiseSIMD]")
+{
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::SimplexFractal);
+
+    const int size = 17;
+    const float radius = 300.0f;
+
+    float* posX = noise->GetCubeSphereSet(0, -1.0f, -1.0f, 1.0f, 1.0f, size, size, radius);
+    float* posZ = noise->GetCubeSphereSet(4, -1.0f, -1.0f, 1.0f, 1.0f, size, size, radius);
+
+    // +X face at u = -1 and +Z face at u = 1 share the edge x = z
+    for (int v = 0; v < size; v++)
+        REQUIRE(posX[v * size] == Approx(posZ[v * size + size - 1]).margin(1e-4));
+
+    FastNoiseSIMD::FreeNoiseSet(posX);
+    FastNoiseSIMD::FreeNoiseSet(posZ);
+    delete noise;
+}
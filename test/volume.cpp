@@ -0,0 +1,192 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "FastNoiseSIMD/FastNoiseSIMD_async.h"
+#include "FastNoiseSIMD/FastNoiseSIMD_volume.h"
+
+#ifdef FN_VOLUME_MMAP
+TEST_CASE("volumes stream to a mapped file in every layout", "[FastNoiseSIMD]")
+{
+    const char* path = "FastNoiseSIMD_test_volume.fnvl";
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseFillPool pool(2);
+    float* expected = noise->GetNoiseSet(-6, 4, 11, 21, 9, 13);
+
+    const FastNoiseVolumeHeader::Layout layouts[] = { FastNoiseVolumeHeader::Float, FastNoiseVolumeHeader::Quantized,
+        FastNoiseVolumeHeader::Bricked, FastNoiseVolumeHeader::Compressed };
+    for (FastNoiseVolumeHeader::Layout layout : layouts)
+    {
+        // A budget of a few rows splits the volume into many slabs
+        FastNoiseVolumeWriter writer;
+        writer.layout = layout;
+        writer.memoryBudget = 2 * 3 * 9 * 13 * sizeof(float);
+        writer.brickSize = 4;
+        writer.pool = layout == FastNoiseVolumeHeader::Float ? &pool : nullptr;
+        REQUIRE(writer.Generate(path, noise, noise->GetConfig(), -6, 4, 11, 21, 9, 13));
+
+        FastNoiseVolumeFile volume;
+        REQUIRE(volume.Open(path));
+        REQUIRE(volume.GetHeader().layout == uint32_t(layout));
+        REQUIRE(volume.GetHeader().configHash == noise->GetConfig().GetHash());
+
+        // Half a quantization step of the default range plus rounding
+        // Compressed bricks are quantized over their own range, which is at most the default range
+        float tolerance = layout == FastNoiseVolumeHeader::Quantized || layout == FastNoiseVolumeHeader::Compressed ? 2.0f / 65535.0f : 0.0f;
+        for (int x = 0; x < 21; x++)
+        {
+            for (int y = 0; y < 9; y++)
+            {
+                for (int z = 0; z < 13; z++)
+                {
+                    INFO("layout " << layout << ", position " << x << " " << y << " " << z);
+                    REQUIRE(volume.GetValue(x, y, z) == Approx(expected[(x * 9 + y) * 13 + z]).margin(tolerance));
+                }
+            }
+        }
+    }
+
+    // Files shorter than their header are rejected
+    std::remove(path);
+    std::FILE* file = std::fopen(path, "wb");
+    REQUIRE(file);
+    std::fwrite("FNVL", 1, 4, file);
+    std::fclose(file);
+    FastNoiseVolumeFile volume;
+    REQUIRE_FALSE(volume.Open(path));
+
+    std::remove(path);
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    delete noise;
+}
+
+TEST_CASE("volume slabs of one x are filled by several workers", "[FastNoiseSIMD]")
+{
+    const char* path = "FastNoiseSIMD_test_workers.fnvl";
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    FastNoiseFillPool pool(4);
+
+    // Two slabs of a single x fit the budget
+    FastNoiseVolumeWriter writer;
+    writer.layout = FastNoiseVolumeHeader::Float;
+    writer.memoryBudget = 2 * 24 * 16 * sizeof(float);
+    writer.pool = &pool;
+    REQUIRE(writer.Generate(path, noise, noise->GetConfig(), 0, 0, 0, 12, 24, 16));
+
+    // Each of the 12 slabs is split into a band of y for every worker
+    int workers = 0;
+    uint64_t jobs = 0;
+    for (uint64_t count : pool.GetJobCounts())
+    {
+        workers += count > 0;
+        jobs += count;
+    }
+    REQUIRE(jobs == 12 * 4);
+    REQUIRE(workers > 1);
+
+    FastNoiseVolumeFile volume;
+    REQUIRE(volume.Open(path));
+    float* expected = noise->GetNoiseSet(0, 0, 0, 12, 24, 16);
+    for (int i = 0; i < 12 * 24 * 16; i++)
+        REQUIRE(volume.GetValue(i / (24 * 16), i / 16 % 24, i % 16) == expected[i]);
+
+    volume.Close();
+    std::remove(path);
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    delete noise;
+}
+#endif
+
+// Compressed volumes are written with stdio and read through any file mapping
+#if defined(FN_VOLUME_MMAP) || defined(_WIN32)
+TEST_CASE("compressed volumes store the config and decode single bricks", "[FastNoiseSIMD]")
+{
+    const char* path = "FastNoiseSIMD_test_compressed.fnvl";
+    FastNoiseSIMD* noise = FastNoiseSIMD::NewFastNoiseSIMD();
+    noise->SetNoiseType(FastNoiseSIMD::PerlinFractal);
+    noise->SetFractalOctaves(5);
+
+    FastNoiseVolumeWriter writer;
+    writer.layout = FastNoiseVolumeHeader::Compressed;
+    FastNoiseVolumeFile volume;
+    std::vector<float> brick;
+    const int detectedLevel = FastNoiseSIMD::GetSIMDLevel();
+
+    // 8^3 bricks are one whole block, 9^3 bricks end in a short block and row
+    const int brickSizes[] = { 8, 9 };
+    const int bits[] = { 12, 24 };
+    for (int b = 0; b < 2; b++)
+    {
+        const int brickSize = brickSizes[b], brickFloats = brickSize * brickSize * brickSize;
+        writer.brickSize = brickSize;
+        writer.compressedBits = bits[b];
+        REQUIRE(writer.Generate(path, noise, noise->GetConfig(), 0, 0, 0, 24, 24, 24));
+
+        // Brick (1, 1, 0) alone matches the same region filled directly, within its quantization step
+        float* expected = noise->GetNoiseSet(brickSize, brickSize, 0, brickSize, brickSize, brickSize);
+        float min = expected[0], max = expected[0];
+        for (int i = 0; i < brickFloats; i++)
+        {
+            min = std::min(min, expected[i]);
+            max = std::max(max, expected[i]);
+        }
+        const float tolerance = (max - min) / float((1 << bits[b]) - 1) + 1e-6f;
+
+        // Bricks decode at the current SIMD level
+        for (int level = FN_NO_SIMD_FALLBACK; level <= detectedLevel; level++)
+        {
+            FastNoiseSIMD::SetSIMDLevel(level);
+            REQUIRE(volume.Open(path));
+
+            FastNoiseConfig config;
+            REQUIRE(volume.GetConfig(config));
+            REQUIRE(config.GetHash() == noise->GetConfig().GetHash());
+
+            brick.assign(brickFloats, 0.0f);
+            REQUIRE(volume.DecodeBrick(1, 1, 0, brick.data()));
+
+            INFO("brick size " << brickSize << ", SIMD level " << level);
+            for (int i = 0; i < brickFloats; i++)
+                REQUIRE(brick[i] == Approx(expected[i]).margin(tolerance));
+        }
+
+        // Windows can't rewrite a mapped file
+        volume.Close();
+        FastNoiseSIMD::SetSIMDLevel(detectedLevel);
+        FastNoiseSIMD::FreeNoiseSet(expected);
+    }
+
+    // A constant volume stores only the minimum of each brick, which is decoded into every value
+    noise->SetFrequency(0.0f);
+    writer.brickSize = 8;
+    REQUIRE(writer.Generate(path, noise, noise->GetConfig(), 0, 0, 0, 24, 24, 24));
+    REQUIRE(volume.Open(path));
+
+    float* expected = noise->GetNoiseSet(0, 0, 0, 24, 24, 24);
+    brick.resize(8 * 8 * 8);
+    for (int bx = 0; bx < 3; bx++)
+    {
+        for (int by = 0; by < 3; by++)
+        {
+            for (int bz = 0; bz < 3; bz++)
+            {
+                REQUIRE(volume.DecodeBrick(bx, by, bz, brick.data()));
+
+                for (int i = 0; i < 8 * 8 * 8; i++)
+                {
+                    int x = bx * 8 + i / 64, y = by * 8 + i / 8 % 8, z = bz * 8 + i % 8;
+                    INFO("position " << x << " " << y << " " << z);
+                    REQUIRE(brick[i] == expected[(x * 24 + y) * 24 + z]);
+                }
+            }
+        }
+    }
+
+    volume.Close();
+    std::remove(path);
+    FastNoiseSIMD::FreeNoiseSet(expected);
+    delete noise;
+}
+#endif